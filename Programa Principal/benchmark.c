@@ -0,0 +1,1131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/stat.h>
+#include "estruturas.h"
+
+static double agoraSegundos(void)
+{
+    struct timespec instante;
+    clock_gettime(CLOCK_MONOTONIC, &instante);
+    return instante.tv_sec + instante.tv_nsec / 1e9;
+}
+
+static void gerarNome(char nome[], unsigned int *semente)
+{
+    static const char *silabas[] = {"SA", "o", "Pau", "LO", "Rio", "de", "Ja", "NEI", "ro",
+                                    "Cu", "RI", "ti", "Ba", "Flo", "RIA", "No", "Po", "lis"};
+    static const char *acentos[] = {"Á", "ã", "É", "ç", "Í", "õ", "Ú", "ê"};
+
+    nome[0] = '\0';
+    int partes = 2 + rand_r(semente) % 5;
+    for (int i = 0; i < partes; i++)
+    {
+        if (rand_r(semente) % 4 == 0)
+        {
+            strcat(nome, acentos[rand_r(semente) % 8]);
+        }
+        strcat(nome, silabas[rand_r(semente) % 18]);
+        if (i + 1 < partes && rand_r(semente) % 3 == 0)
+        {
+            strcat(nome, " ");
+        }
+    }
+}
+
+static void benchmarkNomes(int quantidade, int repeticoes)
+{
+    char (*nomes)[50] = malloc(sizeof(char[50]) * quantidade);
+    char (*brutos)[TAMANHO_CHAVE] = calloc(quantidade, sizeof(char[TAMANHO_CHAVE]));
+    char (*chaves)[TAMANHO_CHAVE] = malloc(sizeof(char[TAMANHO_CHAVE]) * quantidade);
+    char (*referencia)[TAMANHO_CHAVE] = malloc(sizeof(char[TAMANHO_CHAVE]) * quantidade);
+    unsigned int *hashes = malloc(sizeof(unsigned int) * quantidade);
+    unsigned int *hashesReferencia = malloc(sizeof(unsigned int) * quantidade);
+    if (nomes == NULL || brutos == NULL || chaves == NULL || referencia == NULL || hashes == NULL || hashesReferencia == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        exit(1);
+    }
+
+    unsigned int semente = 42;
+    for (int i = 0; i < quantidade; i++)
+    {
+        gerarNome(nomes[i], &semente);
+        strcpy(brutos[i], nomes[i]);
+    }
+
+    printf("\n=== Comparação de nomes (%d nomes x %d repetições) ===\n", quantidade, repeticoes);
+
+    double inicio = agoraSegundos();
+    long iguaisLegado = 0;
+    for (int r = 0; r < repeticoes; r++)
+    {
+        for (int i = 0; i < quantidade; i++)
+        {
+            char a[50], b[50];
+            strcpy(a, nomes[i]);
+            strcpy(b, nomes[(i * 7 + r) % quantidade]);
+            converterMinusculo(a);
+            converterMinusculo(b);
+            iguaisLegado += strcmp(a, b) == 0;
+        }
+    }
+    double tempoLegado = agoraSegundos() - inicio;
+    printf("%-10s minúsculas+strcmp: %8.2f ns/comparação\n", "legado",
+           tempoLegado * 1e9 / ((double)quantidade * repeticoes));
+
+    int quantidadeKernels;
+    KernelsNomes *kernels = listarKernelsNomes(&quantidadeKernels);
+    for (int k = 0; k < quantidadeKernels; k++)
+    {
+        inicio = agoraSegundos();
+        for (int r = 0; r < repeticoes; r++)
+        {
+            for (int i = 0; i < quantidade; i++)
+            {
+                memcpy(chaves[i], brutos[i], TAMANHO_CHAVE);
+                kernels[k].dobrarCaixa(chaves[i]);
+            }
+        }
+        double tempoDobra = agoraSegundos() - inicio;
+
+        inicio = agoraSegundos();
+        for (int r = 0; r < repeticoes; r++)
+        {
+            for (int i = 0; i < quantidade; i++)
+            {
+                hashes[i] = kernels[k].hash(chaves[i]);
+            }
+        }
+        double tempoHash = agoraSegundos() - inicio;
+
+        inicio = agoraSegundos();
+        long iguais = 0;
+        for (int r = 0; r < repeticoes; r++)
+        {
+            for (int i = 0; i < quantidade; i++)
+            {
+                iguais += kernels[k].iguais(chaves[i], chaves[(i * 7 + r) % quantidade]);
+            }
+        }
+        double tempoIguais = agoraSegundos() - inicio;
+
+        if (k == 0)
+        {
+            memcpy(referencia, chaves, sizeof(char[TAMANHO_CHAVE]) * quantidade);
+            memcpy(hashesReferencia, hashes, sizeof(unsigned int) * quantidade);
+        }
+        int divergencias = 0;
+        for (int i = 0; i < quantidade; i++)
+        {
+            divergencias += memcmp(referencia[i], chaves[i], TAMANHO_CHAVE) != 0 || hashesReferencia[i] != hashes[i];
+        }
+
+        double operacoes = (double)quantidade * repeticoes;
+        printf("%-10s dobra: %6.2f ns  hash: %6.2f ns  igualdade: %6.2f ns  (%ld iguais, %d divergências)\n",
+               kernels[k].nome, tempoDobra * 1e9 / operacoes, tempoHash * 1e9 / operacoes,
+               tempoIguais * 1e9 / operacoes, iguais, divergencias);
+    }
+    printf("Kernel selecionado: %s\n", obterKernelsNomes()->nome);
+
+    free(nomes);
+    free(brutos);
+    free(chaves);
+    free(referencia);
+    free(hashes);
+    free(hashesReferencia);
+}
+
+static void exportarComFprintf(Rodovia *lista, char *nomeArquivo)
+{
+    FILE *arquivo = fopen(nomeArquivo, "w");
+    if (arquivo == NULL)
+    {
+        return;
+    }
+
+    for (Rodovia *rodoviaAtual = lista; rodoviaAtual != NULL; rodoviaAtual = rodoviaAtual->proxima)
+    {
+        double pedagioTotal = centavosParaReais(calcularPedagioTotal(rodoviaAtual));
+        fprintf(arquivo, "Rodovia: %s\n", rodoviaAtual->nome);
+        fprintf(arquivo, "Pedágio: R$ %.2f\n", pedagioTotal);
+
+        for (Cidade *cidadeAtual = rodoviaAtual->cidades; cidadeAtual != NULL; cidadeAtual = cidadeAtual->proxima)
+        {
+            double ida = 0;
+            Centavos volta = PEDAGIO_INDEFINIDO;
+            if (cidadeAtual->anterior != NULL)
+            {
+                ida = centavosParaReais(rodoviaAtual->pedagiosIda[cidadeAtual->anterior->indice]);
+                volta = rodoviaAtual->pedagiosVolta[cidadeAtual->anterior->indice];
+            }
+            fprintf(arquivo, "\tCidade: %s, Distância: %.3f, Pedágio: R$ %.2f",
+                    cidadeAtual->nomeCidade, metrosParaKm(cidadeAtual->distancia), ida);
+            if (volta != PEDAGIO_INDEFINIDO)
+            {
+                fprintf(arquivo, ", Volta: R$ %.2f", centavosParaReais(volta));
+            }
+            fprintf(arquivo, "\n");
+        }
+        fprintf(arquivo, "\n");
+    }
+    fclose(arquivo);
+}
+
+static int arquivosIguais(char *nome1, char *nome2)
+{
+    FILE *a = fopen(nome1, "rb");
+    FILE *b = fopen(nome2, "rb");
+    int iguais = a != NULL && b != NULL;
+    while (iguais)
+    {
+        int c1 = fgetc(a), c2 = fgetc(b);
+        if (c1 != c2)
+        {
+            iguais = 0;
+        }
+        if (c1 == EOF || c2 == EOF)
+        {
+            break;
+        }
+    }
+    if (a != NULL)
+        fclose(a);
+    if (b != NULL)
+        fclose(b);
+    return iguais;
+}
+
+static Rodovia *gerarRede(int quantidadeCidades, int cidadesPorRodovia, unsigned int semente)
+{
+    Rodovia *lista = NULL;
+    int quantidadeRodovias = (quantidadeCidades + cidadesPorRodovia - 1) / cidadesPorRodovia;
+
+    for (int r = 0; r < quantidadeRodovias; r++)
+    {
+        char nomeRodovia[50];
+        snprintf(nomeRodovia, sizeof(nomeRodovia), "BR-%d", r);
+        lista = inserirRodovia(lista, nomeRodovia);
+
+        Metros distancia = 0;
+        for (int c = 0; c < cidadesPorRodovia && r * cidadesPorRodovia + c < quantidadeCidades; c++)
+        {
+            char nomeCidade[50];
+            snprintf(nomeCidade, sizeof(nomeCidade), "Cidade %d", (int)(rand_r(&semente) % (quantidadeCidades / 2 + 1)));
+            distancia += METROS_POR_KM + (rand_r(&semente) % 100000) * 10;
+            Cidade *cidade = inserirCidade(lista, nomeCidade, distancia);
+            if (cidade != NULL && cidade->anterior != NULL && rand_r(&semente) % 3 == 0)
+            {
+                lista->pedagiosIda[cidade->anterior->indice] = rand_r(&semente) % 4000;
+            }
+        }
+    }
+    return lista;
+}
+
+static void benchmarkSaida(int quantidadeCidades)
+{
+    printf("\n=== Exportação de texto (%d cidades) ===\n", quantidadeCidades);
+
+    BufferSaida saida;
+    iniciarBufferSaida(&saida, -1);
+    unsigned int semente = 7;
+    int divergencias = 0;
+    for (int i = 0; i < 200000; i++)
+    {
+        float valor;
+        if (i % 2)
+        {
+            valor = (rand_r(&semente) % 10000000) / 100.0f;
+        }
+        else
+        {
+            unsigned int bits = (unsigned int)rand_r(&semente) << 16 ^ (unsigned int)rand_r(&semente);
+            memcpy(&valor, &bits, sizeof(valor));
+        }
+
+        char esperado[512];
+        int tamanho = snprintf(esperado, sizeof(esperado), "%.2f", valor);
+        saida.usado = 0;
+        saidaDecimal(&saida, valor);
+        divergencias += saida.usado != (size_t)tamanho || memcmp(saida.dados, esperado, tamanho) != 0;
+    }
+    saida.usado = 0;
+    finalizarBufferSaida(&saida);
+    printf("Formatação de valores: %d divergência(s) em relação a printf(\"%%.2f\")\n", divergencias);
+
+    double inicio = agoraSegundos();
+    Rodovia *lista = gerarRede(quantidadeCidades, 100, 11);
+    printf("Rede gerada em %.2f s\n", agoraSegundos() - inicio);
+
+    char legado[] = "/tmp/benchmark_rodovias_fprintf.txt";
+    char novo[] = "/tmp/benchmark_rodovias_buffer.txt";
+
+    inicio = agoraSegundos();
+    exportarComFprintf(lista, legado);
+    double tempoLegado = agoraSegundos() - inicio;
+
+    inicio = agoraSegundos();
+    imprimirRodoviasEmArquivo(lista, novo);
+    double tempoNovo = agoraSegundos() - inicio;
+
+    printf("fprintf por campo:  %8.3f s\n", tempoLegado);
+    printf("buffer de saída:    %8.3f s (%.1fx)\n", tempoNovo, tempoLegado / tempoNovo);
+    printf("Arquivos %s\n", arquivosIguais(legado, novo) ? "idênticos" : "DIFERENTES");
+
+    unlink(legado);
+    unlink(novo);
+    liberarMemoria(lista);
+}
+
+static void benchmarkRotas(int quantidadeCidades, int consultas)
+{
+    printf("\n=== Rotas alternativas (%d cidades, %d consultas) ===\n", quantidadeCidades, consultas);
+
+    Rodovia *lista = gerarRede(quantidadeCidades, 100, 23);
+    double inicio = agoraSegundos();
+    Grafo *grafo = construirGrafo(lista);
+    printf("Grafo: %d vértices, %d arestas, montado em %.3f s\n",
+           grafo->quantidadeVertices, grafo->quantidadeArestas, agoraSegundos() - inicio);
+
+    BuscaRotas busca;
+    iniciarBuscaRotas(&busca, grafo, LIMITE_ROTULOS_ROTAS);
+
+    RotaAlternativa pareto[MAXIMO_ROTAS_ALTERNATIVAS], ponderadas[MAXIMO_ROTAS_ALTERNATIVAS];
+    RotaAlternativa menorDistancia, menorPedagio;
+    unsigned int semente = 5;
+    double tempoPareto = 0, tempoPonderadas = 0;
+    long totalPareto = 0, totalPonderadas = 0;
+    int divergencias = 0, truncadas = 0;
+
+    for (int i = 0; i < consultas; i++)
+    {
+        int origem = rand_r(&semente) % grafo->quantidadeVertices;
+        int destino = rand_r(&semente) % grafo->quantidadeVertices;
+
+        inicio = agoraSegundos();
+        int quantidade = rotasPareto(&busca, origem, destino, pareto, MAXIMO_ROTAS_ALTERNATIVAS);
+        tempoPareto += agoraSegundos() - inicio;
+        totalPareto += quantidade;
+        truncadas += busca.truncada;
+
+        inicio = agoraSegundos();
+        totalPonderadas += rotasPonderadas(&busca, origem, destino, 1, 1, ponderadas, MAXIMO_ROTAS_ALTERNATIVAS);
+        tempoPonderadas += agoraSegundos() - inicio;
+
+        if (quantidade == 0 || busca.truncada)
+        {
+            continue;
+        }
+        rotasPonderadas(&busca, origem, destino, 1, 0, &menorDistancia, 1);
+        divergencias += menorDistancia.distancia != pareto[0].distancia;
+        if (quantidade < MAXIMO_ROTAS_ALTERNATIVAS)
+        {
+            rotasPonderadas(&busca, origem, destino, 0, 1, &menorPedagio, 1);
+            divergencias += menorPedagio.pedagio != pareto[quantidade - 1].pedagio;
+        }
+    }
+
+    printf("Fronteira distância x pedágio: %8.3f ms/consulta (%.2f rotas em média)\n",
+           tempoPareto * 1e3 / consultas, (double)totalPareto / consultas);
+    printf("%d melhores por custo:         %8.3f ms/consulta (%.2f rotas em média)\n", MAXIMO_ROTAS_ALTERNATIVAS,
+           tempoPonderadas * 1e3 / consultas, (double)totalPonderadas / consultas);
+    printf("%d divergência(s) nos extremos da fronteira, %d busca(s) truncada(s)\n", divergencias, truncadas);
+
+    for (int i = 0; i < grafo->quantidadeSegmentos / 100; i++)
+    {
+        int segmento = rand_r(&semente) % grafo->quantidadeSegmentos;
+        marcarSegmentos(grafo->interditados, segmento, segmento + 1);
+    }
+    busca.pedagioMaximo = 30 * CENTAVOS_POR_REAL;
+    double tempoRestrito = 0;
+    long totalRestrito = 0, violacoes = 0;
+    int arestas[4096];
+    for (int i = 0; i < consultas; i++)
+    {
+        int origem = rand_r(&semente) % grafo->quantidadeVertices;
+        int destino = rand_r(&semente) % grafo->quantidadeVertices;
+
+        inicio = agoraSegundos();
+        int quantidade = rotasPareto(&busca, origem, destino, pareto, MAXIMO_ROTAS_ALTERNATIVAS);
+        tempoRestrito += agoraSegundos() - inicio;
+        totalRestrito += quantidade;
+
+        for (int j = 0; j < quantidade; j++)
+        {
+            int usadas = arestasDaRota(&busca, &pareto[j], arestas, 4096);
+            for (int k = 0; k < usadas; k++)
+            {
+                int segmento = grafo->segmentos[arestas[k]];
+                violacoes += grafo->pedagios[arestas[k]] > busca.pedagioMaximo ||
+                             ((grafo->interditados[segmento >> 6] >> (segmento & 63)) & 1);
+            }
+        }
+    }
+    printf("Com 1%% dos trechos interditados e pedágio máximo de R$ 30 por trecho: %8.3f ms/consulta "
+           "(%.2f rotas em média, %ld trecho(s) proibido(s) usado(s))\n",
+           tempoRestrito * 1e3 / consultas, (double)totalRestrito / consultas, violacoes);
+
+    liberarBuscaRotas(&busca);
+    liberarGrafo(grafo);
+    liberarMemoria(lista);
+}
+
+static void benchmarkAlcance(int quantidadeCidades, int consultas)
+{
+    printf("\n=== Cidades alcançáveis (%d cidades, %d consultas) ===\n", quantidadeCidades, consultas);
+
+    Rodovia *lista = gerarRede(quantidadeCidades, 100, 31);
+    Grafo *grafo = construirGrafo(lista);
+    BuscaAlcance reutilizada;
+    memset(&reutilizada, 0, sizeof(reutilizada));
+    prepararBuscaAlcance(&reutilizada, grafo);
+
+    Metros limites[] = {500 * METROS_POR_KM, 1000 * METROS_POR_KM, 2000 * METROS_POR_KM};
+    for (int l = 0; l < 3; l++)
+    {
+        unsigned int semente = 9;
+        long total = 0;
+        int divergencias = 0;
+
+        double inicio = agoraSegundos();
+        for (int i = 0; i < consultas; i++)
+        {
+            total += buscarAlcance(&reutilizada, rand_r(&semente) % grafo->quantidadeVertices, ALCANCE_DISTANCIA, limites[l]);
+        }
+        double tempoReutilizada = agoraSegundos() - inicio;
+
+        semente = 9;
+        inicio = agoraSegundos();
+        for (int i = 0; i < consultas; i++)
+        {
+            BuscaAlcance nova;
+            memset(&nova, 0, sizeof(nova));
+            prepararBuscaAlcance(&nova, grafo);
+            int origem = rand_r(&semente) % grafo->quantidadeVertices;
+            int quantidade = buscarAlcance(&nova, origem, ALCANCE_DISTANCIA, limites[l]);
+            if (i == consultas - 1)
+            {
+                divergencias += quantidade != buscarAlcance(&reutilizada, origem, ALCANCE_DISTANCIA, limites[l]);
+            }
+            liberarBuscaAlcance(&nova);
+        }
+        double tempoNova = agoraSegundos() - inicio;
+
+        printf("Até %6.0f km: %8.1f cidades, estado reutilizado %8.3f ms, estado novo %8.3f ms (%d divergências)\n",
+               metrosParaKm(limites[l]), (double)total / consultas, tempoReutilizada * 1e3 / consultas,
+               tempoNova * 1e3 / consultas, divergencias);
+    }
+
+    liberarBuscaAlcance(&reutilizada);
+    liberarGrafo(grafo);
+    liberarMemoria(lista);
+}
+
+static void benchmarkEspacial(int quantidadeCidades, int consultas)
+{
+    printf("\n=== Cidades mais próximas (%d cidades, %d pontos) ===\n", quantidadeCidades, consultas);
+
+    Rodovia *lista = gerarRede(quantidadeCidades, 100, 43);
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima)
+        {
+            c->latitude = -33000000 + (Micrograus)(c->hash % 28000000);
+            c->longitude = -73000000 + (Micrograus)(c->hash * 2654435761u % 39000000);
+        }
+    }
+
+    double inicio = agoraSegundos();
+    IndiceEspacial *indice = construirIndiceEspacial(lista);
+    printf("Índice construído em %.3f s (%d pontos)\n", agoraSegundos() - inicio, indice->quantidade);
+
+    unsigned int semente = 17;
+    Micrograus *latitudes = malloc(sizeof(Micrograus) * consultas);
+    Micrograus *longitudes = malloc(sizeof(Micrograus) * consultas);
+    VizinhoEspacial *vizinhos = malloc(sizeof(VizinhoEspacial) * consultas);
+    for (int i = 0; i < consultas; i++)
+    {
+        latitudes[i] = -33000000 + (Micrograus)(rand_r(&semente) % 28000000);
+        longitudes[i] = -73000000 + (Micrograus)(rand_r(&semente) % 39000000);
+    }
+
+    inicio = agoraSegundos();
+    for (int i = 0; i < consultas; i++)
+    {
+        vizinhosEspaciais(indice, latitudes[i], longitudes[i], INFINITY, &vizinhos[i], 1);
+    }
+    double tempoIndice = agoraSegundos() - inicio;
+
+    int amostras = consultas < 200 ? consultas : 200, divergencias = 0;
+    inicio = agoraSegundos();
+    for (int i = 0; i < amostras; i++)
+    {
+        double phi = micrograusParaGraus(latitudes[i]) * M_PI / 180;
+        double lambda = micrograusParaGraus(longitudes[i]) * M_PI / 180;
+        double alvo[3] = {cos(phi) * cos(lambda), cos(phi) * sin(lambda), sin(phi)};
+        double melhor = INFINITY;
+        for (int p = 0; p < indice->quantidade; p++)
+        {
+            double dx = alvo[0] - indice->pontos[p][0], dy = alvo[1] - indice->pontos[p][1];
+            double dz = alvo[2] - indice->pontos[p][2];
+            melhor = fmin(melhor, dx * dx + dy * dy + dz * dz);
+        }
+        divergencias += fabs(sqrt(melhor) - vizinhos[i].corda) > 1e-12;
+    }
+    double tempoLinear = (agoraSegundos() - inicio) / amostras * consultas;
+
+    printf("k-d tree:        %8.3f us/ponto\n", tempoIndice * 1e6 / consultas);
+    printf("busca linear:    %8.3f us/ponto (%.0fx, %d divergências em %d amostras)\n",
+           tempoLinear * 1e6 / consultas, tempoLinear / tempoIndice, divergencias, amostras);
+
+    free(latitudes);
+    free(longitudes);
+    free(vizinhos);
+    liberarIndiceEspacial(indice);
+    liberarMemoria(lista);
+}
+
+static void benchmarkMatriz(int quantidadeCidades, int lado)
+{
+    printf("\n=== Matriz de distâncias (%d cidades, %dx%d) ===\n", quantidadeCidades, lado, lado);
+
+    Rodovia *lista = gerarRede(quantidadeCidades, 100, 47);
+    Grafo *grafo = construirGrafo(lista);
+    int *origens = malloc(sizeof(int) * lado);
+    int *destinos = malloc(sizeof(int) * lado);
+    Metros *distancias = malloc(sizeof(Metros) * lado * lado);
+    Centavos *pedagios = malloc(sizeof(Centavos) * lado * lado);
+
+    unsigned int semente = 13;
+    for (int i = 0; i < lado; i++)
+    {
+        origens[i] = rand_r(&semente) % grafo->quantidadeVertices;
+        destinos[i] = rand_r(&semente) % grafo->quantidadeVertices;
+    }
+
+    int processadores = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    for (int threads = 1; threads <= processadores; threads *= 2)
+    {
+        double inicio = agoraSegundos();
+        calcularMatriz(grafo, origens, lado, destinos, lado, threads, distancias, pedagios);
+        printf("%2d thread(s): %8.3f s\n", threads, agoraSegundos() - inicio);
+    }
+
+    BuscaRotas busca;
+    iniciarBuscaRotas(&busca, grafo, LIMITE_ROTULOS_ROTAS);
+    int divergencias = 0;
+    double inicio = agoraSegundos();
+    for (int k = 0; k < 100; k++)
+    {
+        int i = rand_r(&semente) % lado, j = rand_r(&semente) % lado;
+        RotaAlternativa rota;
+        int encontrou = rotasPonderadas(&busca, origens[i], destinos[j], 1, 0, &rota, 1);
+        Metros esperado = encontrou ? rota.distancia : CUSTO_INFINITO;
+        divergencias += esperado != distancias[i * lado + j];
+    }
+    printf("Consulta par a par: %8.3f ms/célula (%d divergências em 100 células)\n",
+           (agoraSegundos() - inicio) * 1e3 / 100, divergencias);
+
+    liberarBuscaRotas(&busca);
+    free(origens);
+    free(destinos);
+    free(distancias);
+    free(pedagios);
+    liberarGrafo(grafo);
+    liberarMemoria(lista);
+}
+
+static void benchmarkPaginas(int quantidadeCidades, int consultas)
+{
+    printf("\n=== Rede paginada em disco (%d cidades, %d consultas) ===\n", quantidadeCidades, consultas);
+
+    char texto[] = "/tmp/benchmark_rodovias_paginas.txt";
+    char paginas[] = "/tmp/benchmark_rodovias.pag";
+    Rodovia *lista = gerarRede(quantidadeCidades, 100, 53);
+    imprimirRodoviasEmArquivo(lista, texto);
+
+    double inicio = agoraSegundos();
+    converterParaPaginas(texto, paginas, 256);
+    printf("Conversão com 256 quadros: %.3f s\n", agoraSegundos() - inicio);
+
+    int quadros[] = {64, 1024, 16384};
+    for (int k = 0; k < 3; k++)
+    {
+        RedePaginada rede;
+        if (!abrirRedePaginada(&rede, paginas, quadros[k]))
+        {
+            break;
+        }
+
+        int divergencias = 0;
+        uint32_t indice = 0;
+        for (Rodovia *r = lista; r != NULL; r = r->proxima, indice++)
+        {
+            RegistroRodovia registro;
+            Centavos total = 0;
+            for (int i = 0; i + 1 < r->numeroCidades; i++)
+            {
+                total += r->pedagiosIda[i];
+            }
+            divergencias += !lerRegistroRodovia(&rede, indice, &registro) ||
+                            registro.numeroCidades != (uint32_t)r->numeroCidades ||
+                            registro.pedagioTotal != total;
+        }
+        rede.cache.acertos = rede.cache.faltas = 0;
+
+        unsigned int semente = 17;
+        long encontradas = 0;
+        OcorrenciaCidade ocorrencias[MAXIMO_OCORRENCIAS_CIDADE];
+        inicio = agoraSegundos();
+        for (int c = 0; c < consultas; c++)
+        {
+            char nomeCidade[50];
+            snprintf(nomeCidade, sizeof(nomeCidade), "Cidade %d", (int)(rand_r(&semente) % (quantidadeCidades / 2 + 1)));
+            int quantidade = localizarCidadePaginada(&rede, nomeCidade, ocorrencias, MAXIMO_OCORRENCIAS_CIDADE);
+            for (int i = 0; i < quantidade; i++)
+            {
+                RegistroRodovia rodovia;
+                RegistroCidade primeira;
+                Centavos pedagio;
+                Metros distancia;
+                lerRegistroRodovia(&rede, ocorrencias[i].rodovia, &rodovia);
+                lerRegistroCidade(&rede, &rodovia, 0, &primeira);
+                somarTrechoPaginado(&rede, &rodovia, 0, ocorrencias[i].posicao, &pedagio, &distancia);
+                divergencias += distancia != ocorrencias[i].distancia - primeira.distancia;
+            }
+            encontradas += quantidade;
+        }
+        double tempo = agoraSegundos() - inicio;
+        long acessos = rede.cache.acertos + rede.cache.faltas;
+        printf("%6d quadros (%6.1f MiB): %8.3f ms/consulta, %5.1f%% acertos, %ld ocorrências, %d divergências\n",
+               quadros[k], quadros[k] * (double)TAMANHO_PAGINA / (1 << 20), tempo * 1e3 / consultas,
+               acessos > 0 ? 100.0 * rede.cache.acertos / acessos : 0, encontradas, divergencias);
+        fecharRedePaginada(&rede);
+    }
+
+    unlink(texto);
+    unlink(paginas);
+    liberarMemoria(lista);
+}
+
+static void benchmarkCompactado(int quantidadeCidades, int consultas)
+{
+    printf("\n=== Rede compactada (%d cidades, %d rodovias avulsas) ===\n", quantidadeCidades, consultas);
+
+    char texto[] = "/tmp/benchmark_rodovias_compactado.txt";
+    char compactado[] = "/tmp/benchmark_rodovias.rdz";
+    char original[] = "/tmp/benchmark_rodovias_original.txt";
+    char restaurado[] = "/tmp/benchmark_rodovias_restaurado.txt";
+    Rodovia *lista = gerarRede(quantidadeCidades, 100, 61);
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima)
+        {
+            if (c->hash % 2 == 0)
+            {
+                c->latitude = -33000000 + (Micrograus)(c->hash % 28000000);
+                c->longitude = -73000000 + (Micrograus)(c->hash / 7 % 39000000);
+            }
+        }
+        if (r->hash % 10 == 0 && r->numeroCidades > 1)
+        {
+            definirTarifaPedagio(r, r->cidades->nomeCidade, r->cidades->proxima->nomeCidade, 1, 6 * 60, 250);
+        }
+    }
+    imprimirRodoviasEmArquivo(lista, texto);
+
+    double inicio = agoraSegundos();
+    gravarRedeCompactada(lista, compactado);
+    printf("Compactação: %.3f s\n", agoraSegundos() - inicio);
+
+    struct stat estadoTexto, estadoCompactado;
+    if (stat(texto, &estadoTexto) == 0 && stat(compactado, &estadoCompactado) == 0)
+    {
+        printf("Texto: %.1f MiB, compactado: %.1f MiB (%.1fx menor)\n", estadoTexto.st_size / 1048576.0,
+               estadoCompactado.st_size / 1048576.0, (double)estadoTexto.st_size / estadoCompactado.st_size);
+    }
+
+    Rodovia *lida = NULL;
+    inicio = agoraSegundos();
+    carregarRodoviasDeArquivo(&lida, texto);
+    printf("Leitura do texto:       %8.3f s\n", agoraSegundos() - inicio);
+    liberarMemoria(lida);
+
+    int threads[] = {1, 4, (int)sysconf(_SC_NPROCESSORS_ONLN)};
+    for (int k = 0; k < 3; k++)
+    {
+        lida = NULL;
+        inicio = agoraSegundos();
+        int status = carregarRedeCompactada(&lida, compactado, threads[k]);
+        printf("Leitura com %2d thread(s): %8.3f s%s\n", threads[k], agoraSegundos() - inicio,
+               status == RODOVIAS_OK ? "" : " (FALHOU)");
+        if (k == 0)
+        {
+            imprimirRodoviasEmArquivo(lista, original);
+            imprimirRodoviasEmArquivo(lida, restaurado);
+            printf("Rede restaurada %s\n", arquivosIguais(original, restaurado) ? "idêntica" : "DIFERENTE");
+        }
+        liberarMemoria(lida);
+    }
+
+    unsigned int semente = 23;
+    int quantidadeRodovias = (quantidadeCidades + 99) / 100, divergencias = 0;
+    inicio = agoraSegundos();
+    for (int c = 0; c < consultas; c++)
+    {
+        char nomeRodovia[50];
+        snprintf(nomeRodovia, sizeof(nomeRodovia), "BR-%d", (int)(rand_r(&semente) % quantidadeRodovias));
+        Rodovia *rodovia = NULL;
+        divergencias += carregarRodoviaCompactada(compactado, nomeRodovia, &rodovia) != RODOVIAS_OK ||
+                        rodovia->numeroCidades != buscarRodovia(lista, nomeRodovia)->numeroCidades;
+        liberarMemoria(rodovia);
+    }
+    printf("Rodovia avulsa: %8.3f ms/consulta (%d divergências)\n", (agoraSegundos() - inicio) * 1e3 / consultas,
+           divergencias);
+
+    unlink(texto);
+    unlink(compactado);
+    unlink(original);
+    unlink(restaurado);
+    liberarMemoria(lista);
+}
+
+static double roteiroExato(Metros distancias[], int n, int ordem[], int usados, double custo, double melhor)
+{
+    if (custo >= melhor)
+    {
+        return melhor;
+    }
+    if (usados == n)
+    {
+        double total = custo + (double)distancias[ordem[n - 1] * n];
+        return total < melhor ? total : melhor;
+    }
+    for (int i = usados; i < n; i++)
+    {
+        int troca = ordem[usados];
+        ordem[usados] = ordem[i];
+        ordem[i] = troca;
+        double trecho = (double)distancias[ordem[usados - 1] * n + ordem[usados]];
+        melhor = roteiroExato(distancias, n, ordem, usados + 1, custo + trecho, melhor);
+        ordem[i] = ordem[usados];
+        ordem[usados] = troca;
+    }
+    return melhor;
+}
+
+static int sortearParadas(Grafo *grafo, int vertices[], int n, Metros distancias[], Centavos pedagios[],
+                          unsigned int *semente)
+{
+    for (int tentativa = 0; tentativa < 100; tentativa++)
+    {
+        vertices[0] = rand_r(semente) % grafo->quantidadeVertices;
+        for (int i = 1; i < n; i++)
+        {
+            vertices[i] = rand_r(semente) % grafo->quantidadeVertices;
+        }
+        calcularMatriz(grafo, vertices, n, vertices, n, 1, distancias, pedagios);
+        int alcancaveis = 1;
+        for (int i = 0; i < n * n; i++)
+        {
+            alcancaveis &= distancias[i] != CUSTO_INFINITO && (i / n == i % n || vertices[i / n] != vertices[i % n]);
+        }
+        if (alcancaveis)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void benchmarkRoteiro(int quantidadeCidades, int roteiros)
+{
+    printf("\n=== Roteiros de entrega (%d cidades, %d roteiros) ===\n", quantidadeCidades, roteiros);
+
+    Rodovia *lista = gerarRede(quantidadeCidades, 100, 67);
+    conectarRodovias(lista);
+    Grafo *grafo = construirGrafo(lista);
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int tamanhos[] = {9, 30, 50};
+    unsigned int semente = 29;
+
+    for (int k = 0; k < 3; k++)
+    {
+        int n = tamanhos[k], vertices[64], ordem[64];
+        Metros *distancias = malloc(sizeof(Metros) * n * n);
+        Centavos *pedagios = malloc(sizeof(Centavos) * n * n);
+        double somaInicial = 0, somaFinal = 0, somaExata = 0, tempo = 0;
+        long tentativas = 0;
+        int resolvidos = 0, acima = 0;
+        for (int r = 0; r < roteiros && sortearParadas(grafo, vertices, n, distancias, pedagios, &semente); r++)
+        {
+            long tentativasRoteiro;
+            double inicial, inicio = agoraSegundos();
+            Metros final = 0;
+            otimizarRoteiro(distancias, n, threads, 0.1, ordem, &tentativasRoteiro, &inicial);
+            tempo += agoraSegundos() - inicio;
+            for (int i = 0; i < n; i++)
+            {
+                final += distancias[ordem[i] * n + ordem[(i + 1) % n]];
+            }
+            if (n <= 10)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    ordem[i] = i;
+                }
+                double exato = roteiroExato(distancias, n, ordem, 1, 0, INFINITY);
+                somaExata += metrosParaKm((Metros)exato);
+                acima += final > exato * 1.0001;
+            }
+            somaInicial += inicial;
+            somaFinal += metrosParaKm(final);
+            tentativas += tentativasRoteiro;
+            resolvidos++;
+        }
+        if (resolvidos == 0)
+        {
+            printf("%2d paradas: nenhum roteiro com todas as cidades alcançáveis\n", n);
+        }
+        else if (n <= 10)
+        {
+            printf("%2d paradas: %8.1f ms/roteiro, %7ld tentativas, %.2f%% acima do ótimo, %d de %d acima\n", n,
+                   tempo * 1e3 / resolvidos, tentativas / resolvidos, 100 * (somaFinal / somaExata - 1), acima,
+                   resolvidos);
+        }
+        else
+        {
+            printf("%2d paradas: %8.1f ms/roteiro, %7ld tentativas, %.1f%% menor que o vizinho mais próximo\n", n,
+                   tempo * 1e3 / resolvidos, tentativas / resolvidos, 100 * (1 - somaFinal / somaInicial));
+        }
+        free(distancias);
+        free(pedagios);
+    }
+
+    liberarGrafo(grafo);
+    liberarMemoria(lista);
+}
+
+static int sortearTrecho(Rodovia *rodovias[], int quantidadeRodovias, InfoAtualizacaoTrecho *atualizacao,
+                         unsigned int *semente)
+{
+    Rodovia *r = rodovias[rand_r(semente) % quantidadeRodovias];
+    if (r->numeroCidades < 2)
+    {
+        return 0;
+    }
+    Cidade *c = r->cidades;
+    for (int i = rand_r(semente) % (r->numeroCidades - 1); i > 0; i--)
+    {
+        c = c->proxima;
+    }
+    if (buscarCidade(r, c->nomeCidade) != c || buscarCidade(r, c->proxima->nomeCidade) != c->proxima)
+    {
+        return 0;
+    }
+    strcpy(atualizacao->rodovia, r->nome);
+    strcpy(atualizacao->cidade1, c->nomeCidade);
+    strcpy(atualizacao->cidade2, c->proxima->nomeCidade);
+    Metros comprimento = c->proxima->distancia - c->distancia;
+    atualizacao->distancia = rand_r(semente) % 2 ? metrosParaKm(comprimento) * 1.5 : -1;
+    atualizacao->pedagio = centavosParaReais(pedagioTrecho(r, c->indice, 1)) + 1 + rand_r(semente) % 10;
+    return 1;
+}
+
+static int consultarRotasBenchmark(RedeRodovias *rede, char (*pares)[2][50], int consultas, InfoRotas *resultado,
+                                   Grafo *conferencia, long *divergencias)
+{
+    int encontradas = 0;
+    RotaAlternativa rotas[MAXIMO_ROTAS_ALTERNATIVAS];
+    BuscaRotas busca;
+    if (conferencia != NULL)
+    {
+        iniciarBuscaRotas(&busca, conferencia, LIMITE_ROTULOS_ROTAS);
+    }
+    for (int i = 0; i < consultas; i++)
+    {
+        int status = rotasAlternativasRede(rede, pares[i][0], pares[i][1], ROTA_PARETO, 0, 0, resultado);
+        encontradas += status == RODOVIAS_OK;
+        if (conferencia == NULL)
+        {
+            continue;
+        }
+        int inicio = buscarVertice(conferencia, pares[i][0]), fim = buscarVertice(conferencia, pares[i][1]);
+        int quantidade = inicio < 0 || fim < 0 ? 0 : rotasPareto(&busca, inicio, fim, rotas, MAXIMO_ROTAS_ALTERNATIVAS);
+        int diferente = quantidade != (status == RODOVIAS_OK ? resultado->quantidade : 0);
+        for (int j = 0; !diferente && j < quantidade; j++)
+        {
+            diferente = rotas[j].distancia != kmParaMetros(resultado->rotas[j].distancia) ||
+                        rotas[j].pedagio != reaisParaCentavos(resultado->rotas[j].pedagio);
+        }
+        *divergencias += diferente;
+    }
+    if (conferencia != NULL)
+    {
+        liberarBuscaRotas(&busca);
+    }
+    return encontradas;
+}
+
+static int aplicarAtualizacoes(RedeRodovias *rede, Rodovia *rodovias[], int quantidadeRodovias,
+                               InfoAtualizacaoTrecho lote[], int atualizacoes, unsigned int *semente, double *tempo)
+{
+    int aplicadas = 0;
+    while (aplicadas < atualizacoes)
+    {
+        int quantidade = 0, aplicadasLote;
+        while (quantidade < 100 && aplicadas + quantidade < atualizacoes)
+        {
+            quantidade += sortearTrecho(rodovias, quantidadeRodovias, &lote[quantidade], semente);
+        }
+        double inicio = agoraSegundos();
+        int status = atualizarTrechosRede(rede, lote, quantidade, &aplicadasLote);
+        *tempo += agoraSegundos() - inicio;
+        aplicadas += aplicadasLote;
+        if (status != RODOVIAS_OK)
+        {
+            printf("Erro ao atualizar trechos: %s\n", descreverStatusRodovias(status));
+            break;
+        }
+    }
+    return aplicadas;
+}
+
+typedef struct CompactadorBenchmark
+{
+    RedeRodovias *rede;
+    int encerrar;
+    long falhas;
+} CompactadorBenchmark;
+
+static void *compactarBenchmark(void *argumento)
+{
+    CompactadorBenchmark *compactador = argumento;
+    while (!__atomic_load_n(&compactador->encerrar, __ATOMIC_ACQUIRE))
+    {
+        compactador->falhas += compactarRede(compactador->rede) != RODOVIAS_OK;
+        sched_yield();
+    }
+    return NULL;
+}
+
+static void benchmarkAtualizacoes(int quantidadeCidades, int consultas, int atualizacoes)
+{
+    printf("\n=== Atualizações de pesos em fluxo (%d cidades, %d consultas, %d atualizações) ===\n",
+           quantidadeCidades, consultas, atualizacoes);
+
+    RedeRodovias *rede = criarRede();
+    InfoRotas *resultado = malloc(sizeof(InfoRotas));
+    char(*pares)[2][50] = malloc(sizeof(*pares) * consultas);
+    InfoAtualizacaoTrecho *lote = malloc(sizeof(InfoAtualizacaoTrecho) * 100);
+    rede->lista = gerarRede(quantidadeCidades, 100, 71);
+    int quantidadeRodovias = 0;
+    for (Rodovia *r = rede->lista; r != NULL; r = r->proxima)
+    {
+        quantidadeRodovias++;
+    }
+    Rodovia **rodovias = malloc(sizeof(Rodovia *) * quantidadeRodovias);
+    quantidadeRodovias = 0;
+    for (Rodovia *r = rede->lista; r != NULL; r = r->proxima)
+    {
+        rodovias[quantidadeRodovias++] = r;
+    }
+
+    double inicio = agoraSegundos();
+    Grafo *grafo = construirGrafo(rede->lista);
+    double tempoGrafo = agoraSegundos() - inicio;
+    unsigned int semente = 37;
+    for (int i = 0; i < consultas; i++)
+    {
+        strcpy(pares[i][0], grafo->nomes[rand_r(&semente) % grafo->quantidadeVertices]);
+        strcpy(pares[i][1], grafo->nomes[rand_r(&semente) % grafo->quantidadeVertices]);
+    }
+    liberarGrafo(grafo);
+
+    long divergencias = 0;
+    inicio = agoraSegundos();
+    int encontradas = consultarRotasBenchmark(rede, pares, consultas, resultado, NULL, &divergencias);
+    double tempoFrio = agoraSegundos() - inicio;
+    inicio = agoraSegundos();
+    consultarRotasBenchmark(rede, pares, consultas, resultado, NULL, &divergencias);
+    double tempoQuente = agoraSegundos() - inicio;
+    printf("Consultas sem cache: %8.3f ms/consulta (%d com rota), repetidas: %8.3f ms/consulta\n",
+           tempoFrio * 1e3 / consultas, encontradas, tempoQuente * 1e3 / consultas);
+
+    double tempoAtualizacoes = 0;
+    int aplicadas = aplicarAtualizacoes(rede, rodovias, quantidadeRodovias, lote, atualizacoes, &semente,
+                                        &tempoAtualizacoes);
+    printf("Atualizações no lugar: %.0f trecho(s)/s (reconstrução completa do grafo: %.3f s)\n",
+           aplicadas / tempoAtualizacoes, tempoGrafo);
+
+    consultarRotasBenchmark(rede, pares, consultas, resultado, NULL, &divergencias);
+    aplicadas = aplicarAtualizacoes(rede, rodovias, quantidadeRodovias, lote, 20, &semente, &tempoAtualizacoes);
+    long acertos = rede->cacheRotas.acertos, invalidadas = rede->cacheRotas.invalidadas;
+    grafo = construirGrafo(rede->lista);
+    inicio = agoraSegundos();
+    consultarRotasBenchmark(rede, pares, consultas, resultado, grafo, &divergencias);
+    double tempoAtualizado = agoraSegundos() - inicio;
+    printf("Após mais %d atualização(ões): %ld consulta(s) ainda em cache, %ld invalidada(s), %ld divergência(s) "
+           "em relação a um grafo novo (%.3f ms/consulta com a conferência)\n",
+           aplicadas, rede->cacheRotas.acertos - acertos, rede->cacheRotas.invalidadas - invalidadas, divergencias,
+           tempoAtualizado * 1e3 / consultas);
+    liberarGrafo(grafo);
+
+    int removiveis = quantidadeRodovias / 4 < 50 ? quantidadeRodovias / 4 : 50;
+    int mantidas = quantidadeRodovias - removiveis;
+    long compactacoes = rede->compactacoes, divergenciasCompactacao = 0;
+    CompactadorBenchmark compactador = {rede, 0, 0};
+    pthread_t thread;
+    int iniciado = pthread_create(&thread, NULL, compactarBenchmark, &compactador) == 0;
+    aplicadas = 0;
+    for (int i = 0; i < removiveis; i++)
+    {
+        consultarRotasBenchmark(rede, pares, 1, resultado, NULL, &divergenciasCompactacao);
+        removerRodoviaRede(rede, rodovias[mantidas + i]->nome);
+        aplicadas += aplicarAtualizacoes(rede, rodovias, mantidas, lote, 20, &semente, &tempoAtualizacoes);
+    }
+    __atomic_store_n(&compactador.encerrar, 1, __ATOMIC_RELEASE);
+    if (iniciado)
+    {
+        pthread_join(thread, NULL);
+    }
+    grafo = construirGrafo(rede->lista);
+    consultarRotasBenchmark(rede, pares, consultas, resultado, grafo, &divergenciasCompactacao);
+    printf("Durante compactações concorrentes: %d remoção(ões), %d atualização(ões), %ld compactação(ões), "
+           "%ld divergência(s) em relação a um grafo novo\n",
+           removiveis, aplicadas, rede->compactacoes - compactacoes, divergenciasCompactacao + compactador.falhas);
+
+    liberarGrafo(grafo);
+    free(rodovias);
+    free(lote);
+    free(pares);
+    free(resultado);
+    destruirRede(rede);
+}
+
+static void benchmarkRemocoes(int quantidadeCidades, int consultas, int remocoes)
+{
+    printf("\n=== Remoções com lápides (%d cidades, %d consultas, %d remoções) ===\n", quantidadeCidades, consultas,
+           remocoes);
+
+    RedeRodovias *rede = criarRede();
+    InfoRotas *resultado = malloc(sizeof(InfoRotas));
+    char(*pares)[2][50] = malloc(sizeof(*pares) * consultas);
+    rede->lista = gerarRede(quantidadeCidades, 20, 83);
+    int quantidadeRodovias = 0;
+    for (Rodovia *r = rede->lista; r != NULL; r = r->proxima)
+    {
+        quantidadeRodovias++;
+    }
+    char(*nomes)[50] = malloc(sizeof(*nomes) * quantidadeRodovias);
+    quantidadeRodovias = 0;
+    for (Rodovia *r = rede->lista; r != NULL; r = r->proxima)
+    {
+        strcpy(nomes[quantidadeRodovias++], r->nome);
+    }
+
+    double inicio = agoraSegundos();
+    Grafo *grafo = construirGrafo(rede->lista);
+    double tempoGrafo = agoraSegundos() - inicio;
+    unsigned int semente = 53;
+    for (int i = 0; i < consultas; i++)
+    {
+        strcpy(pares[i][0], grafo->nomes[rand_r(&semente) % grafo->quantidadeVertices]);
+        strcpy(pares[i][1], grafo->nomes[rand_r(&semente) % grafo->quantidadeVertices]);
+    }
+    liberarGrafo(grafo);
+
+    long divergencias = 0;
+    consultarRotasBenchmark(rede, pares, consultas, resultado, NULL, &divergencias);
+
+    double tempoRemocoes = 0, tempoConsultas = 0;
+    int removidas = 0, consultadas = 0, metade = quantidadeRodovias / 2;
+    for (int n = 0; n < remocoes; n++)
+    {
+        int status;
+        if (n % 4 == 0 && n / 4 < metade)
+        {
+            inicio = agoraSegundos();
+            status = removerRodoviaRede(rede, nomes[n / 4]);
+        }
+        else
+        {
+            Rodovia *r = buscarRodovia(rede->lista, nomes[metade + rand_r(&semente) % (quantidadeRodovias - metade)]);
+            Cidade *c = r != NULL ? r->cidades : NULL;
+            for (int i = c != NULL ? rand_r(&semente) % r->numeroCidades : 0; c != NULL && i > 0; i--)
+            {
+                c = c->proxima;
+            }
+            if (c == NULL)
+            {
+                continue;
+            }
+            char cidade[50];
+            strcpy(cidade, c->nomeCidade);
+            inicio = agoraSegundos();
+            status = removerCidadeRede(rede, r->nome, cidade);
+        }
+        tempoRemocoes += agoraSegundos() - inicio;
+        removidas += status == RODOVIAS_OK;
+        if (n % 10 == 9)
+        {
+            inicio = agoraSegundos();
+            consultarRotasBenchmark(rede, pares + consultadas % consultas, 1, resultado, NULL, &divergencias);
+            tempoConsultas += agoraSegundos() - inicio;
+            consultadas++;
+        }
+    }
+    printf("Remoções: %.0f/s (%d aplicada(s)); consultas intercaladas: %.3f ms/consulta (reconstrução completa "
+           "do grafo: %.3f s)\n",
+           removidas / tempoRemocoes, removidas, tempoConsultas * 1e3 / (consultadas > 0 ? consultadas : 1),
+           tempoGrafo);
+
+    int lapides = rede->lapides;
+    inicio = agoraSegundos();
+    int status = compactarRede(rede);
+    double tempoCompactacao = agoraSegundos() - inicio;
+    printf("Compactação: %s em %.3f s (%d lápide(s) pendente(s), %ld compactação(ões) no total)\n",
+           descreverStatusRodovias(status), tempoCompactacao, lapides, rede->compactacoes);
+
+    grafo = construirGrafo(rede->lista);
+    inicio = agoraSegundos();
+    int encontradas = consultarRotasBenchmark(rede, pares, consultas, resultado, grafo, &divergencias);
+    printf("Após a compactação: %.3f ms/consulta (%d com rota), %ld divergência(s) em relação a um grafo novo\n",
+           (agoraSegundos() - inicio) * 1e3 / consultas, encontradas, divergencias);
+
+    liberarGrafo(grafo);
+    free(nomes);
+    free(pares);
+    free(resultado);
+    destruirRede(rede);
+}
+
+int main(int argc, char *argv[])
+{
+    int quantidade = argc > 1 ? atoi(argv[1]) : 100000;
+    int quantidadeCidades = argc > 2 ? atoi(argv[2]) : 1000000;
+    if (quantidade <= 0 || quantidadeCidades <= 0)
+    {
+        printf("Uso: %s [nomes] [cidades]\n", argv[0]);
+        return 1;
+    }
+
+    benchmarkNomes(quantidade, 20);
+    benchmarkSaida(quantidadeCidades);
+    benchmarkRotas(quantidadeCidades / 10, 200);
+    benchmarkAlcance(quantidadeCidades / 10, 200);
+    benchmarkMatriz(quantidadeCidades / 10, 200);
+    benchmarkEspacial(quantidadeCidades / 10, 100000);
+    benchmarkPaginas(quantidadeCidades, 2000);
+    benchmarkCompactado(quantidadeCidades, 2000);
+    benchmarkRoteiro(quantidadeCidades / 10, 20);
+    benchmarkAtualizacoes(quantidadeCidades / 10, 500, 20000);
+    benchmarkRemocoes(quantidadeCidades / 10, 500, 2000);
+    return 0;
+}
@@ -0,0 +1,1044 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "estruturas.h"
+
+typedef struct BufferCompactado
+{
+    unsigned char *dados;
+    size_t usado;
+    size_t capacidade;
+    int erro;
+} BufferCompactado;
+
+typedef struct LeitorCompactado
+{
+    const unsigned char *dados;
+    size_t tamanho;
+    size_t posicao;
+    int erro;
+} LeitorCompactado;
+
+typedef struct ValorCompactado
+{
+    Centavos valor;
+    int frequencia;
+    int indice;
+} ValorCompactado;
+
+typedef struct DicionarioCompactado
+{
+    const char **nomes;
+    int quantidadeNomes;
+    ValorCompactado *valores;
+    int quantidadeValores;
+} DicionarioCompactado;
+
+typedef struct DescompactacaoRede
+{
+    const unsigned char *dados;
+    BlocoCompactado *blocos;
+    int quantidadeBlocos;
+    Rodovia **primeiras;
+    Rodovia **ultimas;
+    int proximoBloco;
+    int falhas;
+} DescompactacaoRede;
+
+static double agoraSegundos(void)
+{
+    struct timespec instante;
+    clock_gettime(CLOCK_MONOTONIC, &instante);
+    return instante.tv_sec + instante.tv_nsec / 1e9;
+}
+
+static uint32_t verificarBloco(const unsigned char *dados, size_t tamanho)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < tamanho; i++)
+    {
+        hash = (hash ^ dados[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void escreverBytes(BufferCompactado *buffer, const void *dados, size_t tamanho)
+{
+    if (buffer->usado + tamanho > buffer->capacidade)
+    {
+        size_t capacidade = buffer->capacidade > 0 ? buffer->capacidade : 65536;
+        while (capacidade < buffer->usado + tamanho)
+        {
+            capacidade *= 2;
+        }
+        unsigned char *dadosNovos = realloc(buffer->dados, capacidade);
+        if (dadosNovos == NULL)
+        {
+            buffer->erro = 1;
+            return;
+        }
+        buffer->dados = dadosNovos;
+        buffer->capacidade = capacidade;
+    }
+    memcpy(buffer->dados + buffer->usado, dados, tamanho);
+    buffer->usado += tamanho;
+}
+
+static void escreverVarint(BufferCompactado *buffer, uint64_t valor)
+{
+    unsigned char bytes[10];
+    int tamanho = 0;
+    while (valor >= 0x80)
+    {
+        bytes[tamanho++] = (unsigned char)(valor | 0x80);
+        valor >>= 7;
+    }
+    bytes[tamanho++] = (unsigned char)valor;
+    escreverBytes(buffer, bytes, tamanho);
+}
+
+static void escreverSinal(BufferCompactado *buffer, int64_t valor)
+{
+    escreverVarint(buffer, ((uint64_t)valor << 1) ^ (uint64_t)(valor >> 63));
+}
+
+static uint64_t lerVarint(LeitorCompactado *leitor)
+{
+    uint64_t valor = 0;
+    for (int deslocamento = 0; deslocamento < 64; deslocamento += 7)
+    {
+        if (leitor->posicao >= leitor->tamanho)
+        {
+            break;
+        }
+        unsigned char byte = leitor->dados[leitor->posicao++];
+        valor |= (uint64_t)(byte & 0x7f) << deslocamento;
+        if (!(byte & 0x80))
+        {
+            return valor;
+        }
+    }
+    leitor->erro = 1;
+    return 0;
+}
+
+static int64_t lerSinal(LeitorCompactado *leitor)
+{
+    uint64_t valor = lerVarint(leitor);
+    return (int64_t)(valor >> 1) ^ -(int64_t)(valor & 1);
+}
+
+static uint64_t lerLimitado(LeitorCompactado *leitor, uint64_t limite)
+{
+    uint64_t valor = lerVarint(leitor);
+    if (valor >= limite)
+    {
+        leitor->erro = 1;
+        return 0;
+    }
+    return valor;
+}
+
+static const char *lerTextoCompactado(LeitorCompactado *leitor, size_t tamanho)
+{
+    if (tamanho > leitor->tamanho - leitor->posicao ||
+        memchr(leitor->dados + leitor->posicao, '\0', tamanho) != NULL)
+    {
+        leitor->erro = 1;
+        return NULL;
+    }
+    const char *texto = (const char *)leitor->dados + leitor->posicao;
+    leitor->posicao += tamanho;
+    return texto;
+}
+
+static int compararNomesCompactados(const void *a, const void *b)
+{
+    return strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+static int compararValoresCompactados(const void *a, const void *b)
+{
+    Centavos x = ((const ValorCompactado *)a)->valor, y = ((const ValorCompactado *)b)->valor;
+    return (x > y) - (x < y);
+}
+
+static int compararFrequencias(const void *a, const void *b)
+{
+    const ValorCompactado *x = a, *y = b;
+    if (x->frequencia != y->frequencia)
+    {
+        return y->frequencia - x->frequencia;
+    }
+    return (x->valor > y->valor) - (x->valor < y->valor);
+}
+
+static int indiceNome(DicionarioCompactado *dicionario, const char *nome)
+{
+    const char **encontrado = bsearch(&nome, dicionario->nomes, dicionario->quantidadeNomes, sizeof(const char *),
+                                      compararNomesCompactados);
+    return (int)(encontrado - dicionario->nomes);
+}
+
+static int indiceValor(DicionarioCompactado *dicionario, Centavos valor)
+{
+    ValorCompactado chave = {valor, 0, 0};
+    ValorCompactado *encontrado = bsearch(&chave, dicionario->valores, dicionario->quantidadeValores,
+                                          sizeof(ValorCompactado), compararValoresCompactados);
+    return encontrado->indice;
+}
+
+static int montarDicionario(DicionarioCompactado *dicionario, Rodovia *rodovias[], int quantidade)
+{
+    int cidades = 0, faixas = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        cidades += rodovias[i]->numeroCidades;
+        for (int t = 0; rodovias[i]->tarifas != NULL && t + 1 < rodovias[i]->numeroCidades; t++)
+        {
+            faixas += rodovias[i]->tarifas[t].quantidade;
+        }
+    }
+
+    dicionario->nomes = malloc(sizeof(const char *) * (cidades + 1));
+    dicionario->valores = malloc(sizeof(ValorCompactado) * (2 * cidades + faixas + 1));
+    if (dicionario->nomes == NULL || dicionario->valores == NULL)
+    {
+        return 0;
+    }
+
+    int nomes = 0, valores = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        Rodovia *rodovia = rodovias[i];
+        for (Cidade *cidade = rodovia->cidades; cidade != NULL; cidade = cidade->proxima)
+        {
+            dicionario->nomes[nomes++] = cidade->nomeCidade;
+            if (cidade->proxima == NULL)
+            {
+                continue;
+            }
+            dicionario->valores[valores++].valor = rodovia->pedagiosIda[cidade->indice];
+            dicionario->valores[valores++].valor = rodovia->pedagiosVolta[cidade->indice];
+            for (int f = 0; rodovia->tarifas != NULL && f < rodovia->tarifas[cidade->indice].quantidade; f++)
+            {
+                dicionario->valores[valores++].valor = rodovia->tarifas[cidade->indice].faixas[f].valor;
+            }
+        }
+    }
+
+    qsort(dicionario->nomes, nomes, sizeof(const char *), compararNomesCompactados);
+    int unicos = 0;
+    for (int i = 0; i < nomes; i++)
+    {
+        if (unicos == 0 || strcmp(dicionario->nomes[unicos - 1], dicionario->nomes[i]) != 0)
+        {
+            dicionario->nomes[unicos++] = dicionario->nomes[i];
+        }
+    }
+    dicionario->quantidadeNomes = unicos;
+
+    qsort(dicionario->valores, valores, sizeof(ValorCompactado), compararValoresCompactados);
+    unicos = 0;
+    for (int i = 0; i < valores; i++)
+    {
+        if (unicos > 0 && dicionario->valores[unicos - 1].valor == dicionario->valores[i].valor)
+        {
+            dicionario->valores[unicos - 1].frequencia++;
+        }
+        else
+        {
+            dicionario->valores[unicos].valor = dicionario->valores[i].valor;
+            dicionario->valores[unicos++].frequencia = 1;
+        }
+    }
+    dicionario->quantidadeValores = unicos;
+
+    qsort(dicionario->valores, unicos, sizeof(ValorCompactado), compararFrequencias);
+    for (int i = 0; i < unicos; i++)
+    {
+        dicionario->valores[i].indice = i;
+    }
+    return 1;
+}
+
+static void codificarDicionario(BufferCompactado *buffer, DicionarioCompactado *dicionario)
+{
+    escreverVarint(buffer, dicionario->quantidadeNomes);
+    const char *anterior = "";
+    for (int i = 0; i < dicionario->quantidadeNomes; i++)
+    {
+        const char *nome = dicionario->nomes[i];
+        size_t comum = 0;
+        while (nome[comum] != '\0' && nome[comum] == anterior[comum])
+        {
+            comum++;
+        }
+        size_t resto = strlen(nome + comum);
+        escreverVarint(buffer, comum);
+        escreverVarint(buffer, resto);
+        escreverBytes(buffer, nome + comum, resto);
+        anterior = nome;
+    }
+
+    escreverVarint(buffer, dicionario->quantidadeValores);
+    for (int i = 0; i < dicionario->quantidadeValores; i++)
+    {
+        escreverSinal(buffer, dicionario->valores[i].valor);
+    }
+    qsort(dicionario->valores, dicionario->quantidadeValores, sizeof(ValorCompactado), compararValoresCompactados);
+}
+
+static void codificarRodovia(BufferCompactado *buffer, DicionarioCompactado *dicionario, Rodovia *rodovia)
+{
+    size_t tamanhoNome = strlen(rodovia->nome);
+    escreverVarint(buffer, tamanhoNome);
+    escreverBytes(buffer, rodovia->nome, tamanhoNome);
+    escreverSinal(buffer, rodovia->pedagio);
+    escreverVarint(buffer, rodovia->numeroCidades);
+    escreverVarint(buffer, rodovia->tarifas != NULL);
+
+    Metros distanciaAnterior = 0;
+    Micrograus latitudeAnterior = 0, longitudeAnterior = 0;
+    for (Cidade *cidade = rodovia->cidades; cidade != NULL; cidade = cidade->proxima)
+    {
+        int temCoordenadas = cidade->latitude != COORDENADA_INDEFINIDA;
+        escreverVarint(buffer, (uint64_t)indiceNome(dicionario, cidade->nomeCidade) << 1 | temCoordenadas);
+        if (cidade->anterior == NULL)
+        {
+            escreverSinal(buffer, cidade->distancia);
+        }
+        else if (cidade->distancia >= distanciaAnterior)
+        {
+            escreverVarint(buffer, (uint64_t)(cidade->distancia - distanciaAnterior));
+        }
+        else
+        {
+            buffer->erro = 1;
+        }
+        distanciaAnterior = cidade->distancia;
+
+        if (temCoordenadas)
+        {
+            escreverSinal(buffer, (int64_t)cidade->latitude - latitudeAnterior);
+            escreverSinal(buffer, (int64_t)cidade->longitude - longitudeAnterior);
+            latitudeAnterior = cidade->latitude;
+            longitudeAnterior = cidade->longitude;
+        }
+    }
+
+    for (int i = 0; i + 1 < rodovia->numeroCidades; i++)
+    {
+        escreverVarint(buffer, indiceValor(dicionario, rodovia->pedagiosIda[i]));
+        escreverVarint(buffer, indiceValor(dicionario, rodovia->pedagiosVolta[i]));
+    }
+    for (int i = 0; rodovia->tarifas != NULL && i + 1 < rodovia->numeroCidades; i++)
+    {
+        TabelaTarifas *tabela = &rodovia->tarifas[i];
+        escreverVarint(buffer, tabela->quantidade);
+        for (int f = 0; f < tabela->quantidade; f++)
+        {
+            escreverVarint(buffer, tabela->faixas[f].classe);
+            escreverVarint(buffer, tabela->faixas[f].inicio);
+            escreverVarint(buffer, indiceValor(dicionario, tabela->faixas[f].valor));
+        }
+    }
+}
+
+static int codificarBloco(BufferCompactado *buffer, Rodovia *rodovias[], int quantidade)
+{
+    DicionarioCompactado dicionario;
+    memset(&dicionario, 0, sizeof(dicionario));
+    buffer->usado = 0;
+    if (!montarDicionario(&dicionario, rodovias, quantidade))
+    {
+        buffer->erro = 1;
+    }
+    else
+    {
+        codificarDicionario(buffer, &dicionario);
+        for (int i = 0; i < quantidade; i++)
+        {
+            codificarRodovia(buffer, &dicionario, rodovias[i]);
+        }
+    }
+    free(dicionario.nomes);
+    free(dicionario.valores);
+    return !buffer->erro;
+}
+
+int gravarRedeCompactada(Rodovia *lista, char nomeArquivo[])
+{
+    uint32_t quantidadeRodovias = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        quantidadeRodovias++;
+    }
+
+    Rodovia **rodovias = malloc(sizeof(Rodovia *) * (quantidadeRodovias + 1));
+    BlocoCompactado *blocos = malloc(sizeof(BlocoCompactado) * (quantidadeRodovias + 1));
+    EntradaRodoviaCompactada *entradas = malloc(sizeof(EntradaRodoviaCompactada) * (quantidadeRodovias + 1));
+    if (rodovias == NULL || blocos == NULL || entradas == NULL)
+    {
+        free(rodovias);
+        free(blocos);
+        free(entradas);
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+    quantidadeRodovias = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        rodovias[quantidadeRodovias++] = r;
+    }
+
+    char temporario[300];
+    int descritor = -1;
+    if (snprintf(temporario, sizeof(temporario), "%s.tmp", nomeArquivo) < (int)sizeof(temporario))
+    {
+        descritor = open(temporario, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if (descritor < 0)
+    {
+        free(rodovias);
+        free(blocos);
+        free(entradas);
+        return RODOVIAS_ERRO_ARQUIVO;
+    }
+
+    CabecalhoRedeCompactada cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.assinatura, ASSINATURA_REDE_COMPACTADA, sizeof(cabecalho.assinatura));
+    cabecalho.quantidadeRodovias = quantidadeRodovias;
+
+    BufferSaida saida;
+    iniciarBufferSaida(&saida, descritor);
+    saidaBytes(&saida, (const char *)&cabecalho, sizeof(cabecalho));
+    uint64_t posicao = sizeof(cabecalho);
+
+    BufferCompactado buffer;
+    memset(&buffer, 0, sizeof(buffer));
+    int status = RODOVIAS_OK;
+    for (uint32_t inicio = 0; inicio < quantidadeRodovias && status == RODOVIAS_OK;)
+    {
+        uint32_t fim = inicio;
+        int cidades = 0;
+        while (fim < quantidadeRodovias && (fim == inicio || cidades < CIDADES_POR_BLOCO_COMPACTADO))
+        {
+            cidades += rodovias[fim++]->numeroCidades;
+        }
+
+        if (!codificarBloco(&buffer, &rodovias[inicio], fim - inicio) || buffer.usado > UINT32_MAX)
+        {
+            status = RODOVIAS_ERRO_MEMORIA;
+            break;
+        }
+        BlocoCompactado *bloco = &blocos[cabecalho.quantidadeBlocos];
+        bloco->posicao = posicao;
+        bloco->tamanho = (uint32_t)buffer.usado;
+        bloco->verificacao = verificarBloco(buffer.dados, buffer.usado);
+        bloco->primeiraRodovia = inicio;
+        bloco->quantidadeRodovias = fim - inicio;
+        for (uint32_t i = inicio; i < fim; i++)
+        {
+            entradas[i].hash = rodovias[i]->hash;
+            entradas[i].bloco = cabecalho.quantidadeBlocos;
+        }
+        saidaBytes(&saida, (const char *)buffer.dados, buffer.usado);
+        posicao += buffer.usado;
+        cabecalho.quantidadeCidades += cidades;
+        cabecalho.quantidadeBlocos++;
+        inicio = fim;
+    }
+
+    cabecalho.posicaoDiretorio = posicao;
+    saidaBytes(&saida, (const char *)blocos, sizeof(BlocoCompactado) * cabecalho.quantidadeBlocos);
+    saidaBytes(&saida, (const char *)entradas, sizeof(EntradaRodoviaCompactada) * quantidadeRodovias);
+    if (finalizarBufferSaida(&saida) != 0 ||
+        pwrite(descritor, &cabecalho, sizeof(cabecalho), 0) != (ssize_t)sizeof(cabecalho) || fsync(descritor) != 0)
+    {
+        status = status == RODOVIAS_OK ? RODOVIAS_ERRO_ARQUIVO : status;
+    }
+    if (close(descritor) != 0 && status == RODOVIAS_OK)
+    {
+        status = RODOVIAS_ERRO_ARQUIVO;
+    }
+    if (status != RODOVIAS_OK)
+    {
+        unlink(temporario);
+    }
+    else if (rename(temporario, nomeArquivo) != 0 || sincronizarDiretorio(nomeArquivo) != 0)
+    {
+        unlink(temporario);
+        status = RODOVIAS_ERRO_ARQUIVO;
+    }
+
+    free(buffer.dados);
+    free(rodovias);
+    free(blocos);
+    free(entradas);
+    return status;
+}
+
+static Cidade *anexarCidade(Rodovia *rodovia, Cidade *ultima, char nome[], char chave[], unsigned int hash,
+                            Metros distancia)
+{
+    Cidade *cidade = malloc(sizeof(Cidade));
+    if (cidade == NULL)
+    {
+        return NULL;
+    }
+    strcpy(cidade->nomeCidade, nome);
+    memcpy(cidade->chave, chave, TAMANHO_CHAVE);
+    cidade->hash = hash;
+    cidade->distancia = distancia;
+    cidade->latitude = COORDENADA_INDEFINIDA;
+    cidade->longitude = COORDENADA_INDEFINIDA;
+    cidade->indice = rodovia->numeroCidades++;
+    cidade->proxima = NULL;
+    cidade->anterior = ultima;
+    if (ultima != NULL)
+    {
+        ultima->proxima = cidade;
+    }
+    else
+    {
+        rodovia->cidades = cidade;
+    }
+    return cidade;
+}
+
+static int lerCoordenada(LeitorCompactado *leitor, Micrograus *coordenada)
+{
+    int64_t valor = *coordenada + lerSinal(leitor);
+    if (leitor->erro || valor < INT32_MIN || valor > INT32_MAX)
+    {
+        return 0;
+    }
+    *coordenada = (Micrograus)valor;
+    return 1;
+}
+
+static int decodificarRodovia(LeitorCompactado *leitor, char (*nomes)[50], char (*chaves)[TAMANHO_CHAVE],
+                              unsigned int *hashes, int quantidadeNomes, Centavos *valores, int quantidadeValores,
+                              Rodovia *rodovia)
+{
+    uint64_t quantidade = lerVarint(leitor);
+    int temTarifas = (int)lerLimitado(leitor, 2);
+    if (leitor->erro || quantidade > (leitor->tamanho - leitor->posicao) / 2)
+    {
+        return 0;
+    }
+
+    if (quantidade > 0)
+    {
+        rodovia->capacidadePedagios = (int)quantidade;
+        rodovia->pedagiosIda = calloc(quantidade, sizeof(Centavos));
+        rodovia->pedagiosVolta = calloc(quantidade, sizeof(Centavos));
+        if (temTarifas)
+        {
+            rodovia->tarifas = calloc(quantidade, sizeof(TabelaTarifas));
+        }
+        if (rodovia->pedagiosIda == NULL || rodovia->pedagiosVolta == NULL || (temTarifas && rodovia->tarifas == NULL))
+        {
+            return 0;
+        }
+    }
+
+    Cidade *ultima = NULL;
+    Metros distancia = 0;
+    Micrograus latitude = 0, longitude = 0;
+    for (uint64_t c = 0; c < quantidade; c++)
+    {
+        uint64_t codigo = lerLimitado(leitor, (uint64_t)quantidadeNomes << 1);
+        if (c == 0)
+        {
+            distancia = lerSinal(leitor);
+        }
+        else
+        {
+            uint64_t delta = lerVarint(leitor);
+            if (delta > INT64_MAX || (distancia > 0 && (Metros)delta > INT64_MAX - distancia))
+            {
+                return 0;
+            }
+            distancia += (Metros)delta;
+        }
+        if (leitor->erro)
+        {
+            return 0;
+        }
+
+        int indice = (int)(codigo >> 1);
+        ultima = anexarCidade(rodovia, ultima, nomes[indice], chaves[indice], hashes[indice], distancia);
+        if (ultima == NULL)
+        {
+            return 0;
+        }
+        if ((codigo & 1) && (!lerCoordenada(leitor, &latitude) || !lerCoordenada(leitor, &longitude) ||
+                             !coordenadasValidas(latitude, longitude)))
+        {
+            return 0;
+        }
+        if (codigo & 1)
+        {
+            ultima->latitude = latitude;
+            ultima->longitude = longitude;
+        }
+    }
+
+    for (int i = 0; i + 1 < rodovia->numeroCidades; i++)
+    {
+        rodovia->pedagiosIda[i] = valores[lerLimitado(leitor, quantidadeValores)];
+        rodovia->pedagiosVolta[i] = valores[lerLimitado(leitor, quantidadeValores)];
+    }
+    if (rodovia->numeroCidades > 0)
+    {
+        rodovia->pedagiosVolta[rodovia->numeroCidades - 1] = PEDAGIO_INDEFINIDO;
+    }
+    for (int i = 0; temTarifas && i + 1 < rodovia->numeroCidades && !leitor->erro; i++)
+    {
+        uint64_t faixas = lerLimitado(leitor, MINUTOS_SEMANA * MAXIMO_CLASSES_VEICULO + 1);
+        for (uint64_t f = 0; f < faixas && !leitor->erro; f++)
+        {
+            int classe = (int)lerLimitado(leitor, MAXIMO_CLASSES_VEICULO);
+            int inicio = (int)lerLimitado(leitor, MINUTOS_SEMANA);
+            Centavos valor = valores[lerLimitado(leitor, quantidadeValores)];
+            if (!leitor->erro && (valor < 0 || gravarFaixaTarifa(&rodovia->tarifas[i], classe, inicio, valor) !=
+                                                   RODOVIAS_OK))
+            {
+                return 0;
+            }
+        }
+    }
+    rodovia->modificada = 0;
+    return !leitor->erro;
+}
+
+static Rodovia *decodificarBloco(const unsigned char *dados, size_t tamanho, uint32_t quantidadeRodovias,
+                                 Rodovia **ultima)
+{
+    LeitorCompactado leitor = {dados, tamanho, 0, 0};
+    uint64_t quantidadeNomes = lerLimitado(&leitor, tamanho / 2 + 1);
+    char (*nomes)[50] = malloc(sizeof(char[50]) * (quantidadeNomes + 1));
+    char (*chaves)[TAMANHO_CHAVE] = malloc(sizeof(char[TAMANHO_CHAVE]) * (quantidadeNomes + 1));
+    unsigned int *hashes = malloc(sizeof(unsigned int) * (quantidadeNomes + 1));
+    Centavos *valores = NULL;
+    Rodovia *primeira = NULL;
+    *ultima = NULL;
+    if (nomes == NULL || chaves == NULL || hashes == NULL)
+    {
+        leitor.erro = 1;
+    }
+
+    for (uint64_t i = 0; i < quantidadeNomes && !leitor.erro; i++)
+    {
+        size_t comum = lerLimitado(&leitor, i > 0 ? strlen(nomes[i - 1]) + 1 : 1);
+        size_t resto = lerLimitado(&leitor, 50 - comum);
+        const char *sufixo = lerTextoCompactado(&leitor, resto);
+        if (leitor.erro || comum + resto == 0)
+        {
+            leitor.erro = 1;
+            break;
+        }
+        memcpy(nomes[i], nomes[i > 0 ? i - 1 : 0], comum);
+        memcpy(nomes[i] + comum, sufixo, resto);
+        nomes[i][comum + resto] = '\0';
+        normalizarNome(nomes[i], chaves[i]);
+        hashes[i] = calcularHash(chaves[i]);
+    }
+
+    uint64_t quantidadeValores = leitor.erro ? 0 : lerLimitado(&leitor, tamanho + 1);
+    valores = calloc(quantidadeValores + 1, sizeof(Centavos));
+    if (valores == NULL)
+    {
+        leitor.erro = 1;
+    }
+    for (uint64_t i = 0; i < quantidadeValores && !leitor.erro; i++)
+    {
+        valores[i] = lerSinal(&leitor);
+    }
+
+    for (uint32_t r = 0; r < quantidadeRodovias && !leitor.erro; r++)
+    {
+        char nomeRodovia[50];
+        size_t tamanhoNome = lerLimitado(&leitor, 50);
+        const char *nome = lerTextoCompactado(&leitor, tamanhoNome);
+        if (leitor.erro || tamanhoNome == 0)
+        {
+            leitor.erro = 1;
+            break;
+        }
+        memcpy(nomeRodovia, nome, tamanhoNome);
+        nomeRodovia[tamanhoNome] = '\0';
+
+        Rodovia *rodovia = inserirRodovia(NULL, nomeRodovia);
+        if (rodovia == NULL)
+        {
+            leitor.erro = 1;
+            break;
+        }
+        if (*ultima != NULL)
+        {
+            (*ultima)->proxima = rodovia;
+        }
+        else
+        {
+            primeira = rodovia;
+        }
+        *ultima = rodovia;
+
+        rodovia->pedagio = lerSinal(&leitor);
+        if (!decodificarRodovia(&leitor, nomes, chaves, hashes, (int)quantidadeNomes, valores,
+                                (int)quantidadeValores, rodovia))
+        {
+            leitor.erro = 1;
+        }
+    }
+
+    free(nomes);
+    free(chaves);
+    free(hashes);
+    free(valores);
+    if (leitor.erro || leitor.posicao != leitor.tamanho)
+    {
+        liberarMemoria(primeira);
+        *ultima = NULL;
+        return NULL;
+    }
+    return primeira;
+}
+
+static int lerDiretorio(CabecalhoRedeCompactada *cabecalho, uint64_t tamanhoArquivo)
+{
+    uint64_t tamanhoDiretorio = (uint64_t)cabecalho->quantidadeBlocos * sizeof(BlocoCompactado) +
+                                (uint64_t)cabecalho->quantidadeRodovias * sizeof(EntradaRodoviaCompactada);
+    return memcmp(cabecalho->assinatura, ASSINATURA_REDE_COMPACTADA, sizeof(cabecalho->assinatura)) == 0 &&
+           cabecalho->posicaoDiretorio >= sizeof(CabecalhoRedeCompactada) &&
+           cabecalho->posicaoDiretorio <= tamanhoArquivo &&
+           tamanhoDiretorio == tamanhoArquivo - cabecalho->posicaoDiretorio &&
+           cabecalho->quantidadeBlocos <= cabecalho->quantidadeRodovias;
+}
+
+static int blocoValido(BlocoCompactado *bloco, CabecalhoRedeCompactada *cabecalho)
+{
+    return bloco->posicao >= sizeof(CabecalhoRedeCompactada) && bloco->posicao <= cabecalho->posicaoDiretorio &&
+           bloco->tamanho <= cabecalho->posicaoDiretorio - bloco->posicao &&
+           bloco->primeiraRodovia <= cabecalho->quantidadeRodovias &&
+           bloco->quantidadeRodovias <= cabecalho->quantidadeRodovias - bloco->primeiraRodovia;
+}
+
+static void *descompactarBlocos(void *argumento)
+{
+    DescompactacaoRede *descompactacao = argumento;
+    int b;
+    while ((b = __atomic_fetch_add(&descompactacao->proximoBloco, 1, __ATOMIC_RELAXED)) <
+           descompactacao->quantidadeBlocos)
+    {
+        BlocoCompactado *bloco = &descompactacao->blocos[b];
+        const unsigned char *dados = descompactacao->dados + bloco->posicao;
+        if (verificarBloco(dados, bloco->tamanho) != bloco->verificacao)
+        {
+            __atomic_fetch_add(&descompactacao->falhas, 1, __ATOMIC_RELAXED);
+            continue;
+        }
+        descompactacao->primeiras[b] =
+            decodificarBloco(dados, bloco->tamanho, bloco->quantidadeRodovias, &descompactacao->ultimas[b]);
+        if (descompactacao->primeiras[b] == NULL && bloco->quantidadeRodovias > 0)
+        {
+            __atomic_fetch_add(&descompactacao->falhas, 1, __ATOMIC_RELAXED);
+        }
+    }
+    return NULL;
+}
+
+static unsigned char *lerArquivoInteiro(char nomeArquivo[], uint64_t *tamanho)
+{
+    int descritor = open(nomeArquivo, O_RDONLY);
+    struct stat estado;
+    if (descritor < 0 || fstat(descritor, &estado) != 0)
+    {
+        if (descritor >= 0)
+        {
+            close(descritor);
+        }
+        return NULL;
+    }
+
+    unsigned char *dados = malloc(estado.st_size > 0 ? estado.st_size : 1);
+    size_t lidos = 0;
+    while (dados != NULL && lidos < (size_t)estado.st_size)
+    {
+        ssize_t n = read(descritor, dados + lidos, estado.st_size - lidos);
+        if (n <= 0)
+        {
+            free(dados);
+            dados = NULL;
+            break;
+        }
+        lidos += n;
+    }
+    close(descritor);
+    *tamanho = lidos;
+    return dados;
+}
+
+int carregarRedeCompactada(Rodovia **lista, char nomeArquivo[], int quantidadeThreads)
+{
+    uint64_t tamanho = 0;
+    unsigned char *dados = lerArquivoInteiro(nomeArquivo, &tamanho);
+    if (dados == NULL)
+    {
+        return RODOVIAS_ERRO_ARQUIVO;
+    }
+
+    CabecalhoRedeCompactada cabecalho;
+    if (tamanho < sizeof(cabecalho))
+    {
+        free(dados);
+        return RODOVIAS_ERRO_ARQUIVO;
+    }
+    memcpy(&cabecalho, dados, sizeof(cabecalho));
+    if (!lerDiretorio(&cabecalho, tamanho))
+    {
+        free(dados);
+        return RODOVIAS_ERRO_ARQUIVO;
+    }
+
+    DescompactacaoRede descompactacao;
+    memset(&descompactacao, 0, sizeof(descompactacao));
+    descompactacao.dados = dados;
+    descompactacao.quantidadeBlocos = cabecalho.quantidadeBlocos;
+    descompactacao.blocos = malloc(sizeof(BlocoCompactado) * (cabecalho.quantidadeBlocos + 1));
+    descompactacao.primeiras = calloc(cabecalho.quantidadeBlocos + 1, sizeof(Rodovia *));
+    descompactacao.ultimas = calloc(cabecalho.quantidadeBlocos + 1, sizeof(Rodovia *));
+    if (descompactacao.blocos == NULL || descompactacao.primeiras == NULL || descompactacao.ultimas == NULL)
+    {
+        free(descompactacao.blocos);
+        free(descompactacao.primeiras);
+        free(descompactacao.ultimas);
+        free(dados);
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+    memcpy(descompactacao.blocos, dados + cabecalho.posicaoDiretorio,
+           sizeof(BlocoCompactado) * cabecalho.quantidadeBlocos);
+    for (uint32_t b = 0; b < cabecalho.quantidadeBlocos; b++)
+    {
+        descompactacao.falhas += !blocoValido(&descompactacao.blocos[b], &cabecalho);
+    }
+
+    if (quantidadeThreads < 1)
+    {
+        quantidadeThreads = 1;
+    }
+    if (quantidadeThreads > (int)cabecalho.quantidadeBlocos)
+    {
+        quantidadeThreads = cabecalho.quantidadeBlocos > 0 ? (int)cabecalho.quantidadeBlocos : 1;
+    }
+    pthread_t *threads = malloc(sizeof(pthread_t) * quantidadeThreads);
+    int iniciadas = 0;
+    for (int t = 1; descompactacao.falhas == 0 && threads != NULL && t < quantidadeThreads; t++)
+    {
+        if (pthread_create(&threads[iniciadas], NULL, descompactarBlocos, &descompactacao) == 0)
+        {
+            iniciadas++;
+        }
+    }
+    if (descompactacao.falhas == 0)
+    {
+        descompactarBlocos(&descompactacao);
+    }
+    for (int t = 0; t < iniciadas; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+
+    Rodovia *resultado = NULL, *ultima = NULL;
+    for (uint32_t b = 0; b < cabecalho.quantidadeBlocos; b++)
+    {
+        if (descompactacao.primeiras[b] == NULL)
+        {
+            continue;
+        }
+        if (ultima != NULL)
+        {
+            ultima->proxima = descompactacao.primeiras[b];
+        }
+        else
+        {
+            resultado = descompactacao.primeiras[b];
+        }
+        ultima = descompactacao.ultimas[b];
+    }
+
+    int status = descompactacao.falhas == 0 ? RODOVIAS_OK : RODOVIAS_ERRO_ARQUIVO;
+    if (status == RODOVIAS_OK)
+    {
+        *lista = resultado;
+    }
+    else
+    {
+        liberarMemoria(resultado);
+    }
+    free(descompactacao.blocos);
+    free(descompactacao.primeiras);
+    free(descompactacao.ultimas);
+    free(dados);
+    return status;
+}
+
+int carregarRodoviaCompactada(char nomeArquivo[], char nomeRodovia[], Rodovia **rodovia)
+{
+    int descritor = open(nomeArquivo, O_RDONLY);
+    struct stat estado;
+    CabecalhoRedeCompactada cabecalho;
+    if (descritor < 0)
+    {
+        return RODOVIAS_ERRO_ARQUIVO;
+    }
+    if (fstat(descritor, &estado) != 0 || pread(descritor, &cabecalho, sizeof(cabecalho), 0) != (ssize_t)sizeof(cabecalho) ||
+        !lerDiretorio(&cabecalho, estado.st_size))
+    {
+        close(descritor);
+        return RODOVIAS_ERRO_ARQUIVO;
+    }
+
+    size_t tamanhoDiretorio = estado.st_size - cabecalho.posicaoDiretorio;
+    unsigned char *diretorio = malloc(tamanhoDiretorio + 1);
+    if (diretorio == NULL ||
+        pread(descritor, diretorio, tamanhoDiretorio, cabecalho.posicaoDiretorio) != (ssize_t)tamanhoDiretorio)
+    {
+        free(diretorio);
+        close(descritor);
+        return diretorio == NULL ? RODOVIAS_ERRO_MEMORIA : RODOVIAS_ERRO_ARQUIVO;
+    }
+    BlocoCompactado *blocos = (BlocoCompactado *)diretorio;
+    EntradaRodoviaCompactada *entradas =
+        (EntradaRodoviaCompactada *)(diretorio + sizeof(BlocoCompactado) * cabecalho.quantidadeBlocos);
+
+    char chaveBusca[TAMANHO_CHAVE];
+    normalizarNome(nomeRodovia, chaveBusca);
+    unsigned int hashBusca = calcularHash(chaveBusca);
+
+    int status = RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    uint32_t ultimoBloco = UINT32_MAX;
+    for (uint32_t i = 0; i < cabecalho.quantidadeRodovias && status == RODOVIAS_RODOVIA_NAO_ENCONTRADA; i++)
+    {
+        uint32_t b = entradas[i].bloco;
+        if (entradas[i].hash != hashBusca || b == ultimoBloco)
+        {
+            continue;
+        }
+        if (b >= cabecalho.quantidadeBlocos || !blocoValido(&blocos[b], &cabecalho))
+        {
+            status = RODOVIAS_ERRO_ARQUIVO;
+            break;
+        }
+        ultimoBloco = b;
+
+        unsigned char *dados = malloc(blocos[b].tamanho + 1);
+        Rodovia *ultima, *lidas = NULL;
+        if (dados == NULL)
+        {
+            status = RODOVIAS_ERRO_MEMORIA;
+            break;
+        }
+        if (pread(descritor, dados, blocos[b].tamanho, blocos[b].posicao) != (ssize_t)blocos[b].tamanho ||
+            verificarBloco(dados, blocos[b].tamanho) != blocos[b].verificacao ||
+            (lidas = decodificarBloco(dados, blocos[b].tamanho, blocos[b].quantidadeRodovias, &ultima)) == NULL)
+        {
+            free(dados);
+            status = RODOVIAS_ERRO_ARQUIVO;
+            break;
+        }
+        free(dados);
+
+        Rodovia *anterior = NULL;
+        for (Rodovia *r = lidas; r != NULL; anterior = r, r = r->proxima)
+        {
+            if (mesmaChave(r->hash, r->chave, hashBusca, chaveBusca))
+            {
+                if (anterior != NULL)
+                {
+                    anterior->proxima = r->proxima;
+                }
+                else
+                {
+                    lidas = r->proxima;
+                }
+                r->proxima = NULL;
+                *rodovia = r;
+                status = RODOVIAS_OK;
+                break;
+            }
+        }
+        liberarMemoria(lidas);
+    }
+
+    free(diretorio);
+    close(descritor);
+    return status;
+}
+
+static long tamanhoArquivo(char nomeArquivo[])
+{
+    struct stat estado;
+    return stat(nomeArquivo, &estado) == 0 ? (long)estado.st_size : -1;
+}
+
+int executarCompactacao(char arquivoTexto[], char arquivoCompactado[])
+{
+    Rodovia *lista = NULL;
+    double inicio = agoraSegundos();
+    if (carregarRodoviasDeArquivo(&lista, arquivoTexto) != RODOVIAS_OK)
+    {
+        printf("Erro ao abrir o arquivo %s para leitura!\n", arquivoTexto);
+        return 1;
+    }
+    double tempoTexto = agoraSegundos() - inicio;
+
+    inicio = agoraSegundos();
+    int status = gravarRedeCompactada(lista, arquivoCompactado);
+    double tempoGravacao = agoraSegundos() - inicio;
+    liberarMemoria(lista);
+    if (status != RODOVIAS_OK)
+    {
+        printf("Erro ao gravar o arquivo '%s'!\n", arquivoCompactado);
+        return 1;
+    }
+
+    long original = tamanhoArquivo(arquivoTexto), compactado = tamanhoArquivo(arquivoCompactado);
+    printf("Rede compactada gravada em '%s': %ld bytes (texto: %ld bytes, %.1fx menor).\n", arquivoCompactado,
+           compactado, original, compactado > 0 ? (double)original / compactado : 0);
+    printf("Leitura do texto: %.3f s, compactação: %.3f s\n", tempoTexto, tempoGravacao);
+    return 0;
+}
+
+int executarDescompactacao(char arquivoCompactado[], char arquivoTexto[], int quantidadeThreads)
+{
+    Rodovia *lista = NULL;
+    double inicio = agoraSegundos();
+    int status = carregarRedeCompactada(&lista, arquivoCompactado, quantidadeThreads);
+    if (status != RODOVIAS_OK)
+    {
+        printf("Erro: '%s' não é uma rede compactada válida!\n", arquivoCompactado);
+        return 1;
+    }
+    double tempoLeitura = agoraSegundos() - inicio;
+
+    status = imprimirRodoviasEmArquivo(lista, arquivoTexto);
+    liberarMemoria(lista);
+    if (status != RODOVIAS_OK)
+    {
+        printf("Erro ao gravar o arquivo '%s'!\n", arquivoTexto);
+        return 1;
+    }
+    printf("Rede descompactada em '%s' (leitura com %d thread(s): %.3f s).\n", arquivoTexto, quantidadeThreads,
+           tempoLeitura);
+    return 0;
+}
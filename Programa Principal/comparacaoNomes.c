@@ -0,0 +1,309 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "estruturas.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define KERNELS_X86
+#endif
+
+#define HASH_MULTIPLICADOR1 0x85EBCA6Bu
+#define HASH_MULTIPLICADOR2 0xC2B2AE35u
+#define HASH_PALAVRAS (TAMANHO_CHAVE / 4)
+
+static uint32_t constantesHash[HASH_PALAVRAS];
+
+static void prepararConstantesHash(void)
+{
+    for (int i = 0; i < HASH_PALAVRAS; i++)
+    {
+        constantesHash[i] = 0x9E3779B9u * (uint32_t)(i + 1);
+    }
+}
+
+static unsigned int finalizarHash(uint32_t hash)
+{
+    hash ^= hash >> 16;
+    hash *= 0x7FEB352Du;
+    hash ^= hash >> 15;
+    hash *= 0x846CA68Bu;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static void corrigirAcentos(char chave[])
+{
+    for (int i = 0; i < TAMANHO_CHAVE - 1 && chave[i]; i++)
+    {
+        unsigned char c = (unsigned char)chave[i];
+        unsigned char seguinte = (unsigned char)chave[i + 1];
+
+        if (c == 0xC3 && seguinte >= 0x80 && seguinte <= 0x9E && seguinte != 0x97)
+        {
+            chave[i + 1] = (char)(seguinte + 0x20);
+            i++;
+        }
+    }
+}
+
+static void dobrarCaixaEscalar(char chave[])
+{
+    int temAcento = 0;
+    for (int i = 0; i < TAMANHO_CHAVE; i++)
+    {
+        unsigned char c = (unsigned char)chave[i];
+        if (c >= 'A' && c <= 'Z')
+        {
+            chave[i] = (char)(c + ('a' - 'A'));
+        }
+        temAcento |= c & 0x80;
+    }
+
+    if (temAcento)
+    {
+        corrigirAcentos(chave);
+    }
+}
+
+static int chavesIguaisEscalar(char chave1[], char chave2[])
+{
+    uint64_t diferenca = 0;
+    for (int i = 0; i < TAMANHO_CHAVE; i += 8)
+    {
+        uint64_t a, b;
+        memcpy(&a, chave1 + i, 8);
+        memcpy(&b, chave2 + i, 8);
+        diferenca |= a ^ b;
+    }
+    return diferenca == 0;
+}
+
+static unsigned int hashChaveEscalar(char chave[])
+{
+    uint32_t soma = 0;
+    for (int i = 0; i < HASH_PALAVRAS; i++)
+    {
+        uint32_t palavra;
+        memcpy(&palavra, chave + 4 * i, 4);
+
+        uint32_t m = (palavra ^ constantesHash[i]) * HASH_MULTIPLICADOR1;
+        m ^= m >> 15;
+        m *= HASH_MULTIPLICADOR2;
+        soma += m;
+    }
+    return finalizarHash(soma);
+}
+
+#ifdef KERNELS_X86
+
+__attribute__((target("sse2"))) static __m128i dobrarBlocoSse2(__m128i bloco, int *temAcento)
+{
+    __m128i deslocado = _mm_add_epi8(bloco, _mm_set1_epi8((char)(128 - 'A')));
+    __m128i maiuscula = _mm_cmplt_epi8(deslocado, _mm_set1_epi8((char)(-128 + 26)));
+    *temAcento |= _mm_movemask_epi8(bloco);
+    return _mm_add_epi8(bloco, _mm_and_si128(maiuscula, _mm_set1_epi8(0x20)));
+}
+
+__attribute__((target("sse2"))) static void dobrarCaixaSse2(char chave[])
+{
+    int temAcento = 0;
+    for (int i = 0; i < TAMANHO_CHAVE; i += 16)
+    {
+        __m128i bloco = _mm_loadu_si128((__m128i *)(chave + i));
+        _mm_storeu_si128((__m128i *)(chave + i), dobrarBlocoSse2(bloco, &temAcento));
+    }
+
+    if (temAcento)
+    {
+        corrigirAcentos(chave);
+    }
+}
+
+__attribute__((target("sse2"))) static int chavesIguaisSse2(char chave1[], char chave2[])
+{
+    __m128i iguais = _mm_set1_epi8((char)0xFF);
+    for (int i = 0; i < TAMANHO_CHAVE; i += 16)
+    {
+        __m128i a = _mm_loadu_si128((__m128i *)(chave1 + i));
+        __m128i b = _mm_loadu_si128((__m128i *)(chave2 + i));
+        iguais = _mm_and_si128(iguais, _mm_cmpeq_epi8(a, b));
+    }
+    return _mm_movemask_epi8(iguais) == 0xFFFF;
+}
+
+__attribute__((target("sse2"))) static __m128i multiplicarSse2(__m128i a, __m128i b)
+{
+    __m128i pares = _mm_mul_epu32(a, b);
+    __m128i impares = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(pares, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(impares, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+__attribute__((target("sse2"))) static unsigned int hashChaveSse2(char chave[])
+{
+    __m128i soma = _mm_setzero_si128();
+    __m128i multiplicador1 = _mm_set1_epi32((int)HASH_MULTIPLICADOR1);
+    __m128i multiplicador2 = _mm_set1_epi32((int)HASH_MULTIPLICADOR2);
+
+    for (int i = 0; i < HASH_PALAVRAS; i += 4)
+    {
+        __m128i palavras = _mm_loadu_si128((__m128i *)(chave + 4 * i));
+        __m128i constantes = _mm_loadu_si128((__m128i *)(constantesHash + i));
+
+        __m128i m = multiplicarSse2(_mm_xor_si128(palavras, constantes), multiplicador1);
+        m = _mm_xor_si128(m, _mm_srli_epi32(m, 15));
+        m = multiplicarSse2(m, multiplicador2);
+        soma = _mm_add_epi32(soma, m);
+    }
+
+    soma = _mm_add_epi32(soma, _mm_shuffle_epi32(soma, _MM_SHUFFLE(1, 0, 3, 2)));
+    soma = _mm_add_epi32(soma, _mm_shuffle_epi32(soma, _MM_SHUFFLE(2, 3, 0, 1)));
+    return finalizarHash((uint32_t)_mm_cvtsi128_si32(soma));
+}
+
+__attribute__((target("avx2"))) static void dobrarCaixaAvx2(char chave[])
+{
+    int temAcento = 0;
+    for (int i = 0; i < TAMANHO_CHAVE; i += 32)
+    {
+        __m256i bloco = _mm256_loadu_si256((__m256i *)(chave + i));
+        __m256i deslocado = _mm256_add_epi8(bloco, _mm256_set1_epi8((char)(128 - 'A')));
+        __m256i maiuscula = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(-128 + 26)), deslocado);
+        temAcento |= _mm256_movemask_epi8(bloco);
+        bloco = _mm256_add_epi8(bloco, _mm256_and_si256(maiuscula, _mm256_set1_epi8(0x20)));
+        _mm256_storeu_si256((__m256i *)(chave + i), bloco);
+    }
+    _mm256_zeroupper();
+
+    if (temAcento)
+    {
+        corrigirAcentos(chave);
+    }
+}
+
+__attribute__((target("avx2"))) static int chavesIguaisAvx2(char chave1[], char chave2[])
+{
+    __m256i iguais = _mm256_set1_epi8((char)0xFF);
+    for (int i = 0; i < TAMANHO_CHAVE; i += 32)
+    {
+        __m256i a = _mm256_loadu_si256((__m256i *)(chave1 + i));
+        __m256i b = _mm256_loadu_si256((__m256i *)(chave2 + i));
+        iguais = _mm256_and_si256(iguais, _mm256_cmpeq_epi8(a, b));
+    }
+    return _mm256_movemask_epi8(iguais) == -1;
+}
+
+__attribute__((target("avx2"))) static unsigned int hashChaveAvx2(char chave[])
+{
+    __m256i soma = _mm256_setzero_si256();
+    __m256i multiplicador1 = _mm256_set1_epi32((int)HASH_MULTIPLICADOR1);
+    __m256i multiplicador2 = _mm256_set1_epi32((int)HASH_MULTIPLICADOR2);
+
+    for (int i = 0; i < HASH_PALAVRAS; i += 8)
+    {
+        __m256i palavras = _mm256_loadu_si256((__m256i *)(chave + 4 * i));
+        __m256i constantes = _mm256_loadu_si256((__m256i *)(constantesHash + i));
+
+        __m256i m = _mm256_mullo_epi32(_mm256_xor_si256(palavras, constantes), multiplicador1);
+        m = _mm256_xor_si256(m, _mm256_srli_epi32(m, 15));
+        m = _mm256_mullo_epi32(m, multiplicador2);
+        soma = _mm256_add_epi32(soma, m);
+    }
+
+    __m128i parcial = _mm_add_epi32(_mm256_castsi256_si128(soma), _mm256_extracti128_si256(soma, 1));
+    parcial = _mm_add_epi32(parcial, _mm_shuffle_epi32(parcial, _MM_SHUFFLE(1, 0, 3, 2)));
+    parcial = _mm_add_epi32(parcial, _mm_shuffle_epi32(parcial, _MM_SHUFFLE(2, 3, 0, 1)));
+    return finalizarHash((uint32_t)_mm_cvtsi128_si32(parcial));
+}
+
+#endif
+
+static KernelsNomes kernelsDisponiveis[] = {
+    {"escalar", dobrarCaixaEscalar, chavesIguaisEscalar, hashChaveEscalar},
+#ifdef KERNELS_X86
+    {"sse2", dobrarCaixaSse2, chavesIguaisSse2, hashChaveSse2},
+    {"avx2", dobrarCaixaAvx2, chavesIguaisAvx2, hashChaveAvx2},
+#endif
+};
+
+#define TOTAL_KERNELS_NOMES (int)(sizeof(kernelsDisponiveis) / sizeof(kernelsDisponiveis[0]))
+
+static KernelsNomes kernelsSuportados[TOTAL_KERNELS_NOMES];
+static int quantidadeSuportados = 0;
+static KernelsNomes *kernelsAtivos = NULL;
+static pthread_once_t kernelsIniciados = PTHREAD_ONCE_INIT;
+
+static int kernelSuportado(KernelsNomes *kernels)
+{
+#ifdef KERNELS_X86
+    if (strcmp(kernels->nome, "sse2") == 0)
+    {
+        return __builtin_cpu_supports("sse2");
+    }
+    if (strcmp(kernels->nome, "avx2") == 0)
+    {
+        return __builtin_cpu_supports("avx2");
+    }
+#endif
+    return strcmp(kernels->nome, "escalar") == 0;
+}
+
+static void iniciarKernelsNomes(void)
+{
+    prepararConstantesHash();
+
+    for (int i = 0; i < TOTAL_KERNELS_NOMES; i++)
+    {
+        if (kernelSuportado(&kernelsDisponiveis[i]))
+        {
+            kernelsSuportados[quantidadeSuportados++] = kernelsDisponiveis[i];
+        }
+    }
+
+    KernelsNomes *escolhido = &kernelsSuportados[quantidadeSuportados - 1];
+    char *forcado = getenv("RODOVIAS_KERNEL_NOMES");
+    for (int i = 0; forcado != NULL && i < quantidadeSuportados; i++)
+    {
+        if (strcmp(kernelsSuportados[i].nome, forcado) == 0)
+        {
+            escolhido = &kernelsSuportados[i];
+        }
+    }
+    __atomic_store_n(&kernelsAtivos, escolhido, __ATOMIC_RELEASE);
+}
+
+KernelsNomes *listarKernelsNomes(int *quantidade)
+{
+    pthread_once(&kernelsIniciados, iniciarKernelsNomes);
+    *quantidade = quantidadeSuportados;
+    return kernelsSuportados;
+}
+
+KernelsNomes *obterKernelsNomes(void)
+{
+    KernelsNomes *kernels = __atomic_load_n(&kernelsAtivos, __ATOMIC_ACQUIRE);
+    if (kernels != NULL)
+    {
+        return kernels;
+    }
+    pthread_once(&kernelsIniciados, iniciarKernelsNomes);
+    return kernelsAtivos;
+}
+
+void dobrarCaixaChave(char chave[])
+{
+    obterKernelsNomes()->dobrarCaixa(chave);
+}
+
+int chavesIguais(char chave1[], char chave2[])
+{
+    return obterKernelsNomes()->iguais(chave1, chave2);
+}
+
+unsigned int hashChave(char chave[])
+{
+    return obterKernelsNomes()->hash(chave);
+}
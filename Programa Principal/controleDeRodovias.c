@@ -2,82 +2,169 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include "estruturas.h"
 
-void carregarRodoviasDeArquivo(Rodovia **lista, char *nomeArquivo)
+static int lerLinha(char linha[], int tamanho, FILE *arquivo)
+{
+    if (fgets(linha, tamanho, arquivo) == NULL)
+    {
+        return 0;
+    }
+    if (strchr(linha, '\n') == NULL)
+    {
+        int caractere;
+        while ((caractere = fgetc(arquivo)) != EOF && caractere != '\n')
+        {
+        }
+    }
+    return 1;
+}
+
+static void liberarTarifas(Rodovia *rodovia)
+{
+    if (rodovia->tarifas == NULL)
+    {
+        return;
+    }
+    for (int i = 0; i < rodovia->capacidadePedagios; i++)
+    {
+        liberarTabelaTarifas(&rodovia->tarifas[i]);
+    }
+    free(rodovia->tarifas);
+    rodovia->tarifas = NULL;
+}
+
+static int definirTarifaTrecho(Rodovia *rodovia, int trecho, int classe, int inicio, Centavos valor)
+{
+    if (rodovia->tarifas == NULL)
+    {
+        if (valor < 0)
+        {
+            return RODOVIAS_OK;
+        }
+        rodovia->tarifas = (TabelaTarifas *)calloc(rodovia->capacidadePedagios, sizeof(TabelaTarifas));
+        if (rodovia->tarifas == NULL)
+        {
+            return RODOVIAS_ERRO_MEMORIA;
+        }
+    }
+    return gravarFaixaTarifa(&rodovia->tarifas[trecho], classe, inicio, valor);
+}
+
+int carregarRodoviasDeArquivo(Rodovia **lista, char *nomeArquivo)
 {
     FILE *arquivo = fopen(nomeArquivo, "r");
     if (arquivo == NULL)
     {
-        printf("Erro ao abrir o arquivo %s para leitura!\n", nomeArquivo);
-        return;
+        return RODOVIAS_ERRO_ARQUIVO;
     }
 
     char linha[256];
     char nomeRodovia[50];
-    float pedagioRodovia;
+    int pendente = lerLinha(linha, sizeof(linha), arquivo);
 
-    while (fgets(linha, sizeof(linha), arquivo))
+    while (pendente)
     {
-        if (sscanf(linha, "Rodovia: %49s", nomeRodovia) == 1)
+        if (sscanf(linha, "Rodovia: %49s", nomeRodovia) != 1)
         {
-            fgets(linha, sizeof(linha), arquivo);
-            sscanf(linha, "Pedágio: R$ %f", &pedagioRodovia);
+            pendente = lerLinha(linha, sizeof(linha), arquivo);
+            continue;
+        }
 
-            Rodovia *novaRodovia = inserirRodovia(*lista, nomeRodovia);
-            if (novaRodovia != NULL)
-            {
-                novaRodovia->pedagio = pedagioRodovia;
-                *lista = novaRodovia;
+        double pedagioRodovia = 0;
+        pendente = lerLinha(linha, sizeof(linha), arquivo);
+        if (pendente && sscanf(linha, "Pedágio: R$ %lf", &pedagioRodovia) == 1)
+        {
+            pendente = lerLinha(linha, sizeof(linha), arquivo);
+        }
+
+        Rodovia *novaRodovia = inserirRodovia(*lista, nomeRodovia);
+        if (novaRodovia == *lista)
+        {
+            novaRodovia = NULL;
+        }
+        else
+        {
+            novaRodovia->pedagio = reaisParaCentavos(pedagioRodovia);
+            *lista = novaRodovia;
+        }
 
-                char nomeCidade[50];
-                float distancia, pedagio;
+        char nomeCidade[50];
+        double distancia, pedagio, volta, latitude, longitude;
+        Cidade *ultimaCidade = NULL;
+        int classe, dia, hora, minuto;
 
-                while (fgets(linha, sizeof(linha), arquivo) && linha[0] == '\t')
+        while (pendente && linha[0] == '\t')
+        {
+            pedagio = 0;
+            volta = PEDAGIO_INDEFINIDO;
+            if (ultimaCidade != NULL && ultimaCidade->anterior != NULL &&
+                sscanf(linha, "\t\tTarifa: Classe %d, Dia %d, %d:%d, R$ %lf", &classe, &dia, &hora, &minuto,
+                       &pedagio) == 5)
+            {
+                if (classe >= 0 && classe < MAXIMO_CLASSES_VEICULO && dia >= 0 && dia < 7 && hora >= 0 &&
+                    hora < 24 && minuto >= 0 && minuto < 60 && pedagio >= 0)
+                {
+                    definirTarifaTrecho(novaRodovia, ultimaCidade->anterior->indice, classe,
+                                        (dia * 24 + hora) * 60 + minuto, reaisParaCentavos(pedagio));
+                }
+            }
+            else if (ultimaCidade != NULL &&
+                     sscanf(linha, "\t\tCoordenadas: %lf, %lf", &latitude, &longitude) == 2)
+            {
+                Micrograus lat = grausParaMicrograus(latitude), lon = grausParaMicrograus(longitude);
+                if (coordenadasValidas(lat, lon))
                 {
-                    if (sscanf(linha, "\tCidade: %49[^,], Distância: %f, Pedágio: R$ %f",
-                               nomeCidade, &distancia, &pedagio) == 3)
+                    ultimaCidade->latitude = lat;
+                    ultimaCidade->longitude = lon;
+                }
+            }
+            else if (novaRodovia != NULL &&
+                     sscanf(linha, "\tCidade: %49[^,], Distância: %lf, Pedágio: R$ %lf, Volta: R$ %lf",
+                            nomeCidade, &distancia, &pedagio, &volta) >= 2)
+            {
+                Cidade *novaCidade = inserirCidade(novaRodovia, nomeCidade, kmParaMetros(distancia));
+                ultimaCidade = novaCidade;
+                if (novaCidade != NULL && novaCidade->anterior != NULL)
+                {
+                    int trecho = novaCidade->anterior->indice;
+                    if (pedagio > 0)
                     {
-                        Cidade *novaCidade = inserirCidade(novaRodovia, nomeCidade, distancia);
-                        if (novaCidade != NULL && pedagio > 0)
-                        {
-
-                            if (novaCidade->anterior != NULL)
-                            {
-                                Pedagio *novoPedagio = (Pedagio *)malloc(sizeof(Pedagio));
-                                if (novoPedagio != NULL)
-                                {
-                                    strcpy(novoPedagio->nomeCidade, novaCidade->nomeCidade);
-                                    novoPedagio->valor = pedagio;
-                                    novoPedagio->proximo = novaCidade->anterior->pedagios;
-                                    novaCidade->anterior->pedagios = novoPedagio;
-                                }
-                            }
-                        }
+                        novaRodovia->pedagiosIda[trecho] = reaisParaCentavos(pedagio);
+                    }
+                    if (volta >= 0)
+                    {
+                        novaRodovia->pedagiosVolta[trecho] = reaisParaCentavos(volta);
                     }
                 }
             }
+            pendente = lerLinha(linha, sizeof(linha), arquivo);
+        }
+
+        if (novaRodovia != NULL)
+        {
+            novaRodovia->modificada = 0;
         }
     }
 
     fclose(arquivo);
-    printf("Dados carregados de '%s' com sucesso!\n", nomeArquivo);
+    return RODOVIAS_OK;
 }
 
 Rodovia *buscarRodovia(Rodovia *lista, char nome[])
 {
     Rodovia *rodoviaAtual = lista;
-    char nomeBusca[50], nomeAtual[50];
+    char chaveBusca[TAMANHO_CHAVE];
 
-    strcpy(nomeBusca, nome);
-    converterMinusculo(nomeBusca);
+    normalizarNome(nome, chaveBusca);
+    unsigned int hashBusca = calcularHash(chaveBusca);
 
     while (rodoviaAtual != NULL)
     {
-        strcpy(nomeAtual, rodoviaAtual->nome);
-        converterMinusculo(nomeAtual);
-
-        if (strcmp(nomeAtual, nomeBusca) == 0)
+        if (mesmaChave(rodoviaAtual->hash, rodoviaAtual->chave, hashBusca, chaveBusca))
         {
             return rodoviaAtual;
         }
@@ -88,97 +175,151 @@ Rodovia *buscarRodovia(Rodovia *lista, char nome[])
 
 Rodovia *inserirRodovia(Rodovia *lista, char nome[])
 {
-    Rodovia *atual = lista;
-    char nomeAtual[50], nomeBusca[50];
-    strcpy(nomeBusca, nome);
-    converterMinusculo(nomeBusca);
-
-    while (atual != NULL)
+    if (buscarRodovia(lista, nome) != NULL)
     {
-        strcpy(nomeAtual, atual->nome);
-        converterMinusculo(nomeAtual);
-        if (strcmp(nomeAtual, nomeBusca) == 0)
-        {
-            printf("Erro: A rodovia '%s' já existe!\n", nome);
-            return lista;
-        }
-        atual = atual->proxima;
+        return lista;
     }
 
     Rodovia *novaRodovia = (Rodovia *)malloc(sizeof(Rodovia));
     if (novaRodovia == NULL)
     {
-        printf("Erro de alocação de memória!\n");
         return lista;
     }
 
     strcpy(novaRodovia->nome, nome);
+    normalizarNome(nome, novaRodovia->chave);
+    novaRodovia->hash = calcularHash(novaRodovia->chave);
     novaRodovia->cidades = NULL;
+    novaRodovia->numeroCidades = 0;
+    novaRodovia->pedagiosIda = NULL;
+    novaRodovia->pedagiosVolta = NULL;
+    novaRodovia->capacidadePedagios = 0;
+    novaRodovia->tarifas = NULL;
     novaRodovia->proxima = lista;
     novaRodovia->pedagio = 0.0;
+    novaRodovia->modificada = 1;
+    novaRodovia->rodovias_adjacentes = NULL;
 
     return novaRodovia;
 }
 
-Rodovia *removerRodovia(Rodovia *lista, char nome[])
+static void liberarRodovia(Rodovia *rodovia)
 {
-    Rodovia *rodoviaAtual = lista;
-    Rodovia *anterior = NULL;
-
-    while (rodoviaAtual != NULL && strcmp(rodoviaAtual->nome, nome))
+    Cidade *cidadeAtual = rodovia->cidades;
+    while (cidadeAtual != NULL)
     {
-        anterior = rodoviaAtual;
-        rodoviaAtual = rodoviaAtual->proxima;
+        Cidade *proximaCidade = cidadeAtual->proxima;
+        free(cidadeAtual);
+        cidadeAtual = proximaCidade;
     }
+    free(rodovia->pedagiosIda);
+    free(rodovia->pedagiosVolta);
+    liberarTarifas(rodovia);
+    liberarAdjacentes(rodovia);
+    free(rodovia);
+}
 
-    if (rodoviaAtual == NULL)
+Rodovia *desligarRodovia(Rodovia **lista, char nome[])
+{
+    char chaveBusca[TAMANHO_CHAVE];
+    normalizarNome(nome, chaveBusca);
+    unsigned int hashBusca = calcularHash(chaveBusca);
+
+    Rodovia **ligacao = lista;
+    while (*ligacao != NULL && !mesmaChave((*ligacao)->hash, (*ligacao)->chave, hashBusca, chaveBusca))
     {
-        return lista;
+        ligacao = &(*ligacao)->proxima;
     }
 
-    if (anterior == NULL)
+    Rodovia *rodovia = *ligacao;
+    if (rodovia != NULL)
     {
-        lista = rodoviaAtual->proxima;
+        *ligacao = rodovia->proxima;
+        rodovia->proxima = NULL;
     }
-    else
+    return rodovia;
+}
+
+Rodovia *removerRodovia(Rodovia *lista, char nome[])
+{
+    Rodovia *rodovia = desligarRodovia(&lista, nome);
+    if (rodovia != NULL)
     {
-        anterior->proxima = rodoviaAtual->proxima;
+        liberarRodovia(rodovia);
     }
+    return lista;
+}
 
-    Cidade *cidadeAtual = rodoviaAtual->cidades;
-    while (cidadeAtual != NULL)
+Cidade *buscarCidade(Rodovia *rodovia, char nomeCidade[])
+{
+    if (rodovia == NULL)
     {
-        Cidade *proximaCidade = cidadeAtual->proxima;
+        return NULL;
+    }
 
+    char chaveBusca[TAMANHO_CHAVE];
+    normalizarNome(nomeCidade, chaveBusca);
+    unsigned int hashBusca = calcularHash(chaveBusca);
 
-        Pedagio *pedagioAtual = cidadeAtual->pedagios;
-        while (pedagioAtual != NULL)
+    Cidade *atual = rodovia->cidades;
+    while (atual != NULL)
+    {
+        if (mesmaChave(atual->hash, atual->chave, hashBusca, chaveBusca))
         {
-            Pedagio *proximoPedagio = pedagioAtual->proximo;
-            free(pedagioAtual);
-            pedagioAtual = proximoPedagio;
+            return atual;
         }
-
-        free(cidadeAtual);
-        cidadeAtual = proximaCidade;
+        atual = atual->proxima;
     }
 
-    free(rodoviaAtual);
-    return lista;
+    return NULL;
 }
 
-Cidade *inserirCidade(Rodovia *rodovia, char nomeCidade[], float distancia)
+Cidade *inserirCidade(Rodovia *rodovia, char nomeCidade[], Metros distancia)
 {
+    if (rodovia->numeroCidades + 1 > rodovia->capacidadePedagios)
+    {
+        int novaCapacidade = rodovia->capacidadePedagios > 0 ? rodovia->capacidadePedagios * 2 : 8;
+        Centavos *novaIda = (Centavos *)realloc(rodovia->pedagiosIda, novaCapacidade * sizeof(Centavos));
+        if (novaIda != NULL)
+        {
+            rodovia->pedagiosIda = novaIda;
+        }
+        Centavos *novaVolta = (Centavos *)realloc(rodovia->pedagiosVolta, novaCapacidade * sizeof(Centavos));
+        if (novaVolta != NULL)
+        {
+            rodovia->pedagiosVolta = novaVolta;
+        }
+        if (novaIda == NULL || novaVolta == NULL)
+        {
+            return NULL;
+        }
+        if (rodovia->tarifas != NULL)
+        {
+            TabelaTarifas *novasTarifas =
+                (TabelaTarifas *)realloc(rodovia->tarifas, novaCapacidade * sizeof(TabelaTarifas));
+            if (novasTarifas == NULL)
+            {
+                return NULL;
+            }
+            memset(&novasTarifas[rodovia->capacidadePedagios], 0,
+                   (novaCapacidade - rodovia->capacidadePedagios) * sizeof(TabelaTarifas));
+            rodovia->tarifas = novasTarifas;
+        }
+        rodovia->capacidadePedagios = novaCapacidade;
+    }
+
     Cidade *novaCidade = (Cidade *)malloc(sizeof(Cidade));
     if (novaCidade == NULL)
     {
-        printf("Erro de alocação de memória!\n");
         return NULL;
     }
 
     strcpy(novaCidade->nomeCidade, nomeCidade);
+    normalizarNome(nomeCidade, novaCidade->chave);
+    novaCidade->hash = calcularHash(novaCidade->chave);
     novaCidade->distancia = distancia;
-    novaCidade->pedagios = NULL;
+    novaCidade->latitude = COORDENADA_INDEFINIDA;
+    novaCidade->longitude = COORDENADA_INDEFINIDA;
     novaCidade->proxima = NULL;
     novaCidade->anterior = NULL;
 
@@ -194,7 +335,7 @@ Cidade *inserirCidade(Rodovia *rodovia, char nomeCidade[], float distancia)
     else
     {
         Cidade *atual = rodovia->cidades;
-        while (atual->proxima != NULL && atual->proxima->distancia < distancia)
+        while (atual->proxima != NULL && atual->proxima->distancia <= distancia)
         {
             atual = atual->proxima;
         }
@@ -208,380 +349,360 @@ Cidade *inserirCidade(Rodovia *rodovia, char nomeCidade[], float distancia)
         atual->proxima = novaCidade;
     }
 
+    int indice = novaCidade->anterior != NULL ? novaCidade->anterior->indice + 1 : 0;
+    int deslocados = rodovia->numeroCidades - indice;
+    memmove(&rodovia->pedagiosIda[indice + 1], &rodovia->pedagiosIda[indice], deslocados * sizeof(Centavos));
+    memmove(&rodovia->pedagiosVolta[indice + 1], &rodovia->pedagiosVolta[indice], deslocados * sizeof(Centavos));
+    rodovia->pedagiosIda[indice] = 0;
+    rodovia->pedagiosVolta[indice] = PEDAGIO_INDEFINIDO;
+    if (rodovia->tarifas != NULL)
+    {
+        memmove(&rodovia->tarifas[indice + 1], &rodovia->tarifas[indice], deslocados * sizeof(TabelaTarifas));
+        memset(&rodovia->tarifas[indice], 0, sizeof(TabelaTarifas));
+    }
+    rodovia->numeroCidades++;
+    rodovia->modificada = 1;
+
+    for (Cidade *c = novaCidade; c != NULL; c = c->proxima)
+    {
+        c->indice = indice++;
+    }
+
     return novaCidade;
 }
 
-void adicionarPedagio(Rodovia *rodovia, char nomeCidade1[], char nomeCidade2[], float valorPedagio)
+int adicionarPedagio(Rodovia *rodovia, char nomeCidade1[], char nomeCidade2[], Centavos valorPedagio, int sentido)
 {
-    Cidade *cidade1 = NULL;
-    Cidade *cidade2 = NULL;
-    Cidade *cidadeAtual = rodovia->cidades;
+    Cidade *cidade1 = buscarCidade(rodovia, nomeCidade1);
+    Cidade *cidade2 = buscarCidade(rodovia, nomeCidade2);
 
-    while (cidadeAtual != NULL)
+    if (cidade1 == NULL || cidade2 == NULL)
     {
-        if (strcmp(cidadeAtual->nomeCidade, nomeCidade1) == 0)
-        {
-            cidade1 = cidadeAtual;
-        }
-        if (strcmp(cidadeAtual->nomeCidade, nomeCidade2) == 0)
-        {
-            cidade2 = cidadeAtual;
-        }
-        cidadeAtual = cidadeAtual->proxima;
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
     }
 
-    if (cidade1 == NULL || cidade2 == NULL)
+    if (cidade1 == cidade2)
     {
-        printf("Erro: Uma ou ambas as cidades não foram encontradas na rodovia.\n");
-        return;
+        return RODOVIAS_CIDADES_IGUAIS;
     }
 
-    Pedagio *novoPedagio = (Pedagio *)malloc(sizeof(Pedagio));
-    if (novoPedagio == NULL)
+    Cidade *inicio = cidade1->indice < cidade2->indice ? cidade1 : cidade2;
+    if (inicio->proxima != cidade1 && inicio->proxima != cidade2)
     {
-        printf("Erro de alocação de memória!\n");
-        return;
+        return RODOVIAS_ARGUMENTO_INVALIDO;
     }
 
-    strcpy(novoPedagio->nomeCidade, nomeCidade2);
-    novoPedagio->valor = valorPedagio;
-    novoPedagio->proximo = cidade1->pedagios;
-    cidade1->pedagios = novoPedagio;
+    if (sentido != SENTIDO_VOLTA)
+    {
+        rodovia->pedagiosIda[inicio->indice] = valorPedagio;
+    }
+    if (sentido != SENTIDO_IDA)
+    {
+        rodovia->pedagiosVolta[inicio->indice] = sentido == SENTIDO_VOLTA ? valorPedagio : PEDAGIO_INDEFINIDO;
+    }
 
-    printf("Pedágio de R$ %.2f adicionado entre %s e %s.\n", valorPedagio, nomeCidade1, nomeCidade2);
+    rodovia->modificada = 1;
+    return RODOVIAS_OK;
 }
 
-float calcularPedagioTotal(Cidade *cidades)
+int definirDistanciaTrecho(Rodovia *rodovia, char nomeCidade1[], char nomeCidade2[], Metros comprimento)
 {
-    float total = 0.0;
-    Cidade *atual = cidades;
-    while (atual != NULL)
+    Cidade *cidade1 = buscarCidade(rodovia, nomeCidade1);
+    Cidade *cidade2 = buscarCidade(rodovia, nomeCidade2);
+
+    if (cidade1 == NULL || cidade2 == NULL)
     {
-        Pedagio *pedagioAtual = atual->pedagios;
-        while (pedagioAtual != NULL)
-        {
-            total += pedagioAtual->valor;
-            pedagioAtual = pedagioAtual->proximo;
-        }
-        atual = atual->proxima;
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
     }
-    return total;
-}
 
-void removerCidade(Rodovia *rodovia, char nomeCidade[])
-{
-    if (rodovia->cidades == NULL)
+    if (cidade1 == cidade2)
     {
-        printf("Nenhuma cidade para remover.\n");
-        return;
+        return RODOVIAS_CIDADES_IGUAIS;
     }
 
-    Cidade *atual = rodovia->cidades;
+    Cidade *inicio = cidade1->indice < cidade2->indice ? cidade1 : cidade2;
+    if ((inicio->proxima != cidade1 && inicio->proxima != cidade2) || comprimento < 0)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
 
-    while (atual != NULL && strcmp(atual->nomeCidade, nomeCidade) != 0)
+    Metros deslocamento = comprimento - (inicio->proxima->distancia - inicio->distancia);
+    for (Cidade *c = inicio->proxima; c != NULL; c = c->proxima)
     {
-        atual = atual->proxima;
+        c->distancia += deslocamento;
     }
 
-    if (atual == NULL)
+    rodovia->modificada = 1;
+    return RODOVIAS_OK;
+}
+
+int definirTarifaPedagio(Rodovia *rodovia, char nomeCidade1[], char nomeCidade2[], int classe, int inicio,
+                         Centavos valor)
+{
+    if (classe < 0 || classe >= MAXIMO_CLASSES_VEICULO || inicio < 0 || inicio >= MINUTOS_SEMANA)
     {
-        printf("Cidade '%s' não encontrada na rodovia.\n", nomeCidade);
-        return;
+        return RODOVIAS_ARGUMENTO_INVALIDO;
     }
 
-    if (atual->anterior == NULL)
+    Cidade *cidade1 = buscarCidade(rodovia, nomeCidade1);
+    Cidade *cidade2 = buscarCidade(rodovia, nomeCidade2);
+
+    if (cidade1 == NULL || cidade2 == NULL)
     {
-        rodovia->cidades = atual->proxima;
-        if (atual->proxima != NULL)
-        {
-            atual->proxima->anterior = NULL;
-        }
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
     }
-    else
+
+    if (cidade1 == cidade2)
     {
-        atual->anterior->proxima = atual->proxima;
-        if (atual->proxima != NULL)
-        {
-            atual->proxima->anterior = atual->anterior;
-        }
+        return RODOVIAS_CIDADES_IGUAIS;
     }
 
-    Pedagio *pedagioAtual = atual->pedagios;
-    while (pedagioAtual != NULL)
+    Cidade *anterior = cidade1->indice < cidade2->indice ? cidade1 : cidade2;
+    if (anterior->proxima != cidade1 && anterior->proxima != cidade2)
     {
-        Pedagio *proximoPedagio = pedagioAtual->proximo;
-        free(pedagioAtual);
-        pedagioAtual = proximoPedagio;
+        return RODOVIAS_ARGUMENTO_INVALIDO;
     }
 
-    free(atual);
-    printf("Cidade '%s' removida com sucesso!\n", nomeCidade);
+    int status = definirTarifaTrecho(rodovia, anterior->indice, classe, inicio, valor);
+    if (status == RODOVIAS_OK)
+    {
+        rodovia->modificada = 1;
+    }
+    return status;
 }
 
-void percursoEntreCidades(Rodovia *rodovia, char cidadeInicio[], char cidadeFim[])
+Centavos calcularPedagioTotal(Rodovia *rodovia)
 {
-    Cidade *atual = rodovia->cidades;
-    Cidade *cidadeInicial = NULL;
-    Cidade *cidadeFinal = NULL;
-    float distanciaTotal = 0;
-    float pedagioTotal = 0;
+    Centavos *pedagios = rodovia->pedagiosIda;
+    int quantidade = rodovia->numeroCidades;
+    Centavos parciais[8] = {0};
+    int i = 0;
 
-    while (atual != NULL)
+    for (; i + 8 <= quantidade; i += 8)
     {
-        if (strcmp(atual->nomeCidade, cidadeInicio) == 0)
-        {
-            cidadeInicial = atual;
-        }
-        if (strcmp(atual->nomeCidade, cidadeFim) == 0)
+        for (int j = 0; j < 8; j++)
         {
-            cidadeFinal = atual;
+            parciais[j] += pedagios[i + j];
         }
-        atual = atual->proxima;
     }
 
-    if (cidadeInicial == NULL)
+    Centavos total = 0;
+    for (int j = 0; j < 8; j++)
     {
-        printf("Cidade de início '%s' não encontrada na rodovia.\n", cidadeInicio);
-        return;
+        total += parciais[j];
     }
-    if (cidadeFinal == NULL)
+    for (; i < quantidade; i++)
     {
-        printf("Cidade de destino '%s' não encontrada na rodovia.\n", cidadeFim);
-        return;
+        total += pedagios[i];
     }
+    return total;
+}
 
-    printf("\n=== Percurso na rodovia %s ===\n", rodovia->nome);
-    printf("Início do percurso em: %s (km %.2f)\n", cidadeInicio, cidadeInicial->distancia);
+Centavos pedagioTrecho(Rodovia *rodovia, int indice, int sentido)
+{
+    if (sentido < 0 && rodovia->pedagiosVolta[indice] != PEDAGIO_INDEFINIDO)
+    {
+        return rodovia->pedagiosVolta[indice];
+    }
+    return rodovia->pedagiosIda[indice];
+}
 
-    atual = cidadeInicial;
-    while (atual != cidadeFinal && atual != NULL)
+Centavos tarifaTrecho(Rodovia *rodovia, int indice, int sentido, int minuto, int classe)
+{
+    Centavos fixo = pedagioTrecho(rodovia, indice, sentido);
+    if (rodovia->tarifas == NULL)
     {
-        Cidade *proxima = atual->proxima;
-        if (proxima != NULL)
-        {
-            float trechoDistancia = proxima->distancia - atual->distancia;
-            distanciaTotal += trechoDistancia;
+        return fixo;
+    }
+    return valorTarifa(&rodovia->tarifas[indice], classe, minuto, fixo);
+}
 
-            printf("\n-> Próxima cidade: %s (km %.2f)\n", proxima->nomeCidade, proxima->distancia);
-            printf("   Distância do trecho: %.2f km\n", trechoDistancia);
+int minutoDePassagem(int partida, Metros distancia)
+{
+    if (partida < 0)
+    {
+        return PARTIDA_INDEFINIDA;
+    }
+    Metros minutos = distancia * 60 / (VELOCIDADE_REFERENCIA_KMH * METROS_POR_KM);
+    return (int)((partida + minutos) % MINUTOS_SEMANA);
+}
 
-            Pedagio *pedagioAtual = atual->pedagios;
-            while (pedagioAtual != NULL)
-            {
-                if (strcmp(pedagioAtual->nomeCidade, proxima->nomeCidade) == 0)
-                {
-                    pedagioTotal += pedagioAtual->valor;
-                    break;
-                }
-                pedagioAtual = pedagioAtual->proximo;
-            }
+Centavos reaisParaCentavos(double reais)
+{
+    return llround(reais * CENTAVOS_POR_REAL);
+}
 
-            if (pedagioAtual == NULL)
-            {
-                pedagioAtual = proxima->pedagios;
-                while (pedagioAtual != NULL)
-                {
-                    if (strcmp(pedagioAtual->nomeCidade, atual->nomeCidade) == 0)
-                    {
-                        pedagioTotal += pedagioAtual->valor;
-                        break;
-                    }
-                    pedagioAtual = pedagioAtual->proximo;
-                }
-            }
-        }
-        atual = atual->proxima;
-    }
+Metros kmParaMetros(double km)
+{
+    return llround(km * METROS_POR_KM);
+}
 
-    printf("\n=== Fim do percurso ===\n");
-    printf("Distância total percorrida: %.2f km\n", distanciaTotal);
-    printf("Custo total em pedágios: R$ %.2f\n", pedagioTotal);
+int64_t limiteEmUnidades(double valor, int unidades)
+{
+    return valor < (double)(CUSTO_INFINITO / unidades) ? llround(valor * unidades) : CUSTO_INFINITO;
 }
 
-void listarTodosCruzamentos(Rodovia *listaRodovias)
+Micrograus grausParaMicrograus(double graus)
 {
-    if (listaRodovias == NULL || listaRodovias->proxima == NULL)
+    if (!(fabs(graus) <= 180.0))
     {
-        printf("São necessárias pelo menos duas rodovias para verificar cruzamentos!\n");
-        return;
+        return COORDENADA_INDEFINIDA;
     }
+    return (Micrograus)lround(graus * MICROGRAUS_POR_GRAU);
+}
 
-    int encontrouAlgumCruzamento = 0;
-    printf("\n=== Listagem de Todos os Cruzamentos ===\n");
+double micrograusParaGraus(Micrograus valor)
+{
+    return (double)valor / MICROGRAUS_POR_GRAU;
+}
 
-    for (Rodovia *r1 = listaRodovias; r1 != NULL; r1 = r1->proxima)
-    {
-        for (Rodovia *r2 = r1->proxima; r2 != NULL; r2 = r2->proxima)
+int coordenadasValidas(Micrograus latitude, Micrograus longitude)
+{
+    return latitude != COORDENADA_INDEFINIDA && longitude != COORDENADA_INDEFINIDA &&
+           latitude >= -90 * MICROGRAUS_POR_GRAU && latitude <= 90 * MICROGRAUS_POR_GRAU &&
+           longitude >= -180 * MICROGRAUS_POR_GRAU && longitude <= 180 * MICROGRAUS_POR_GRAU;
+}
 
+int definirCoordenadas(Rodovia *lista, char nomeCidade[], Micrograus latitude, Micrograus longitude)
+{
+    int alteradas = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        Cidade *cidade = buscarCidade(r, nomeCidade);
+        if (cidade != NULL)
         {
-            Cidade *cidade1 = r1->cidades;
-            int encontrouCruzamento = 0;
-            char cidade1Lower[50], cidade2Lower[50];
-
-            while (cidade1 != NULL)
-            {
-                Cidade *cidade2 = r2->cidades;
-                strcpy(cidade1Lower, cidade1->nomeCidade);
-                converterMinusculo(cidade1Lower);
-
-                while (cidade2 != NULL)
-                {
-                    strcpy(cidade2Lower, cidade2->nomeCidade);
-                    converterMinusculo(cidade2Lower);
-
-                    if (strcmp(cidade1Lower, cidade2Lower) == 0)
-                    {
-                        if (!encontrouCruzamento)
-                        {
-                            printf("\nCruzamento entre %s e %s:\n", r1->nome, r2->nome);
-                            encontrouCruzamento = 1;
-                            encontrouAlgumCruzamento = 1;
-                        }
-                        printf("- %s (km %.2f na %s, km %.2f na %s)\n",
-                               cidade1->nomeCidade,
-                               cidade1->distancia,
-                               r1->nome,
-                               cidade2->distancia,
-                               r2->nome);
-                    }
-                    cidade2 = cidade2->proxima;
-                }
-                cidade1 = cidade1->proxima;
-            }
+            cidade->latitude = latitude;
+            cidade->longitude = longitude;
+            r->modificada = 1;
+            alteradas++;
         }
     }
+    return alteradas;
+}
 
-    if (!encontrouAlgumCruzamento)
-    {
-        printf("\nNenhum cruzamento encontrado entre as rodovias cadastradas.\n");
-    }
+double centavosParaReais(Centavos valor)
+{
+    return (double)valor / CENTAVOS_POR_REAL;
 }
 
-void imprimirRodovias(Rodovia *lista)
+double metrosParaKm(Metros distancia)
 {
-    Rodovia *rodoviaAtual = lista;
+    return (double)distancia / METROS_POR_KM;
+}
 
-    if (rodoviaAtual == NULL)
+int removerCidade(Rodovia *rodovia, char nomeCidade[])
+{
+    if (rodovia->cidades == NULL)
     {
-        printf("Nenhuma rodovia registrada!\n");
-        return;
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
     }
 
-    while (rodoviaAtual != NULL)
+    Cidade *atual = buscarCidade(rodovia, nomeCidade);
+    if (atual == NULL)
     {
-        float pedagioTotal = calcularPedagioTotal(rodoviaAtual->cidades);
-        rodoviaAtual->pedagio = pedagioTotal;
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
 
-        printf("Rodovia: %s\n", rodoviaAtual->nome);
-        printf("Pedágio Total: R$ %.2f\n", pedagioTotal);
+    int indice = atual->indice;
+    TabelaTarifas *tarifas = rodovia->tarifas;
+    TabelaTarifas combinada = {NULL, 0, 0};
+    if (tarifas != NULL && indice > 0 && atual->proxima != NULL &&
+        (tarifas[indice - 1].quantidade > 0 || tarifas[indice].quantidade > 0) &&
+        combinarTabelasTarifas(&tarifas[indice - 1], rodovia->pedagiosIda[indice - 1], &tarifas[indice],
+                               rodovia->pedagiosIda[indice], &combinada) != RODOVIAS_OK)
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
 
-        Cidade *cidadeAtual = rodoviaAtual->cidades;
-        while (cidadeAtual != NULL)
+    if (atual->anterior == NULL)
+    {
+        rodovia->cidades = atual->proxima;
+        if (atual->proxima != NULL)
         {
-            printf("Cidade: %s, Distância: %.2f",
-                   cidadeAtual->nomeCidade, cidadeAtual->distancia);
-            if (cidadeAtual->pedagios != NULL)
-            {
-                printf(", Pedágio: R$ %.2f", cidadeAtual->pedagios->valor);
-            }
-            printf("\n");
-            cidadeAtual = cidadeAtual->proxima;
+            atual->proxima->anterior = NULL;
         }
-        rodoviaAtual = rodoviaAtual->proxima;
-        printf("\n");
     }
-}
-
-void imprimirRodoviasEmArquivo(Rodovia *lista, char *nomeArquivo)
-{
-    FILE *arquivo = fopen(nomeArquivo, "w");
-    if (arquivo == NULL)
+    else
     {
-        printf("Erro ao abrir o arquivo para escrita!\n");
-        return;
+        atual->anterior->proxima = atual->proxima;
+        if (atual->proxima != NULL)
+        {
+            atual->proxima->anterior = atual->anterior;
+        }
     }
 
-    Rodovia *rodoviaAtual = lista;
-
-    if (rodoviaAtual == NULL)
+    Centavos *ida = rodovia->pedagiosIda;
+    Centavos *volta = rodovia->pedagiosVolta;
+    if (tarifas != NULL)
     {
-        fprintf(arquivo, "Nenhuma rodovia registrada!\n");
+        liberarTabelaTarifas(&tarifas[indice]);
+        if (indice > 0)
+        {
+            liberarTabelaTarifas(&tarifas[indice - 1]);
+            tarifas[indice - 1] = combinada;
+        }
     }
-    else
+    if (indice > 0)
     {
-        while (rodoviaAtual != NULL)
+        if (atual->proxima != NULL)
         {
-            float pedagioTotal = calcularPedagioTotal(rodoviaAtual->cidades);
-            rodoviaAtual->pedagio = pedagioTotal;
-
-            fprintf(arquivo, "Rodovia: %s\n", rodoviaAtual->nome);
-            fprintf(arquivo, "Pedágio: R$ %.2f\n", pedagioTotal);
-
-            Cidade *cidadeAtual = rodoviaAtual->cidades;
-            while (cidadeAtual != NULL)
+            if (volta[indice - 1] != PEDAGIO_INDEFINIDO || volta[indice] != PEDAGIO_INDEFINIDO)
             {
-                fprintf(arquivo, "\tCidade: %s, Distância: %.2f",
-                        cidadeAtual->nomeCidade, cidadeAtual->distancia);
-                if (cidadeAtual->pedagios != NULL)
-                {
-                    fprintf(arquivo, ", Pedágio: R$ %.2f", cidadeAtual->pedagios->valor);
-                }
-                fprintf(arquivo, "\n");
-                cidadeAtual = cidadeAtual->proxima;
+                volta[indice - 1] = pedagioTrecho(rodovia, indice - 1, -1) + pedagioTrecho(rodovia, indice, -1);
             }
-
-            rodoviaAtual = rodoviaAtual->proxima;
-            fprintf(arquivo, "\n");
+            ida[indice - 1] += ida[indice];
+        }
+        else
+        {
+            ida[indice - 1] = 0;
+            volta[indice - 1] = PEDAGIO_INDEFINIDO;
         }
     }
+    int deslocados = rodovia->numeroCidades - indice - 1;
+    memmove(&ida[indice], &ida[indice + 1], deslocados * sizeof(Centavos));
+    memmove(&volta[indice], &volta[indice + 1], deslocados * sizeof(Centavos));
+    if (tarifas != NULL)
+    {
+        memmove(&tarifas[indice], &tarifas[indice + 1], deslocados * sizeof(TabelaTarifas));
+        memset(&tarifas[rodovia->numeroCidades - 1], 0, sizeof(TabelaTarifas));
+    }
+    rodovia->numeroCidades--;
 
-    fclose(arquivo);
+    for (Cidade *c = atual->proxima; c != NULL; c = c->proxima)
+    {
+        c->indice--;
+    }
+
+    rodovia->modificada = 1;
+    free(atual);
+    return RODOVIAS_OK;
 }
 
-void listarCruzamentos(Rodovia *rodovia1, Rodovia *rodovia2)
+int imprimirRodoviasEmArquivo(Rodovia *lista, char *nomeArquivo)
 {
-    if (rodovia1 == NULL || rodovia2 == NULL)
+    int descritor = open(nomeArquivo, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0)
     {
-        printf("Uma ou ambas as rodovias não foram encontradas!\n");
-        return;
+        return RODOVIAS_ERRO_ARQUIVO;
     }
 
-    printf("\nPontos de cruzamento entre %s e %s:\n", rodovia1->nome, rodovia2->nome);
-
-    Cidade *cidadeRodovia1 = rodovia1->cidades;
-    int encontrouCruzamento = 0;
-    char cidade1Lower[50], cidade2Lower[50];
-
-    while (cidadeRodovia1 != NULL)
+    BufferSaida saida;
+    iniciarBufferSaida(&saida, descritor);
+    if (lista == NULL)
     {
-        Cidade *cidadeRodovia2 = rodovia2->cidades;
-        strcpy(cidade1Lower, cidadeRodovia1->nomeCidade);
-        converterMinusculo(cidade1Lower);
-
-        while (cidadeRodovia2 != NULL)
-        {
-            strcpy(cidade2Lower, cidadeRodovia2->nomeCidade);
-            converterMinusculo(cidade2Lower);
-
-            if (strcmp(cidade1Lower, cidade2Lower) == 0)
-            {
-                printf("- %s (km %.2f na %s, km %.2f na %s)\n",
-                       cidadeRodovia1->nomeCidade,
-                       cidadeRodovia1->distancia,
-                       rodovia1->nome,
-                       cidadeRodovia2->distancia,
-                       rodovia2->nome);
-                encontrouCruzamento = 1;
-            }
-            cidadeRodovia2 = cidadeRodovia2->proxima;
-        }
-        cidadeRodovia1 = cidadeRodovia1->proxima;
+        saidaTexto(&saida, "Nenhuma rodovia registrada!\n");
+    }
+    else
+    {
+        escreverRodovias(&saida, lista, 1);
     }
 
-    if (!encontrouCruzamento)
+    int status = finalizarBufferSaida(&saida) != 0 ? RODOVIAS_ERRO_ARQUIVO : RODOVIAS_OK;
+    if (close(descritor) != 0)
     {
-        printf("Nenhum ponto de cruzamento encontrado entre estas rodovias.\n");
+        status = RODOVIAS_ERRO_ARQUIVO;
     }
+    return status;
 }
 
 void converterMinusculo(char *str)
@@ -592,340 +713,37 @@ void converterMinusculo(char *str)
     }
 }
 
-void apresentarInformacoes()
+void liberarAdjacentes(Rodovia *rodovia)
 {
-    printf("Bem-vindo ao sistema de gerenciamento de rodovias!\n");
-    printf("\nPara garantir a melhor experiência, por favor, leia as seguintes informações:\n");
-    printf("\n- Utilize nomes claros e concisos para rodovias e cidades.\n");
-    printf("- Priorize o uso do hífen (-) em nomes de rodovias (ex: BR-101).\n");
-    printf("- Verifique a ortografia para evitar erros.\n");
-    printf("- Faça backups regulares dos seus dados.\n");
-
-    printf("\nAo utilizar este sistema, você concorda com as práticas acima?\n");
-    printf("1 - Sim\n");
-    printf("2 - Não\n");
-
-    int opcao;
-    scanf("%d", &opcao);
-
-    if (opcao == 1)
-    {
-        menu();
-    }
-    else
+    RodoviaAdjacente *adjAtual = rodovia->rodovias_adjacentes;
+    while (adjAtual != NULL)
     {
-        printf("\n[Você não concordou com os termos de uso. O programa será encerrado.]\n");
+        RodoviaAdjacente *proximaAdj = adjAtual->proxima;
+        free(adjAtual);
+        adjAtual = proximaAdj;
     }
+    rodovia->rodovias_adjacentes = NULL;
 }
 
-void menu()
+void liberarListasAdjacentes(RodoviaAdjacente *adjacentes[], int quantidade)
 {
-    int opcao = -1;
-    Rodovia *listaRodovias = NULL;
-    char nomeRodovia[50], nomeCidade[50];
-    float distancia;
-    char rodovia1[50], rodovia2[50];
-    Rodovia *r1, *r2;
-    Rodovia *rodovia;
-    char nomeArquivo[50] = "";
-
-    printf("\nDeseja iniciar o programa com um arquivo em branco ou carregar um arquivo com os dados já existente?\n");
-    printf("0 para começar em branco, 1 para carregar um arquivo com os dados:\n");
-    int escolha;
-    scanf("%d", &escolha);
-    getchar();
-
-    if (escolha == 1)
-    {
-        printf("Insira o nome do arquivo para carregar os dados (ex: rodovias.txt): ");
-        scanf("%49s", nomeArquivo);
-        getchar();
-        carregarRodoviasDeArquivo(&listaRodovias, nomeArquivo);
-    }
-
-    while (opcao != 0)
-    {
-        printf("\n-> Escolha uma opcao:\n");
-        printf("1. Inserir rodovia\n");
-        printf("2. Remover rodovia\n");
-        printf("3. Inserir cidade em rodovia \n");
-        printf("4. Remover cidade de rodovia\n");
-        printf("5. Ver percurso entre duas cidades\n");
-        printf("6. Verificar cruzamento entre todas as rodovias\n");
-        printf("7. Imprimir lista de rodovias\n");
-        printf("8. Salvar lista em arquivo\n");
-        printf("9. Listar todos os cruzamentos entre duas rodovias específicas\n");
-        printf("10. Salvar alterações no arquivo atual\n");
-        printf("0. Sair\n");
-        scanf("%d", &opcao);
-        getchar();
-
-        switch (opcao)
-        {
-        case 1:
-            printf("Insira o nome da rodovia: ");
-            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
-            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
-            listaRodovias = inserirRodovia(listaRodovias, nomeRodovia);
-            break;
-
-        case 2:
-            printf("Insira o nome da rodovia a ser removida: ");
-            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
-            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
-            listaRodovias = removerRodovia(listaRodovias, nomeRodovia);
-            break;
-
-        case 3:
-            printf("Insira o nome da rodovia para adicionar a cidade: ");
-            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
-            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
-
-            char nomeRodoviaLower[50];
-            strcpy(nomeRodoviaLower, nomeRodovia);
-            converterMinusculo(nomeRodoviaLower);
-
-            Rodovia *rodovia = buscarRodovia(listaRodovias, nomeRodovia);
-            if (rodovia != NULL)
-            {
-                printf("Insira o nome da cidade: ");
-                fgets(nomeCidade, sizeof(nomeCidade), stdin);
-                nomeCidade[strcspn(nomeCidade, "\n")] = 0;
-
-                char nomeCidadeLower[50];
-                strcpy(nomeCidadeLower, nomeCidade);
-                converterMinusculo(nomeCidadeLower);
-
-                Cidade *atual = rodovia->cidades;
-                while (atual != NULL)
-                {
-                    char cidadeAtualLower[50];
-                    strcpy(cidadeAtualLower, atual->nomeCidade);
-                    converterMinusculo(cidadeAtualLower);
-
-                    if (strcmp(cidadeAtualLower, nomeCidadeLower) == 0)
-                    {
-                        printf("Erro: A cidade '%s' já existe na rodovia '%s'!\n",
-                               nomeCidade, nomeRodovia);
-                        break;
-                    }
-                    atual = atual->proxima;
-                }
-
-                if (atual != NULL)
-                {
-                    break;
-                }
-
-                printf("Insira a distância da cidade em relação ao início da rodovia: ");
-                if (scanf("%f", &distancia) != 1)
-                {
-                    printf("Erro: entrada inválida para distância\n");
-                    while (getchar() != '\n')
-                        ;
-                    break;
-                }
-                getchar();
-
-                Cidade *novaCidade = inserirCidade(rodovia, nomeCidade, distancia);
-                if (novaCidade == NULL)
-                {
-                    printf("Erro ao inserir cidade\n");
-                    break;
-                }
-
-                Cidade *tempCidade = rodovia->cidades;
-                int cityCount = 0;
-                while (tempCidade != NULL)
-                {
-                    cityCount++;
-                    tempCidade = tempCidade->proxima;
-                }
-
-                if (cityCount > 1)
-                {
-                    printf("\nCidades presentes na rodovia %s:\n", nomeRodovia);
-                    Cidade *cidadeAtual = rodovia->cidades;
-                    int i = 1;
-                    while (cidadeAtual != NULL)
-                    {
-                        if (strcmp(cidadeAtual->nomeCidade, nomeCidade) != 0)
-                        {
-                            printf("%d. %s (Distância: %.2f km)\n", i, cidadeAtual->nomeCidade, cidadeAtual->distancia);
-                        }
-                        cidadeAtual = cidadeAtual->proxima;
-                        i++;
-                    }
-
-                    printf("\nDeseja adicionar pedágio para alguma cidade? (1-Sim, 0-Não): ");
-                    int addPedagio;
-                    scanf("%d", &addPedagio);
-                    getchar();
-
-                    if (addPedagio == 1)
-                    {
-                        printf("\nEscolha o número da cidade para adicionar pedágio: ");
-                        int escolha;
-                        scanf("%d", &escolha);
-                        getchar();
-
-                        if (escolha >= 1 && escolha < i)
-                        {
-
-                            cidadeAtual = rodovia->cidades;
-                            int j = 1;
-                            while (cidadeAtual != NULL && j < escolha)
-                            {
-                                cidadeAtual = cidadeAtual->proxima;
-                                j++;
-                            }
-
-                            if (cidadeAtual != NULL)
-                            {
-                                float valorPedagio;
-                                printf("Digite o valor do pedágio entre %s e %s: R$ ",
-                                       nomeCidade, cidadeAtual->nomeCidade);
-                                scanf("%f", &valorPedagio);
-                                getchar();
-
-                                adicionarPedagio(rodovia, nomeCidade,
-                                                 cidadeAtual->nomeCidade, valorPedagio);
-                            }
-                        }
-                        else
-                        {
-                            printf("Escolha inválida!\n");
-                        }
-                    }
-                }
-
-                printf("Cidade '%s' inserida com sucesso na rodovia '%s'!\n",
-                       nomeCidade, nomeRodovia);
-            }
-            else
-            {
-                printf("Rodovia não encontrada!\n");
-            }
-            break;
-
-        case 4:
-            printf("Insira o nome da rodovia para remover a cidade: ");
-            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
-            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
-            rodovia = buscarRodovia(listaRodovias, nomeRodovia);
-            if (rodovia != NULL)
-            {
-                printf("Insira o nome da cidade a ser removida: ");
-                fgets(nomeCidade, sizeof(nomeCidade), stdin);
-                nomeCidade[strcspn(nomeCidade, "\n")] = 0;
-                removerCidade(rodovia, nomeCidade);
-            }
-            else
-            {
-                printf("Rodovia não encontrada!\n");
-            }
-            break;
-
-        case 5:
-            conectarRodovias(listaRodovias);
-
-            char cidadeInicio[50], cidadeFim[50];
-            printf("Insira a cidade de início: ");
-            fgets(cidadeInicio, sizeof(cidadeInicio), stdin);
-            cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
-
-            printf("Insira a cidade de fim: ");
-            fgets(cidadeFim, sizeof(cidadeFim), stdin);
-            cidadeFim[strcspn(cidadeFim, "\n")] = 0;
-
-            percursoEntreRodovias(listaRodovias, cidadeInicio, cidadeFim);
-            break;
-
-        case 6:
-            printf("\nVerificando todos os cruzamentos entre rodovias...\n");
-            listarTodosCruzamentos(listaRodovias);
-            break;
-
-        case 7:
-            imprimirRodovias(listaRodovias);
-            break;
-
-        case 8:
-            printf("Digite o nome do novo arquivo para salvar (ex: novo_rodovias.txt): ");
-            char novoArquivo[50];
-            scanf("%49s", novoArquivo);
-            getchar();
-            FILE *arquivo = fopen(novoArquivo, "w");
-            if (arquivo == NULL)
-            {
-                printf("Erro ao criar novo arquivo!\n");
-                break;
-            }
-            fclose(arquivo);
-            imprimirRodoviasEmArquivo(listaRodovias, novoArquivo);
-            printf("Dados salvos com sucesso em '%s'!\n", novoArquivo);
-            break;
-
-        case 9:
-            printf("Insira o nome das duas rodovias para listar todos os cruzamentos:\n");
-            fgets(rodovia1, sizeof(rodovia1), stdin);
-            rodovia1[strcspn(rodovia1, "\n")] = 0;
-            fgets(rodovia2, sizeof(rodovia2), stdin);
-            rodovia2[strcspn(rodovia2, "\n")] = 0;
-            r1 = buscarRodovia(listaRodovias, rodovia1);
-            r2 = buscarRodovia(listaRodovias, rodovia2);
-            if (r1 != NULL && r2 != NULL)
-            {
-                listarCruzamentos(r1, r2);
-            }
-            else
-            {
-                printf("Uma ou ambas as rodovias não foram encontradas!\n");
-            }
-            break;
-
-        case 10:
-            if (strlen(nomeArquivo) > 0)
-            {
-                imprimirRodoviasEmArquivo(listaRodovias, nomeArquivo);
-                printf("Alterações salvas com sucesso em '%s'!\n", nomeArquivo);
-            }
-            else
-            {
-                printf("Nenhum arquivo foi carregado inicialmente. Use a opção 8 para salvar em um novo arquivo.\n");
-            }
-            break;
-
-        default:
-            if (opcao != 0)
-            {
-                printf("Opcao invalida!\n");
-            }
-            break;
-        }
-    }
-
-    if (strlen(nomeArquivo) > 0)
+    for (int i = 0; i < quantidade; i++)
     {
-        printf("\nDeseja salvar as alterações antes de sair? (1-Sim, 0-Não): ");
-        int salvar;
-        scanf("%d", &salvar);
-        if (salvar == 1)
+        while (adjacentes[i] != NULL)
         {
-            imprimirRodoviasEmArquivo(listaRodovias, nomeArquivo);
-            printf("Alterações salvas com sucesso em '%s'!\n", nomeArquivo);
+            RodoviaAdjacente *proxima = adjacentes[i]->proxima;
+            free(adjacentes[i]);
+            adjacentes[i] = proxima;
         }
     }
-
-    liberarMemoria(listaRodovias);
-    printf("Saindo...\n");
 }
 
-void conectarRodovias(Rodovia *listaRodovias)
+int montarAdjacencias(Rodovia *listaRodovias, RodoviaAdjacente *adjacentes[])
 {
-    for (Rodovia *r1 = listaRodovias; r1 != NULL; r1 = r1->proxima)
+    int i = 0;
+    for (Rodovia *r1 = listaRodovias; r1 != NULL; r1 = r1->proxima, i++)
     {
-        r1->rodovias_adjacentes = NULL;
+        adjacentes[i] = NULL;
 
         for (Cidade *c1 = r1->cidades; c1 != NULL; c1 = c1->proxima)
         {
@@ -936,13 +754,18 @@ void conectarRodovias(Rodovia *listaRodovias)
                 {
                     for (Cidade *c2 = r2->cidades; c2 != NULL; c2 = c2->proxima)
                     {
-                        if (strcmp(c1->nomeCidade, c2->nomeCidade) == 0)
+                        if (mesmaChave(c1->hash, c1->chave, c2->hash, c2->chave))
                         {
                             RodoviaAdjacente *nova = malloc(sizeof(RodoviaAdjacente));
+                            if (nova == NULL)
+                            {
+                                liberarListasAdjacentes(adjacentes, i + 1);
+                                return RODOVIAS_ERRO_MEMORIA;
+                            }
                             strcpy(nova->nomeRodovia, r2->nome);
                             strcpy(nova->cidadeConexao, c1->nomeCidade);
-                            nova->proxima = r1->rodovias_adjacentes;
-                            r1->rodovias_adjacentes = nova;
+                            nova->proxima = adjacentes[i];
+                            adjacentes[i] = nova;
                             break;
                         }
                     }
@@ -950,171 +773,135 @@ void conectarRodovias(Rodovia *listaRodovias)
             }
         }
     }
+    return RODOVIAS_OK;
 }
 
-void percursoEntreRodovias(Rodovia *listaRodovias, char cidadeInicio[], char cidadeFim[])
+void trocarAdjacencias(Rodovia *listaRodovias, RodoviaAdjacente *adjacentes[])
 {
-    Rodovia *rodoviaInicio = NULL, *rodoviaFim = NULL;
-    Cidade *cidadeInicioPtr = NULL, *cidadeFimPtr = NULL;
-    char cidadeInicioMinuscula[50], cidadeFimMinuscula[50], cidadeAtualMinuscula[50];
-    char cidadeInicioOriginal[50], cidadeFimOriginal[50];
+    int i = 0;
+    for (Rodovia *r = listaRodovias; r != NULL; r = r->proxima, i++)
+    {
+        RodoviaAdjacente *anteriores = r->rodovias_adjacentes;
+        r->rodovias_adjacentes = adjacentes[i];
+        adjacentes[i] = anteriores;
+    }
+}
 
-    cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
-    cidadeFim[strcspn(cidadeFim, "\n")] = 0;
+int conectarRodovias(Rodovia *listaRodovias)
+{
+    int quantidade = 0;
+    for (Rodovia *r = listaRodovias; r != NULL; r = r->proxima)
+    {
+        quantidade++;
+    }
+    RodoviaAdjacente **adjacentes = malloc(sizeof(RodoviaAdjacente *) * (quantidade + 1));
+    if (adjacentes == NULL)
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+    int status = montarAdjacencias(listaRodovias, adjacentes);
+    if (status == RODOVIAS_OK)
+    {
+        trocarAdjacencias(listaRodovias, adjacentes);
+        liberarListasAdjacentes(adjacentes, quantidade);
+    }
+    free(adjacentes);
+    return status;
+}
 
-    strcpy(cidadeInicioMinuscula, cidadeInicio);
-    strcpy(cidadeFimMinuscula, cidadeFim);
-    converterMinusculo(cidadeInicioMinuscula);
-    converterMinusculo(cidadeFimMinuscula);
-    removerEspacos(cidadeInicioMinuscula);
-    removerEspacos(cidadeFimMinuscula);
+int consultarPercurso(Rodovia *listaRodovias, char cidadeInicio[], char cidadeFim[], int partida, int classe,
+                      ResultadoPercurso *resultado)
+{
+    char chaveInicio[TAMANHO_CHAVE], chaveFim[TAMANHO_CHAVE];
+
+    resultado->rodoviaInicio = NULL;
+    resultado->rodoviaFim = NULL;
+    resultado->cidadeConexao[0] = '\0';
+    resultado->distancia = 0;
+    resultado->pedagio = 0;
+
+    normalizarNome(cidadeInicio, chaveInicio);
+    normalizarNome(cidadeFim, chaveFim);
+    unsigned int hashInicio = calcularHash(chaveInicio);
+    unsigned int hashFim = calcularHash(chaveFim);
 
     for (Rodovia *r = listaRodovias; r != NULL; r = r->proxima)
     {
         for (Cidade *c = r->cidades; c != NULL; c = c->proxima)
         {
-            char cidadeTemp[50];
-            strcpy(cidadeTemp, c->nomeCidade);
-            char *virgula = strchr(cidadeTemp, ',');
-            if (virgula)
-                *virgula = '\0';
-
-            strcpy(cidadeAtualMinuscula, cidadeTemp);
-            converterMinusculo(cidadeAtualMinuscula);
-            removerEspacos(cidadeAtualMinuscula);
-
-            if (strcmp(cidadeAtualMinuscula, cidadeInicioMinuscula) == 0)
+            if (mesmaChave(c->hash, c->chave, hashInicio, chaveInicio))
             {
-                rodoviaInicio = r;
-                cidadeInicioPtr = c;
-                strcpy(cidadeInicioOriginal, cidadeTemp);
+                resultado->rodoviaInicio = r;
+                strcpy(resultado->origem, c->nomeCidade);
             }
-            if (strcmp(cidadeAtualMinuscula, cidadeFimMinuscula) == 0)
+            if (mesmaChave(c->hash, c->chave, hashFim, chaveFim))
             {
-                rodoviaFim = r;
-                cidadeFimPtr = c;
-                strcpy(cidadeFimOriginal, cidadeTemp);
+                resultado->rodoviaFim = r;
+                strcpy(resultado->destino, c->nomeCidade);
             }
         }
     }
 
-    if (!rodoviaInicio || !rodoviaFim)
+    if (!resultado->rodoviaInicio || !resultado->rodoviaFim)
     {
-        printf("Cidade de início ou fim não encontrada!\n");
-        return;
+        return CONSULTA_CIDADE_NAO_ENCONTRADA;
     }
 
-    printf("\n=== Percurso de %s até %s ===\n", cidadeInicioOriginal, cidadeFimOriginal);
-
-    if (rodoviaInicio == rodoviaFim)
+    if (resultado->rodoviaInicio == resultado->rodoviaFim)
     {
-        printf("Percurso na rodovia %s:\n", rodoviaInicio->nome);
-        percursoEntreCidades(rodoviaInicio, cidadeInicioOriginal, cidadeFimOriginal);
-        return;
+        somarPercursoTarifado(resultado->rodoviaInicio, resultado->origem, resultado->destino, partida, classe,
+                              &resultado->pedagio, &resultado->distancia);
+        return CONSULTA_OK;
     }
 
-    RodoviaAdjacente *adj = rodoviaInicio->rodovias_adjacentes;
-    while (adj != NULL)
+    for (RodoviaAdjacente *adj = resultado->rodoviaInicio->rodovias_adjacentes; adj != NULL; adj = adj->proxima)
     {
-        if (strcmp(adj->nomeRodovia, rodoviaFim->nome) == 0)
+        if (strcmp(adj->nomeRodovia, resultado->rodoviaFim->nome) == 0 &&
+            buscarCidade(resultado->rodoviaInicio, adj->cidadeConexao) != NULL &&
+            buscarCidade(resultado->rodoviaFim, adj->cidadeConexao) != NULL)
         {
-            float pedagioTotal = 0.0;
-            float distanciaTotal = 0.0;
-
-            printf("Rota encontrada:\n");
-            printf("1. Início em %s pela rodovia %s\n", cidadeInicioOriginal, rodoviaInicio->nome);
-            printf("2. Conexão em %s\n", adj->cidadeConexao);
-            printf("3. Continuação pela rodovia %s até %s\n", rodoviaFim->nome, cidadeFimOriginal);
-
-            printf("\nPrimeiro trecho (%s):\n", rodoviaInicio->nome);
-            float pedagio1 = 0.0, distancia1 = 0.0;
-            calcularPercurso(rodoviaInicio, cidadeInicioOriginal, adj->cidadeConexao, &pedagio1, &distancia1);
-            pedagioTotal += pedagio1;
-            distanciaTotal += distancia1;
-
-            printf("\nSegundo trecho (%s):\n", rodoviaFim->nome);
-            float pedagio2 = 0.0, distancia2 = 0.0;
-            calcularPercurso(rodoviaFim, adj->cidadeConexao, cidadeFimOriginal, &pedagio2, &distancia2);
-            pedagioTotal += pedagio2;
-            distanciaTotal += distancia2;
-
-            printf("\n=== Resumo do percurso completo ===\n");
-            printf("Distância total da viagem: %.2f km\n", distanciaTotal);
-            printf("Custo total em pedágios: R$ %.2f\n", pedagioTotal);
-            return;
+            Centavos pedagio1, pedagio2;
+            Metros distancia1, distancia2;
+            strcpy(resultado->cidadeConexao, adj->cidadeConexao);
+            somarPercursoTarifado(resultado->rodoviaInicio, resultado->origem, adj->cidadeConexao, partida, classe,
+                                  &pedagio1, &distancia1);
+            somarPercursoTarifado(resultado->rodoviaFim, adj->cidadeConexao, resultado->destino,
+                                  minutoDePassagem(partida, distancia1), classe, &pedagio2, &distancia2);
+            resultado->pedagio = pedagio1 + pedagio2;
+            resultado->distancia = distancia1 + distancia2;
+            return CONSULTA_OK;
         }
-        adj = adj->proxima;
     }
 
-    printf("Não foi possível encontrar uma rota direta entre as cidades.\n");
+    return CONSULTA_SEM_ROTA;
 }
 
-void calcularPercurso(Rodovia *rodovia, char cidadeInicio[], char cidadeFim[], float *pedagioTotal, float *distanciaTotal)
+void somarPercurso(Rodovia *rodovia, char cidadeInicio[], char cidadeFim[], Centavos *pedagioTotal,
+                   Metros *distanciaTotal)
 {
-    Cidade *atual = rodovia->cidades;
-    Cidade *cidadeInicial = NULL;
-    Cidade *cidadeFinal = NULL;
+    somarPercursoTarifado(rodovia, cidadeInicio, cidadeFim, PARTIDA_INDEFINIDA, 0, pedagioTotal, distanciaTotal);
+}
+
+void somarPercursoTarifado(Rodovia *rodovia, char cidadeInicio[], char cidadeFim[], int partida, int classe,
+                           Centavos *pedagioTotal, Metros *distanciaTotal)
+{
+    Cidade *cidadeInicial = buscarCidade(rodovia, cidadeInicio);
+    Cidade *cidadeFinal = buscarCidade(rodovia, cidadeFim);
     *pedagioTotal = 0;
     *distanciaTotal = 0;
 
-    while (atual != NULL)
-    {
-        if (strcmp(atual->nomeCidade, cidadeInicio) == 0)
-            cidadeInicial = atual;
-        if (strcmp(atual->nomeCidade, cidadeFim) == 0)
-            cidadeFinal = atual;
-        atual = atual->proxima;
-    }
-
     if (!cidadeInicial || !cidadeFinal)
         return;
 
-    printf("\n=== Percurso na rodovia %s ===\n", rodovia->nome);
-    printf("Início do percurso em: %s (km %.2f)\n", cidadeInicio, cidadeInicial->distancia);
-
-    atual = cidadeInicial;
-    while (atual != cidadeFinal && atual != NULL)
+    int sentido = cidadeInicial->indice <= cidadeFinal->indice ? 1 : -1;
+    for (Cidade *atual = cidadeInicial; atual != cidadeFinal;)
     {
-        Cidade *proxima = atual->proxima;
-        if (proxima != NULL)
-        {
-            float trechoDistancia = proxima->distancia - atual->distancia;
-            *distanciaTotal += trechoDistancia;
-
-            printf("\n-> Próxima cidade: %s (km %.2f)\n", proxima->nomeCidade, proxima->distancia);
-            printf("   Distância do trecho: %.2f km\n", trechoDistancia);
-
-            Pedagio *pedagioAtual = atual->pedagios;
-            while (pedagioAtual != NULL)
-            {
-                if (strcmp(pedagioAtual->nomeCidade, proxima->nomeCidade) == 0)
-                {
-                    *pedagioTotal += pedagioAtual->valor;
-                    break;
-                }
-                pedagioAtual = pedagioAtual->proximo;
-            }
-
-            if (pedagioAtual == NULL)
-            {
-                pedagioAtual = proxima->pedagios;
-                while (pedagioAtual != NULL)
-                {
-                    if (strcmp(pedagioAtual->nomeCidade, atual->nomeCidade) == 0)
-                    {
-                        *pedagioTotal += pedagioAtual->valor;
-                        break;
-                    }
-                    pedagioAtual = pedagioAtual->proximo;
-                }
-            }
-        }
-        atual = atual->proxima;
+        Cidade *proxima = sentido > 0 ? atual->proxima : atual->anterior;
+        int trecho = sentido > 0 ? atual->indice : proxima->indice;
+        *pedagioTotal += tarifaTrecho(rodovia, trecho, sentido, minutoDePassagem(partida, *distanciaTotal), classe);
+        *distanciaTotal += sentido * (proxima->distancia - atual->distancia);
+        atual = proxima;
     }
-
-    printf("\n=== Fim do percurso ===\n");
-    printf("Distância total percorrida: %.2f km\n", *distanciaTotal);
-    printf("Custo total em pedágios: R$ %.2f\n", *pedagioTotal);
 }
 
 void removerEspacos(char *texto)
@@ -1147,38 +934,34 @@ void removerEspacos(char *texto)
     }
 }
 
-void liberarMemoria(Rodovia *lista)
+void normalizarNome(char nome[], char chave[])
 {
-    while (lista != NULL)
-    {
-        Rodovia *proximaRodovia = lista->proxima;
+    memset(chave, 0, TAMANHO_CHAVE);
+    strncpy(chave, nome, TAMANHO_CHAVE - 1);
 
-        Cidade *cidadeAtual = lista->cidades;
-        while (cidadeAtual != NULL)
-        {
-            Cidade *proximaCidade = cidadeAtual->proxima;
+    dobrarCaixaChave(chave);
+    removerEspacos(chave);
 
-            Pedagio *pedagioAtual = cidadeAtual->pedagios;
-            while (pedagioAtual != NULL)
-            {
-                Pedagio *proximoPedagio = pedagioAtual->proximo;
-                free(pedagioAtual);
-                pedagioAtual = proximoPedagio;
-            }
+    int tamanho = strlen(chave);
+    memset(chave + tamanho, 0, TAMANHO_CHAVE - tamanho);
+}
 
-            free(cidadeAtual);
-            cidadeAtual = proximaCidade;
-        }
+unsigned int calcularHash(char chave[])
+{
+    return hashChave(chave);
+}
 
-        RodoviaAdjacente *adjAtual = lista->rodovias_adjacentes;
-        while (adjAtual != NULL)
-        {
-            RodoviaAdjacente *proximaAdj = adjAtual->proxima;
-            free(adjAtual);
-            adjAtual = proximaAdj;
-        }
+int mesmaChave(unsigned int hash1, char chave1[], unsigned int hash2, char chave2[])
+{
+    return hash1 == hash2 && chavesIguais(chave1, chave2);
+}
 
-        free(lista);
+void liberarMemoria(Rodovia *lista)
+{
+    while (lista != NULL)
+    {
+        Rodovia *proximaRodovia = lista->proxima;
+        liberarRodovia(lista);
         lista = proximaRodovia;
     }
 }
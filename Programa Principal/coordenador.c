@@ -0,0 +1,661 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "estruturas.h"
+
+#define TENTATIVAS_CONEXAO 3000
+
+typedef struct RegiaoCoordenada
+{
+    pid_t processo;
+    int descritor;
+    pthread_mutex_t trava;
+    char entrada[TAMANHO_ENTRADA_SERVIDOR];
+    size_t usado;
+    size_t lido;
+} RegiaoCoordenada;
+
+typedef struct ArestaSobreposta
+{
+    int origem;
+    int destino;
+    double distancia;
+    double pedagio;
+} ArestaSobreposta;
+
+typedef struct EntradaSobreposta
+{
+    double distancia;
+    double pedagio;
+    int vertice;
+} EntradaSobreposta;
+
+struct Coordenador
+{
+    RegiaoCoordenada *regioes;
+    int quantidadeRegioes;
+    int quantidadeVertices;
+    char (*chaves)[TAMANHO_CHAVE];
+    unsigned int *hashes;
+    int *tabela;
+    int capacidadeTabela;
+    int *primeiraAresta;
+    int *destinos;
+    double *distancias;
+    double *pedagios;
+};
+
+typedef struct ConsultaCoordenada
+{
+    double *distancias;
+    double *pedagios;
+    double *distanciasChegada;
+    double *pedagiosChegada;
+    unsigned char *fechados;
+    EntradaSobreposta *heap;
+    int tamanhoHeap;
+    double distanciaDireta;
+    double pedagioDireto;
+    int origemEncontrada;
+    int destinoEncontrado;
+} ConsultaCoordenada;
+
+static int menorCusto(double distancia1, double pedagio1, double distancia2, double pedagio2)
+{
+    return distancia1 < distancia2 || (distancia1 == distancia2 && pedagio1 < pedagio2);
+}
+
+static int localizarFronteira(Coordenador *coordenador, char nome[], int inserir)
+{
+    char chave[TAMANHO_CHAVE];
+    normalizarNome(nome, chave);
+    unsigned int hash = calcularHash(chave);
+    int mascara = coordenador->capacidadeTabela - 1;
+    for (int posicao = hash & mascara;; posicao = (posicao + 1) & mascara)
+    {
+        int vertice = coordenador->tabela[posicao];
+        if (vertice < 0)
+        {
+            if (!inserir)
+            {
+                return -1;
+            }
+            vertice = coordenador->quantidadeVertices++;
+            strcpy(coordenador->chaves[vertice], chave);
+            coordenador->hashes[vertice] = hash;
+            coordenador->tabela[posicao] = vertice;
+            return vertice;
+        }
+        if (mesmaChave(coordenador->hashes[vertice], coordenador->chaves[vertice], hash, chave))
+        {
+            return vertice;
+        }
+    }
+}
+
+static int enviarComando(RegiaoCoordenada *regiao, const char *comando)
+{
+    size_t tamanho = strlen(comando), enviados = 0;
+    while (enviados < tamanho)
+    {
+        ssize_t escritos = write(regiao->descritor, comando + enviados, tamanho - enviados);
+        if (escritos < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (escritos <= 0)
+        {
+            return 0;
+        }
+        enviados += escritos;
+    }
+    return 1;
+}
+
+static char *lerResposta(RegiaoCoordenada *regiao)
+{
+    memmove(regiao->entrada, regiao->entrada + regiao->lido, regiao->usado - regiao->lido);
+    regiao->usado -= regiao->lido;
+    regiao->lido = 0;
+
+    char *quebra;
+    while ((quebra = memchr(regiao->entrada, '\n', regiao->usado)) == NULL)
+    {
+        if (regiao->usado == TAMANHO_ENTRADA_SERVIDOR)
+        {
+            return NULL;
+        }
+        ssize_t lidos =
+            read(regiao->descritor, regiao->entrada + regiao->usado, TAMANHO_ENTRADA_SERVIDOR - regiao->usado);
+        if (lidos < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (lidos <= 0)
+        {
+            return NULL;
+        }
+        regiao->usado += lidos;
+    }
+    *quebra = '\0';
+    regiao->lido = quebra - regiao->entrada + 1;
+    return regiao->entrada;
+}
+
+static int lerCabecalho(RegiaoCoordenada *regiao)
+{
+    char *linha = lerResposta(regiao);
+    int linhas;
+    if (linha == NULL)
+    {
+        return -2;
+    }
+    return sscanf(linha, "OK\t%d", &linhas) == 1 && linhas >= 0 ? linhas : -1;
+}
+
+static char *lerAlcancada(RegiaoCoordenada *regiao, double *distancia, double *pedagio)
+{
+    char *linha = lerResposta(regiao);
+    char *campo = linha != NULL ? strchr(linha, '\t') : NULL;
+    if (campo == NULL || sscanf(campo, "\t%lf\t%lf", distancia, pedagio) != 2)
+    {
+        return NULL;
+    }
+    *campo = '\0';
+    return linha;
+}
+
+static int conectarRegiao(RegiaoCoordenada *regiao, char caminhoSocket[])
+{
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strcpy(endereco.sun_path, caminhoSocket);
+
+    for (int tentativa = 0; tentativa < TENTATIVAS_CONEXAO; tentativa++)
+    {
+        int situacao;
+        if (waitpid(regiao->processo, &situacao, WNOHANG) == regiao->processo)
+        {
+            regiao->processo = -1;
+            return 0;
+        }
+
+        regiao->descritor = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (regiao->descritor < 0)
+        {
+            return 0;
+        }
+        if (connect(regiao->descritor, (struct sockaddr *)&endereco, sizeof(endereco)) == 0 &&
+            enviarComando(regiao, "PING\n") && lerCabecalho(regiao) == 0)
+        {
+            return 1;
+        }
+        close(regiao->descritor);
+        regiao->descritor = -1;
+        usleep(10000);
+    }
+    return 0;
+}
+
+static int iniciarRegiao(RegiaoCoordenada *regiao, char fragmento[], char caminhoSocket[])
+{
+    regiao->processo = fork();
+    if (regiao->processo < 0)
+    {
+        return 0;
+    }
+    if (regiao->processo == 0)
+    {
+        int nulo = open("/dev/null", O_WRONLY);
+        if (nulo >= 0)
+        {
+            dup2(nulo, STDOUT_FILENO);
+            close(nulo);
+        }
+        execl("/proc/self/exe", "rodovias", "--servidor", fragmento, caminhoSocket, "1", (char *)NULL);
+        _exit(127);
+    }
+    return conectarRegiao(regiao, caminhoSocket);
+}
+
+static void encerrarRegioes(Coordenador *coordenador)
+{
+    for (int i = 0; i < coordenador->quantidadeRegioes; i++)
+    {
+        RegiaoCoordenada *regiao = &coordenador->regioes[i];
+        if (regiao->descritor >= 0)
+        {
+            close(regiao->descritor);
+        }
+        if (regiao->processo > 0)
+        {
+            kill(regiao->processo, SIGTERM);
+            waitpid(regiao->processo, NULL, 0);
+        }
+        pthread_mutex_destroy(&regiao->trava);
+    }
+}
+
+static void liberarCoordenador(Coordenador *coordenador)
+{
+    free(coordenador->regioes);
+    free(coordenador->chaves);
+    free(coordenador->hashes);
+    free(coordenador->tabela);
+    free(coordenador->primeiraAresta);
+    free(coordenador->destinos);
+    free(coordenador->distancias);
+    free(coordenador->pedagios);
+}
+
+static int carregarFronteiras(Coordenador *coordenador, char (*fragmentos)[256])
+{
+    char (**nomes)[50] = calloc(coordenador->quantidadeRegioes, sizeof(char (*)[50]));
+    int *quantidades = calloc(coordenador->quantidadeRegioes, sizeof(int));
+    int total = 0, sucesso = nomes != NULL && quantidades != NULL;
+    for (int i = 0; sucesso && i < coordenador->quantidadeRegioes; i++)
+    {
+        quantidades[i] = lerFronteiras(fragmentos[i], &nomes[i]);
+        sucesso = quantidades[i] >= 0;
+        total += sucesso ? quantidades[i] : 0;
+    }
+
+    coordenador->capacidadeTabela = 16;
+    while (coordenador->capacidadeTabela < 2 * total)
+    {
+        coordenador->capacidadeTabela *= 2;
+    }
+    coordenador->chaves = malloc(sizeof(char[TAMANHO_CHAVE]) * (total + 1));
+    coordenador->hashes = malloc(sizeof(unsigned int) * (total + 1));
+    coordenador->tabela = malloc(sizeof(int) * coordenador->capacidadeTabela);
+    sucesso = sucesso && coordenador->chaves != NULL && coordenador->hashes != NULL && coordenador->tabela != NULL;
+    if (sucesso)
+    {
+        memset(coordenador->tabela, -1, sizeof(int) * coordenador->capacidadeTabela);
+    }
+    for (int i = 0; sucesso && i < coordenador->quantidadeRegioes; i++)
+    {
+        for (int j = 0; j < quantidades[i]; j++)
+        {
+            localizarFronteira(coordenador, nomes[i][j], 1);
+        }
+    }
+
+    for (int i = 0; nomes != NULL && i < coordenador->quantidadeRegioes; i++)
+    {
+        free(nomes[i]);
+    }
+    free(nomes);
+    free(quantidades);
+    return sucesso;
+}
+
+static int adicionarAresta(ArestaSobreposta **arestas, int *quantidade, int *capacidade, ArestaSobreposta aresta)
+{
+    if (*quantidade == *capacidade)
+    {
+        *capacidade = *capacidade > 0 ? *capacidade * 2 : 256;
+        ArestaSobreposta *maiores = realloc(*arestas, sizeof(ArestaSobreposta) * *capacidade);
+        if (maiores == NULL)
+        {
+            return 0;
+        }
+        *arestas = maiores;
+    }
+    (*arestas)[(*quantidade)++] = aresta;
+    return 1;
+}
+
+static int coletarArestas(Coordenador *coordenador, char (*fragmentos)[256], ArestaSobreposta **arestas,
+                          int *quantidade)
+{
+    int capacidade = 0, sucesso = 1;
+    for (int i = 0; sucesso && i < coordenador->quantidadeRegioes; i++)
+    {
+        RegiaoCoordenada *regiao = &coordenador->regioes[i];
+        char (*nomes)[50];
+        int fronteiras = lerFronteiras(fragmentos[i], &nomes);
+        for (int j = 0; sucesso && j < fronteiras; j++)
+        {
+            char comando[128];
+            snprintf(comando, sizeof(comando), "FRONTEIRA\t%s\tSAIDA\n", nomes[j]);
+            int linhas = enviarComando(regiao, comando) ? lerCabecalho(regiao) : -2;
+            sucesso = linhas != -2;
+            ArestaSobreposta aresta;
+            aresta.origem = localizarFronteira(coordenador, nomes[j], 0);
+            for (int k = 0; sucesso && k < linhas; k++)
+            {
+                char *nome = lerAlcancada(regiao, &aresta.distancia, &aresta.pedagio);
+                sucesso = nome != NULL;
+                aresta.destino = sucesso ? localizarFronteira(coordenador, nome, 0) : -1;
+                if (aresta.destino >= 0 && aresta.destino != aresta.origem)
+                {
+                    sucesso = adicionarAresta(arestas, quantidade, &capacidade, aresta);
+                }
+            }
+        }
+        free(nomes);
+    }
+    return sucesso;
+}
+
+static int construirSobreposicao(Coordenador *coordenador, char (*fragmentos)[256])
+{
+    ArestaSobreposta *arestas = NULL;
+    int quantidade = 0;
+    if (!coletarArestas(coordenador, fragmentos, &arestas, &quantidade))
+    {
+        free(arestas);
+        return 0;
+    }
+
+    int vertices = coordenador->quantidadeVertices;
+    coordenador->primeiraAresta = calloc(vertices + 2, sizeof(int));
+    coordenador->destinos = malloc(sizeof(int) * (quantidade + 1));
+    coordenador->distancias = malloc(sizeof(double) * (quantidade + 1));
+    coordenador->pedagios = malloc(sizeof(double) * (quantidade + 1));
+    if (coordenador->primeiraAresta == NULL || coordenador->destinos == NULL || coordenador->distancias == NULL ||
+        coordenador->pedagios == NULL)
+    {
+        free(arestas);
+        return 0;
+    }
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        coordenador->primeiraAresta[arestas[i].origem + 2]++;
+    }
+    for (int v = 0; v < vertices; v++)
+    {
+        coordenador->primeiraAresta[v + 2] += coordenador->primeiraAresta[v + 1];
+    }
+    for (int i = 0; i < quantidade; i++)
+    {
+        int posicao = coordenador->primeiraAresta[arestas[i].origem + 1]++;
+        coordenador->destinos[posicao] = arestas[i].destino;
+        coordenador->distancias[posicao] = arestas[i].distancia;
+        coordenador->pedagios[posicao] = arestas[i].pedagio;
+    }
+    free(arestas);
+    printf("Sobreposição com %d cidades de fronteira e %d conexões entre regiões.\n", vertices, quantidade);
+    return 1;
+}
+
+static void inserirSobreposta(ConsultaCoordenada *consulta, double distancia, double pedagio, int vertice)
+{
+    EntradaSobreposta entrada = {distancia, pedagio, vertice};
+    int posicao = consulta->tamanhoHeap++;
+    while (posicao > 0)
+    {
+        EntradaSobreposta *pai = &consulta->heap[(posicao - 1) / 2];
+        if (!menorCusto(distancia, pedagio, pai->distancia, pai->pedagio))
+        {
+            break;
+        }
+        consulta->heap[posicao] = *pai;
+        posicao = (posicao - 1) / 2;
+    }
+    consulta->heap[posicao] = entrada;
+}
+
+static EntradaSobreposta retirarSobreposta(ConsultaCoordenada *consulta)
+{
+    EntradaSobreposta topo = consulta->heap[0];
+    EntradaSobreposta ultima = consulta->heap[--consulta->tamanhoHeap];
+    int posicao = 0;
+    for (;;)
+    {
+        int filho = 2 * posicao + 1;
+        if (filho >= consulta->tamanhoHeap)
+        {
+            break;
+        }
+        if (filho + 1 < consulta->tamanhoHeap &&
+            menorCusto(consulta->heap[filho + 1].distancia, consulta->heap[filho + 1].pedagio,
+                       consulta->heap[filho].distancia, consulta->heap[filho].pedagio))
+        {
+            filho++;
+        }
+        if (!menorCusto(consulta->heap[filho].distancia, consulta->heap[filho].pedagio, ultima.distancia,
+                        ultima.pedagio))
+        {
+            break;
+        }
+        consulta->heap[posicao] = consulta->heap[filho];
+        posicao = filho;
+    }
+    consulta->heap[posicao] = ultima;
+    return topo;
+}
+
+static int atualizarCusto(double *distancia, double *pedagio, double novaDistancia, double novoPedagio)
+{
+    if (!menorCusto(novaDistancia, novoPedagio, *distancia, *pedagio))
+    {
+        return 0;
+    }
+    *distancia = novaDistancia;
+    *pedagio = novoPedagio;
+    return 1;
+}
+
+static int lerExtremos(Coordenador *coordenador, ConsultaCoordenada *consulta, RegiaoCoordenada *regiao,
+                       char destino[])
+{
+    char chaveDestino[TAMANHO_CHAVE];
+    normalizarNome(destino, chaveDestino);
+    unsigned int hashDestino = calcularHash(chaveDestino);
+
+    for (int sentido = 0; sentido < 2; sentido++)
+    {
+        int linhas = lerCabecalho(regiao);
+        if (linhas == -2)
+        {
+            return 0;
+        }
+        if (linhas >= 0)
+        {
+            *(sentido == 0 ? &consulta->origemEncontrada : &consulta->destinoEncontrado) = 1;
+        }
+        for (int i = 0; i < linhas; i++)
+        {
+            double distancia, pedagio;
+            char *nome = lerAlcancada(regiao, &distancia, &pedagio);
+            if (nome == NULL)
+            {
+                return 0;
+            }
+            int vertice = localizarFronteira(coordenador, nome, 0);
+            if (sentido == 1)
+            {
+                if (vertice >= 0)
+                {
+                    atualizarCusto(&consulta->distanciasChegada[vertice], &consulta->pedagiosChegada[vertice],
+                                   distancia, pedagio);
+                }
+                continue;
+            }
+
+            char chave[TAMANHO_CHAVE];
+            normalizarNome(nome, chave);
+            if (mesmaChave(calcularHash(chave), chave, hashDestino, chaveDestino))
+            {
+                atualizarCusto(&consulta->distanciaDireta, &consulta->pedagioDireto, distancia, pedagio);
+            }
+            if (vertice >= 0 && atualizarCusto(&consulta->distancias[vertice], &consulta->pedagios[vertice],
+                                               distancia, pedagio))
+            {
+                inserirSobreposta(consulta, distancia, pedagio, vertice);
+            }
+        }
+    }
+    return 1;
+}
+
+static int consultarRegioes(Coordenador *coordenador, ConsultaCoordenada *consulta, char origem[], char destino[])
+{
+    char comando[256];
+    snprintf(comando, sizeof(comando), "FRONTEIRA\t%s\tSAIDA\t%s\nFRONTEIRA\t%s\tCHEGADA\n", origem, destino,
+             destino);
+
+    int enviadas = 0, sucesso = 1;
+    for (; enviadas < coordenador->quantidadeRegioes && sucesso; enviadas++)
+    {
+        pthread_mutex_lock(&coordenador->regioes[enviadas].trava);
+        sucesso = enviarComando(&coordenador->regioes[enviadas], comando);
+    }
+    for (int i = 0; i < enviadas; i++)
+    {
+        if (sucesso)
+        {
+            sucesso = lerExtremos(coordenador, consulta, &coordenador->regioes[i], destino);
+        }
+        pthread_mutex_unlock(&coordenador->regioes[i].trava);
+    }
+    return sucesso;
+}
+
+int distanciaCoordenada(Coordenador *coordenador, char origem[], char destino[], double *distancia,
+                        double *pedagio)
+{
+    int vertices = coordenador->quantidadeVertices;
+    ConsultaCoordenada consulta;
+    memset(&consulta, 0, sizeof(consulta));
+    consulta.distancias = malloc(sizeof(double) * (vertices + 1));
+    consulta.pedagios = malloc(sizeof(double) * (vertices + 1));
+    consulta.distanciasChegada = malloc(sizeof(double) * (vertices + 1));
+    consulta.pedagiosChegada = malloc(sizeof(double) * (vertices + 1));
+    consulta.fechados = calloc(vertices + 1, 1);
+    consulta.heap = malloc(sizeof(EntradaSobreposta) * (coordenador->primeiraAresta[vertices] +
+                                                             vertices * coordenador->quantidadeRegioes + 1));
+    consulta.distanciaDireta = consulta.pedagioDireto = INFINITY;
+
+    int situacao = CONSULTA_SEM_ROTA;
+    if (consulta.distancias != NULL && consulta.pedagios != NULL && consulta.distanciasChegada != NULL &&
+        consulta.pedagiosChegada != NULL && consulta.fechados != NULL && consulta.heap != NULL)
+    {
+        for (int v = 0; v <= vertices; v++)
+        {
+            consulta.distancias[v] = consulta.pedagios[v] = INFINITY;
+            consulta.distanciasChegada[v] = consulta.pedagiosChegada[v] = INFINITY;
+        }
+        if (consultarRegioes(coordenador, &consulta, origem, destino) &&
+            (!consulta.origemEncontrada || !consulta.destinoEncontrado))
+        {
+            situacao = CONSULTA_CIDADE_NAO_ENCONTRADA;
+        }
+    }
+
+    double melhorDistancia = consulta.distanciaDireta, melhorPedagio = consulta.pedagioDireto;
+    while (situacao == CONSULTA_SEM_ROTA && consulta.tamanhoHeap > 0)
+    {
+        EntradaSobreposta entrada = retirarSobreposta(&consulta);
+        int v = entrada.vertice;
+        if (consulta.fechados[v] || !menorCusto(entrada.distancia, entrada.pedagio, melhorDistancia, melhorPedagio))
+        {
+            continue;
+        }
+        consulta.fechados[v] = 1;
+        atualizarCusto(&melhorDistancia, &melhorPedagio, entrada.distancia + consulta.distanciasChegada[v],
+                       entrada.pedagio + consulta.pedagiosChegada[v]);
+
+        for (int e = coordenador->primeiraAresta[v]; e < coordenador->primeiraAresta[v + 1]; e++)
+        {
+            int w = coordenador->destinos[e];
+            double novaDistancia = entrada.distancia + coordenador->distancias[e];
+            double novoPedagio = entrada.pedagio + coordenador->pedagios[e];
+            if (!consulta.fechados[w] &&
+                atualizarCusto(&consulta.distancias[w], &consulta.pedagios[w], novaDistancia, novoPedagio))
+            {
+                inserirSobreposta(&consulta, novaDistancia, novoPedagio, w);
+            }
+        }
+    }
+
+    if (situacao == CONSULTA_SEM_ROTA && isfinite(melhorDistancia))
+    {
+        situacao = CONSULTA_OK;
+        *distancia = melhorDistancia;
+        *pedagio = melhorPedagio;
+    }
+    free(consulta.distancias);
+    free(consulta.pedagios);
+    free(consulta.distanciasChegada);
+    free(consulta.pedagiosChegada);
+    free(consulta.fechados);
+    free(consulta.heap);
+    return situacao;
+}
+
+int executarCoordenador(char manifesto[], char caminhoSocket[], int quantidadeTrabalhadores)
+{
+    char (*fragmentos)[256];
+    int quantidade = lerManifestoRegioes(manifesto, &fragmentos);
+    if (quantidade < 0)
+    {
+        printf("Erro ao ler o manifesto de regiões '%s'!\n", manifesto);
+        return 1;
+    }
+
+    Coordenador coordenador;
+    memset(&coordenador, 0, sizeof(coordenador));
+    coordenador.regioes = calloc(quantidade, sizeof(RegiaoCoordenada));
+    struct sockaddr_un endereco;
+    int sucesso = coordenador.regioes != NULL && strlen(caminhoSocket) + 4 < sizeof(endereco.sun_path);
+    obterKernelsNomes();
+    fflush(stdout);
+
+    for (int i = 0; sucesso && i < quantidade; i++)
+    {
+        RegiaoCoordenada *regiao = &coordenador.regioes[i];
+        char caminhoRegiao[128];
+        snprintf(caminhoRegiao, sizeof(caminhoRegiao), "%s.%d", caminhoSocket, i);
+        regiao->descritor = -1;
+        pthread_mutex_init(&regiao->trava, NULL);
+        coordenador.quantidadeRegioes++;
+        sucesso = iniciarRegiao(regiao, fragmentos[i], caminhoRegiao);
+        if (!sucesso)
+        {
+            printf("Erro ao iniciar o servidor da região %d ('%s')!\n", i, fragmentos[i]);
+        }
+    }
+    if (sucesso)
+    {
+        printf("%d região(ões) atendidas por processos próprios.\n", quantidade);
+        sucesso = carregarFronteiras(&coordenador, fragmentos) && construirSobreposicao(&coordenador, fragmentos);
+    }
+
+    int resultado = 1;
+    if (sucesso)
+    {
+        Servidor servidor;
+        iniciarServidor(&servidor);
+        servidor.coordenador = &coordenador;
+        resultado = atenderClientes(&servidor, caminhoSocket, quantidadeTrabalhadores);
+        liberarServidor(&servidor);
+    }
+    else
+    {
+        printf("Erro ao montar a rede coordenada!\n");
+    }
+
+    encerrarRegioes(&coordenador);
+    liberarCoordenador(&coordenador);
+    free(fragmentos);
+    if (resultado == 0)
+    {
+        printf("Coordenador encerrado.\n");
+    }
+    return resultado;
+}
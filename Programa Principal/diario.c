@@ -0,0 +1,515 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "estruturas.h"
+
+#define CABECALHO_REGISTRO 7
+
+static uint32_t verificarRegistro(unsigned char dados[], int tamanho)
+{
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < tamanho; i++)
+    {
+        hash ^= dados[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static int escreverTexto(unsigned char destino[], char texto[])
+{
+    int tamanho = strlen(texto);
+    destino[0] = (unsigned char)tamanho;
+    memcpy(destino + 1, texto, tamanho);
+    return tamanho + 1;
+}
+
+static int lerTexto(unsigned char origem[], int disponivel, char texto[])
+{
+    if (disponivel < 1 || origem[0] >= 50 || origem[0] + 1 > disponivel)
+    {
+        return -1;
+    }
+    memcpy(texto, origem + 1, origem[0]);
+    texto[origem[0]] = '\0';
+    return origem[0] + 1;
+}
+
+int codificarAlteracao(Alteracao *alteracao, unsigned char buffer[])
+{
+    unsigned char *corpo = buffer + CABECALHO_REGISTRO;
+    int tamanho = 0;
+
+    tamanho += escreverTexto(corpo + tamanho, alteracao->rodovia);
+    tamanho += escreverTexto(corpo + tamanho, alteracao->cidade1);
+    tamanho += escreverTexto(corpo + tamanho, alteracao->cidade2);
+    if (alteracao->tipo == ALTERACAO_TARIFA)
+    {
+        corpo[tamanho++] = (unsigned char)alteracao->classe;
+        corpo[tamanho++] = (unsigned char)(alteracao->inicio & 0xFF);
+        corpo[tamanho++] = (unsigned char)(alteracao->inicio >> 8);
+    }
+    memcpy(corpo + tamanho, &alteracao->valor, sizeof(int64_t));
+    tamanho += sizeof(int64_t);
+
+    buffer[4] = (unsigned char)(tamanho & 0xFF);
+    buffer[5] = (unsigned char)(tamanho >> 8);
+    buffer[6] = (unsigned char)alteracao->tipo;
+
+    uint32_t verificacao = verificarRegistro(buffer + 4, tamanho + 3);
+    memcpy(buffer, &verificacao, sizeof(uint32_t));
+    return tamanho + CABECALHO_REGISTRO;
+}
+
+int decodificarAlteracao(unsigned char buffer[], int disponivel, Alteracao *alteracao)
+{
+    if (disponivel < CABECALHO_REGISTRO)
+    {
+        return 0;
+    }
+
+    int tamanho = buffer[4] | (buffer[5] << 8);
+    if (tamanho + CABECALHO_REGISTRO > disponivel)
+    {
+        return 0;
+    }
+
+    uint32_t verificacao;
+    memcpy(&verificacao, buffer, sizeof(uint32_t));
+    if (verificacao != verificarRegistro(buffer + 4, tamanho + 3))
+    {
+        return -1;
+    }
+
+    unsigned char *corpo = buffer + CABECALHO_REGISTRO;
+    int lidos = 0, campo;
+    alteracao->tipo = buffer[6];
+    if ((campo = lerTexto(corpo + lidos, tamanho - lidos, alteracao->rodovia)) < 0)
+        return -1;
+    lidos += campo;
+    if ((campo = lerTexto(corpo + lidos, tamanho - lidos, alteracao->cidade1)) < 0)
+        return -1;
+    lidos += campo;
+    if ((campo = lerTexto(corpo + lidos, tamanho - lidos, alteracao->cidade2)) < 0)
+        return -1;
+    lidos += campo;
+    alteracao->classe = 0;
+    alteracao->inicio = 0;
+    if (alteracao->tipo == ALTERACAO_TARIFA)
+    {
+        if (lidos + 3 > tamanho)
+            return -1;
+        alteracao->classe = corpo[lidos];
+        alteracao->inicio = corpo[lidos + 1] | (corpo[lidos + 2] << 8);
+        lidos += 3;
+    }
+    if (lidos + (int)sizeof(int64_t) == tamanho)
+    {
+        memcpy(&alteracao->valor, corpo + lidos, sizeof(int64_t));
+    }
+    else if (lidos + (int)sizeof(float) == tamanho)
+    {
+        float legado;
+        memcpy(&legado, corpo + lidos, sizeof(float));
+        alteracao->valor = alteracao->tipo == ALTERACAO_INSERIR_CIDADE ? kmParaMetros(legado)
+                                                                        : reaisParaCentavos(legado);
+    }
+    else
+        return -1;
+
+    return tamanho + CABECALHO_REGISTRO;
+}
+
+int aplicarAlteracao(Rodovia **lista, Alteracao *alteracao)
+{
+    Rodovia *rodovia = buscarRodovia(*lista, alteracao->rodovia);
+
+    switch (alteracao->tipo)
+    {
+    case ALTERACAO_INSERIR_RODOVIA:
+        if (rodovia == NULL)
+        {
+            *lista = inserirRodovia(*lista, alteracao->rodovia);
+        }
+        return 1;
+
+    case ALTERACAO_REMOVER_RODOVIA:
+        *lista = removerRodovia(*lista, alteracao->rodovia);
+        return 1;
+
+    case ALTERACAO_INSERIR_CIDADE:
+        if (rodovia != NULL && buscarCidade(rodovia, alteracao->cidade1) == NULL)
+        {
+            inserirCidade(rodovia, alteracao->cidade1, alteracao->valor);
+        }
+        return 1;
+
+    case ALTERACAO_REMOVER_CIDADE:
+        if (rodovia != NULL && buscarCidade(rodovia, alteracao->cidade1) != NULL)
+        {
+            removerCidade(rodovia, alteracao->cidade1);
+        }
+        return 1;
+
+    case ALTERACAO_PEDAGIO:
+        if (rodovia != NULL)
+        {
+            adicionarPedagio(rodovia, alteracao->cidade1, alteracao->cidade2, alteracao->valor, SENTIDO_AMBOS);
+        }
+        return 1;
+
+    case ALTERACAO_TARIFA:
+        if (rodovia != NULL)
+        {
+            definirTarifaPedagio(rodovia, alteracao->cidade1, alteracao->cidade2, alteracao->classe,
+                                 alteracao->inicio, alteracao->valor);
+        }
+        return 1;
+
+    case ALTERACAO_DISTANCIA:
+        if (rodovia != NULL)
+        {
+            definirDistanciaTrecho(rodovia, alteracao->cidade1, alteracao->cidade2, alteracao->valor);
+        }
+        return 1;
+
+    case ALTERACAO_COORDENADAS:
+        definirCoordenadas(*lista, alteracao->cidade1, (Micrograus)(uint32_t)((uint64_t)alteracao->valor >> 32),
+                           (Micrograus)(uint32_t)alteracao->valor);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int reaplicarArquivoDiario(Rodovia **lista, char caminho[], long *descartados, int truncar)
+{
+    int descritor = open(caminho, truncar ? O_RDWR : O_RDONLY);
+    if (descritor < 0)
+    {
+        return 0;
+    }
+
+    off_t tamanhoArquivo = lseek(descritor, 0, SEEK_END);
+    unsigned char *dados = malloc(tamanhoArquivo > 0 ? tamanhoArquivo : 1);
+    if (dados == NULL || pread(descritor, dados, tamanhoArquivo, 0) != tamanhoArquivo)
+    {
+        free(dados);
+        close(descritor);
+        return 0;
+    }
+
+    int aplicadas = 0;
+    off_t posicao = 0;
+    while (posicao < tamanhoArquivo)
+    {
+        Alteracao alteracao;
+        int lidos = decodificarAlteracao(dados + posicao, tamanhoArquivo - posicao, &alteracao);
+        if (lidos <= 0)
+        {
+            break;
+        }
+        aplicadas += aplicarAlteracao(lista, &alteracao);
+        posicao += lidos;
+    }
+
+    if (posicao < tamanhoArquivo && (!truncar || ftruncate(descritor, posicao) == 0))
+    {
+        *descartados += tamanhoArquivo - posicao;
+    }
+
+    free(dados);
+    close(descritor);
+    return aplicadas;
+}
+
+int abrirDiario(Diario *diario, char nomeArquivo[], Rodovia **lista)
+{
+    snprintf(diario->arquivoDados, sizeof(diario->arquivoDados), "%s", nomeArquivo);
+    snprintf(diario->caminho, sizeof(diario->caminho), "%s.diario", nomeArquivo);
+    snprintf(diario->caminhoCompactacao, sizeof(diario->caminhoCompactacao), "%s.diario.1", nomeArquivo);
+    diario->compactador = 0;
+    diario->pendentes = 0;
+    diario->bytesDescartados = 0;
+    diario->falhaCompactacao = 0;
+    diario->alimentacao = -1;
+    diario->caminhoAlimentacao[0] = '\0';
+    diario->geracao = 0;
+    diario->registrosAlimentacao = 0;
+
+    int recuperadas = reaplicarArquivoDiario(lista, diario->caminhoCompactacao, &diario->bytesDescartados, 1);
+    recuperadas += reaplicarArquivoDiario(lista, diario->caminho, &diario->bytesDescartados, 1);
+    diario->pendentes = recuperadas;
+
+    diario->descritor = open(diario->caminho, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (diario->descritor < 0)
+    {
+        return -1;
+    }
+    return recuperadas;
+}
+
+int lerDiario(char nomeArquivo[], Rodovia **lista, long *ignorados)
+{
+    char caminho[300];
+    *ignorados = 0;
+    snprintf(caminho, sizeof(caminho), "%s.diario.1", nomeArquivo);
+    int recuperadas = reaplicarArquivoDiario(lista, caminho, ignorados, 0);
+    snprintf(caminho, sizeof(caminho), "%s.diario", nomeArquivo);
+    return recuperadas + reaplicarArquivoDiario(lista, caminho, ignorados, 0);
+}
+
+static void prepararAlteracao(Alteracao *alteracao, int tipo, char rodovia[], char cidade1[], char cidade2[],
+                              int64_t valor)
+{
+    alteracao->tipo = tipo;
+    snprintf(alteracao->rodovia, sizeof(alteracao->rodovia), "%s", rodovia);
+    snprintf(alteracao->cidade1, sizeof(alteracao->cidade1), "%s", cidade1 != NULL ? cidade1 : "");
+    snprintf(alteracao->cidade2, sizeof(alteracao->cidade2), "%s", cidade2 != NULL ? cidade2 : "");
+    alteracao->valor = valor;
+    alteracao->classe = 0;
+    alteracao->inicio = 0;
+}
+
+static int gravarAlteracao(Diario *diario, Alteracao *alteracao)
+{
+    unsigned char buffer[TAMANHO_MAXIMO_REGISTRO];
+    int tamanho = codificarAlteracao(alteracao, buffer);
+
+    if (diario->descritor >= 0)
+    {
+        if (write(diario->descritor, buffer, tamanho) != tamanho || fdatasync(diario->descritor) != 0)
+        {
+            return 0;
+        }
+        diario->pendentes++;
+    }
+
+    if (diario->alimentacao >= 0)
+    {
+        if (write(diario->alimentacao, buffer, tamanho) != tamanho)
+        {
+            return 0;
+        }
+        diario->registrosAlimentacao++;
+    }
+    return 1;
+}
+
+int registrarAlteracao(Diario *diario, int tipo, char rodovia[], char cidade1[], char cidade2[], int64_t valor)
+{
+    if (diario == NULL || (diario->descritor < 0 && diario->alimentacao < 0))
+    {
+        return 0;
+    }
+
+    Alteracao alteracao;
+    prepararAlteracao(&alteracao, tipo, rodovia, cidade1, cidade2, valor);
+    return gravarAlteracao(diario, &alteracao);
+}
+
+int registrarTarifa(Diario *diario, char rodovia[], char cidade1[], char cidade2[], int classe, int inicio,
+                    Centavos valor)
+{
+    if (diario == NULL || (diario->descritor < 0 && diario->alimentacao < 0))
+    {
+        return 0;
+    }
+
+    Alteracao alteracao;
+    prepararAlteracao(&alteracao, ALTERACAO_TARIFA, rodovia, cidade1, cidade2, valor);
+    alteracao.classe = classe;
+    alteracao.inicio = inicio;
+    return gravarAlteracao(diario, &alteracao);
+}
+
+int registrarCoordenadas(Diario *diario, char cidade[], Micrograus latitude, Micrograus longitude)
+{
+    if (diario == NULL || (diario->descritor < 0 && diario->alimentacao < 0))
+    {
+        return 0;
+    }
+
+    Alteracao alteracao;
+    prepararAlteracao(&alteracao, ALTERACAO_COORDENADAS, "", cidade, NULL,
+                      (int64_t)((uint64_t)(uint32_t)latitude << 32 | (uint32_t)longitude));
+    return gravarAlteracao(diario, &alteracao);
+}
+
+static void aguardarCompactacao(Diario *diario, int bloquear)
+{
+    if (diario->compactador <= 0)
+    {
+        return;
+    }
+
+    int status;
+    pid_t resultado = waitpid(diario->compactador, &status, bloquear ? 0 : WNOHANG);
+    if (resultado == diario->compactador)
+    {
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            diario->falhaCompactacao = 1;
+        }
+        diario->compactador = 0;
+    }
+}
+
+static int anexarArquivo(char origem[], char destino[])
+{
+    int entrada = open(origem, O_RDONLY);
+    int saida = open(destino, O_WRONLY | O_APPEND);
+    if (entrada < 0 || saida < 0)
+    {
+        if (entrada >= 0)
+            close(entrada);
+        if (saida >= 0)
+            close(saida);
+        return -1;
+    }
+
+    char bloco[65536];
+    ssize_t lidos;
+    int resultado = 0;
+    while ((lidos = read(entrada, bloco, sizeof(bloco))) > 0)
+    {
+        if (write(saida, bloco, lidos) != lidos)
+        {
+            resultado = -1;
+            break;
+        }
+    }
+    if (lidos < 0 || fsync(saida) != 0)
+    {
+        resultado = -1;
+    }
+
+    close(entrada);
+    close(saida);
+    return resultado;
+}
+
+static int escreverInstantaneo(Rodovia *lista, char nomeArquivo[])
+{
+    char temporario[300];
+    snprintf(temporario, sizeof(temporario), "%s.tmp", nomeArquivo);
+
+    if (imprimirRodoviasEmArquivo(lista, temporario) != RODOVIAS_OK)
+    {
+        unlink(temporario);
+        return -1;
+    }
+
+    int descritor = open(temporario, O_RDONLY);
+    if (descritor < 0 || fsync(descritor) != 0)
+    {
+        if (descritor >= 0)
+            close(descritor);
+        return -1;
+    }
+    close(descritor);
+
+    if (rename(temporario, nomeArquivo) != 0)
+    {
+        return -1;
+    }
+    return sincronizarDiretorio(nomeArquivo);
+}
+
+int compactarDiario(Diario *diario, Rodovia *lista, int aguardar)
+{
+    aguardarCompactacao(diario, 0);
+    if (diario->compactador > 0)
+    {
+        if (!aguardar)
+        {
+            return 0;
+        }
+        aguardarCompactacao(diario, 1);
+    }
+
+    if (access(diario->caminhoCompactacao, F_OK) == 0)
+    {
+        if (anexarArquivo(diario->caminho, diario->caminhoCompactacao) != 0)
+        {
+            return -1;
+        }
+        if (ftruncate(diario->descritor, 0) != 0)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        close(diario->descritor);
+        if (rename(diario->caminho, diario->caminhoCompactacao) != 0)
+        {
+            diario->descritor = open(diario->caminho, O_WRONLY | O_CREAT | O_APPEND, 0644);
+            return -1;
+        }
+        diario->descritor = open(diario->caminho, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    }
+
+    fflush(stdout);
+    pid_t processo = fork();
+    if (processo < 0)
+    {
+        if (escreverInstantaneo(lista, diario->arquivoDados) != 0)
+        {
+            return -1;
+        }
+        unlink(diario->caminhoCompactacao);
+    }
+    else if (processo == 0)
+    {
+        if (escreverInstantaneo(lista, diario->arquivoDados) != 0)
+        {
+            _exit(1);
+        }
+        unlink(diario->caminhoCompactacao);
+        _exit(0);
+    }
+    else
+    {
+        diario->compactador = processo;
+        if (aguardar)
+        {
+            aguardarCompactacao(diario, 1);
+        }
+    }
+
+    diario->pendentes = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        r->modificada = 0;
+    }
+    return 1;
+}
+
+void descartarDiario(Diario *diario)
+{
+    if (diario->descritor >= 0 && ftruncate(diario->descritor, 0) == 0)
+    {
+        diario->pendentes = 0;
+    }
+}
+
+void fecharDiario(Diario *diario)
+{
+    aguardarCompactacao(diario, 1);
+    if (diario->descritor >= 0)
+    {
+        close(diario->descritor);
+        diario->descritor = -1;
+    }
+    if (diario->alimentacao >= 0)
+    {
+        close(diario->alimentacao);
+        diario->alimentacao = -1;
+    }
+}
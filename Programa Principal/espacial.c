@@ -0,0 +1,333 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "estruturas.h"
+
+typedef struct BuscaEspacial
+{
+    IndiceEspacial *indice;
+    double alvo[3];
+    double limite;
+    VizinhoEspacial *heap;
+    int tamanhoHeap;
+    int maximo;
+} BuscaEspacial;
+
+static void converterPonto(Micrograus latitude, Micrograus longitude, double ponto[3])
+{
+    double phi = micrograusParaGraus(latitude) * M_PI / 180.0;
+    double lambda = micrograusParaGraus(longitude) * M_PI / 180.0;
+    ponto[0] = cos(phi) * cos(lambda);
+    ponto[1] = cos(phi) * sin(lambda);
+    ponto[2] = sin(phi);
+}
+
+static int localizarCidadeUnica(Cidade **unicas, int *tabela, int mascara, Cidade *cidade, int *quantidade)
+{
+    for (int posicao = cidade->hash & mascara;; posicao = (posicao + 1) & mascara)
+    {
+        int existente = tabela[posicao];
+        if (existente < 0)
+        {
+            tabela[posicao] = *quantidade;
+            unicas[(*quantidade)++] = cidade;
+            return 1;
+        }
+        if (mesmaChave(unicas[existente]->hash, unicas[existente]->chave, cidade->hash, cidade->chave))
+        {
+            return 0;
+        }
+    }
+}
+
+static void trocar(int ordem[], int i, int j)
+{
+    int temporario = ordem[i];
+    ordem[i] = ordem[j];
+    ordem[j] = temporario;
+}
+
+static void selecionarMediana(double (*pontos)[3], int ordem[], int inicio, int fim, int alvo, int eixo)
+{
+    while (fim - inicio > 1)
+    {
+        double pivo = pontos[ordem[(inicio + fim) / 2]][eixo];
+        int menores = inicio, atual = inicio, maiores = fim;
+        while (atual < maiores)
+        {
+            double valor = pontos[ordem[atual]][eixo];
+            if (valor < pivo)
+            {
+                trocar(ordem, menores++, atual++);
+            }
+            else if (valor > pivo)
+            {
+                trocar(ordem, atual, --maiores);
+            }
+            else
+            {
+                atual++;
+            }
+        }
+        if (alvo < menores)
+        {
+            fim = menores;
+        }
+        else if (alvo >= maiores)
+        {
+            inicio = maiores;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+static void dividirPontos(double (*pontos)[3], int ordem[], unsigned char eixos[], int inicio, int fim)
+{
+    if (fim - inicio < 2)
+    {
+        if (fim > inicio)
+        {
+            eixos[inicio] = 0;
+        }
+        return;
+    }
+
+    double minimo[3] = {INFINITY, INFINITY, INFINITY}, maximo[3] = {-INFINITY, -INFINITY, -INFINITY};
+    for (int i = inicio; i < fim; i++)
+    {
+        for (int e = 0; e < 3; e++)
+        {
+            minimo[e] = fmin(minimo[e], pontos[ordem[i]][e]);
+            maximo[e] = fmax(maximo[e], pontos[ordem[i]][e]);
+        }
+    }
+    int eixo = 0;
+    for (int e = 1; e < 3; e++)
+    {
+        if (maximo[e] - minimo[e] > maximo[eixo] - minimo[eixo])
+        {
+            eixo = e;
+        }
+    }
+
+    int meio = (inicio + fim) / 2;
+    selecionarMediana(pontos, ordem, inicio, fim, meio, eixo);
+    eixos[meio] = (unsigned char)eixo;
+    dividirPontos(pontos, ordem, eixos, inicio, meio);
+    dividirPontos(pontos, ordem, eixos, meio + 1, fim);
+}
+
+void liberarIndiceEspacial(IndiceEspacial *indice)
+{
+    if (indice == NULL)
+    {
+        return;
+    }
+    free(indice->pontos);
+    free(indice->eixos);
+    free(indice->latitudes);
+    free(indice->longitudes);
+    free(indice->nomes);
+    free(indice);
+}
+
+IndiceEspacial *construirIndiceEspacial(Rodovia *lista)
+{
+    int total = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima)
+        {
+            total += c->latitude != COORDENADA_INDEFINIDA;
+        }
+    }
+
+    int capacidadeTabela = 16;
+    while (capacidadeTabela < 2 * total)
+    {
+        capacidadeTabela *= 2;
+    }
+
+    IndiceEspacial *indice = calloc(1, sizeof(IndiceEspacial));
+    Cidade **unicas = malloc(sizeof(Cidade *) * (total + 1));
+    int *tabela = malloc(sizeof(int) * capacidadeTabela);
+    double (*pontos)[3] = malloc(sizeof(double[3]) * (total + 1));
+    int *ordem = malloc(sizeof(int) * (total + 1));
+    if (indice != NULL)
+    {
+        indice->pontos = malloc(sizeof(double[3]) * (total + 1));
+        indice->eixos = malloc(total + 1);
+        indice->latitudes = malloc(sizeof(Micrograus) * (total + 1));
+        indice->longitudes = malloc(sizeof(Micrograus) * (total + 1));
+        indice->nomes = malloc(sizeof(char[50]) * (total + 1));
+    }
+    if (indice == NULL || unicas == NULL || tabela == NULL || pontos == NULL || ordem == NULL ||
+        indice->pontos == NULL || indice->eixos == NULL || indice->latitudes == NULL || indice->longitudes == NULL ||
+        indice->nomes == NULL)
+    {
+        liberarIndiceEspacial(indice);
+        free(unicas);
+        free(tabela);
+        free(pontos);
+        free(ordem);
+        return NULL;
+    }
+
+    memset(tabela, -1, sizeof(int) * capacidadeTabela);
+    int quantidade = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima)
+        {
+            if (c->latitude != COORDENADA_INDEFINIDA &&
+                localizarCidadeUnica(unicas, tabela, capacidadeTabela - 1, c, &quantidade))
+            {
+                converterPonto(c->latitude, c->longitude, pontos[quantidade - 1]);
+                ordem[quantidade - 1] = quantidade - 1;
+            }
+        }
+    }
+
+    dividirPontos(pontos, ordem, indice->eixos, 0, quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        Cidade *cidade = unicas[ordem[i]];
+        memcpy(indice->pontos[i], pontos[ordem[i]], sizeof(double[3]));
+        indice->latitudes[i] = cidade->latitude;
+        indice->longitudes[i] = cidade->longitude;
+        strcpy(indice->nomes[i], cidade->nomeCidade);
+    }
+    indice->quantidade = quantidade;
+
+    free(unicas);
+    free(tabela);
+    free(pontos);
+    free(ordem);
+    return indice;
+}
+
+static int vizinhoMaisDistante(VizinhoEspacial *a, VizinhoEspacial *b)
+{
+    return a->corda > b->corda || (a->corda == b->corda && a->ponto > b->ponto);
+}
+
+static void descerHeap(VizinhoEspacial heap[], int tamanho, int posicao)
+{
+    for (;;)
+    {
+        int maior = posicao, esquerda = 2 * posicao + 1, direita = esquerda + 1;
+        if (esquerda < tamanho && vizinhoMaisDistante(&heap[esquerda], &heap[maior]))
+        {
+            maior = esquerda;
+        }
+        if (direita < tamanho && vizinhoMaisDistante(&heap[direita], &heap[maior]))
+        {
+            maior = direita;
+        }
+        if (maior == posicao)
+        {
+            return;
+        }
+        VizinhoEspacial temporario = heap[posicao];
+        heap[posicao] = heap[maior];
+        heap[maior] = temporario;
+        posicao = maior;
+    }
+}
+
+static void guardarVizinho(BuscaEspacial *busca, int ponto, double corda)
+{
+    VizinhoEspacial vizinho = {ponto, corda};
+    if (busca->tamanhoHeap < busca->maximo)
+    {
+        int posicao = busca->tamanhoHeap++;
+        while (posicao > 0 && vizinhoMaisDistante(&vizinho, &busca->heap[(posicao - 1) / 2]))
+        {
+            busca->heap[posicao] = busca->heap[(posicao - 1) / 2];
+            posicao = (posicao - 1) / 2;
+        }
+        busca->heap[posicao] = vizinho;
+    }
+    else if (vizinhoMaisDistante(&busca->heap[0], &vizinho))
+    {
+        busca->heap[0] = vizinho;
+        descerHeap(busca->heap, busca->tamanhoHeap, 0);
+    }
+
+    if (busca->tamanhoHeap == busca->maximo && busca->heap[0].corda < busca->limite)
+    {
+        busca->limite = busca->heap[0].corda;
+    }
+}
+
+static void buscarVizinhos(BuscaEspacial *busca, int inicio, int fim)
+{
+    while (inicio < fim)
+    {
+        int meio = (inicio + fim) / 2;
+        double *ponto = busca->indice->pontos[meio];
+        double dx = busca->alvo[0] - ponto[0], dy = busca->alvo[1] - ponto[1], dz = busca->alvo[2] - ponto[2];
+        double corda = dx * dx + dy * dy + dz * dz;
+        if (corda <= busca->limite)
+        {
+            guardarVizinho(busca, meio, corda);
+        }
+
+        double diferenca = busca->alvo[busca->indice->eixos[meio]] - ponto[busca->indice->eixos[meio]];
+        int pertoInicio = diferenca < 0 ? inicio : meio + 1, pertoFim = diferenca < 0 ? meio : fim;
+        int longeInicio = diferenca < 0 ? meio + 1 : inicio, longeFim = diferenca < 0 ? fim : meio;
+
+        buscarVizinhos(busca, pertoInicio, pertoFim);
+        if (diferenca * diferenca > busca->limite)
+        {
+            return;
+        }
+        inicio = longeInicio;
+        fim = longeFim;
+    }
+}
+
+int vizinhosEspaciais(IndiceEspacial *indice, Micrograus latitude, Micrograus longitude, double raioMetros,
+                      VizinhoEspacial vizinhos[], int maximo)
+{
+    if (indice->quantidade == 0 || maximo <= 0)
+    {
+        return 0;
+    }
+
+    BuscaEspacial busca;
+    busca.indice = indice;
+    converterPonto(latitude, longitude, busca.alvo);
+    busca.limite = INFINITY;
+    if (raioMetros < M_PI * RAIO_TERRA_METROS)
+    {
+        double corda = 2.0 * sin(raioMetros / (2.0 * RAIO_TERRA_METROS));
+        busca.limite = corda * corda * (1.0 + 1e-12);
+    }
+    busca.heap = vizinhos;
+    busca.tamanhoHeap = 0;
+    busca.maximo = maximo;
+    buscarVizinhos(&busca, 0, indice->quantidade);
+
+    int quantidade = busca.tamanhoHeap;
+    for (int tamanho = quantidade - 1; tamanho > 0; tamanho--)
+    {
+        VizinhoEspacial maior = vizinhos[0];
+        vizinhos[0] = vizinhos[tamanho];
+        vizinhos[tamanho] = maior;
+        descerHeap(vizinhos, tamanho, 0);
+    }
+    for (int i = 0; i < quantidade; i++)
+    {
+        vizinhos[i].corda = sqrt(vizinhos[i].corda);
+    }
+    return quantidade;
+}
+
+double cordaParaMetros(double corda)
+{
+    return 2.0 * RAIO_TERRA_METROS * asin(fmin(corda / 2.0, 1.0));
+}
@@ -0,0 +1,1412 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include "estruturas.h"
+
+#define MAXIMO_RODOVIAS_MODELO 24
+#define MAXIMO_CIDADES_MODELO 96
+#define NOMES_CIDADES_MODELO 80
+#define LEITORES_CONCORRENTES 4
+#define CIDADES_ENUMERACAO 9
+#define CAPACIDADE_ENUMERACAO 100000
+#define CIDADES_PESOS 1024
+#define ATUALIZACOES_POR_REMOCAO 16
+#define ATUALIZADORES_PESOS 3
+#define CIDADES_SOMA_EXATA 5000
+
+typedef struct RodoviaModelo
+{
+    char nome[50];
+    int quantidade;
+    char cidades[MAXIMO_CIDADES_MODELO][50];
+    Metros distancias[MAXIMO_CIDADES_MODELO];
+    Centavos ida[MAXIMO_CIDADES_MODELO];
+    Centavos volta[MAXIMO_CIDADES_MODELO];
+} RodoviaModelo;
+
+typedef struct Modelo
+{
+    RodoviaModelo rodovias[MAXIMO_RODOVIAS_MODELO];
+    int quantidade;
+    long operacoes[8];
+    long divergencias;
+    char primeiraDivergencia[256];
+} Modelo;
+
+enum OperacaoEstresse
+{
+    OPERACAO_INSERIR_RODOVIA,
+    OPERACAO_REMOVER_RODOVIA,
+    OPERACAO_INSERIR_CIDADE,
+    OPERACAO_REMOVER_CIDADE,
+    OPERACAO_PEDAGIO,
+    OPERACAO_PERCURSO,
+    OPERACAO_ALCANCE,
+    OPERACAO_ARQUIVO
+};
+
+static const char *nomesOperacoes[] = {"inserir rodovia", "remover rodovia", "inserir cidade", "remover cidade",
+                                       "pedágio", "percurso", "alcance", "arquivo"};
+
+static double agoraSegundos(void)
+{
+    struct timespec instante;
+    clock_gettime(CLOCK_MONOTONIC, &instante);
+    return instante.tv_sec + instante.tv_nsec / 1e9;
+}
+
+static void divergir(Modelo *modelo, const char *mensagem, const char *detalhe)
+{
+    if (modelo->divergencias++ == 0)
+    {
+        snprintf(modelo->primeiraDivergencia, sizeof(modelo->primeiraDivergencia), "%s (%s) após %ld operações",
+                 mensagem, detalhe, modelo->operacoes[0] + modelo->operacoes[1] + modelo->operacoes[2] +
+                                        modelo->operacoes[3] + modelo->operacoes[4] + modelo->operacoes[5] +
+                                        modelo->operacoes[6] + modelo->operacoes[7]);
+    }
+}
+
+static void gerarNomeRodovia(char nome[], unsigned int *semente)
+{
+    snprintf(nome, 50, rand_r(semente) % 4 ? "BR-%d" : "br-%d", (int)(rand_r(semente) % 40));
+}
+
+static void gerarNomeCidade(char nome[], unsigned int *semente)
+{
+    static const char *formatos[] = {"Cidade %d", "Cidade %d", "cidade %d", "CIDADE %d"};
+    snprintf(nome, 50, formatos[rand_r(semente) % 4], (int)(rand_r(semente) % NOMES_CIDADES_MODELO));
+}
+
+static int buscarRodoviaModelo(Modelo *modelo, char nome[])
+{
+    for (int i = 0; i < modelo->quantidade; i++)
+    {
+        if (strcasecmp(modelo->rodovias[i].nome, nome) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int buscarCidadeModelo(RodoviaModelo *rodovia, char nome[])
+{
+    for (int i = 0; i < rodovia->quantidade; i++)
+    {
+        if (strcasecmp(rodovia->cidades[i], nome) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static Centavos pedagioTrechoModelo(RodoviaModelo *rodovia, int indice, int sentido)
+{
+    if (sentido < 0 && rodovia->volta[indice] != PEDAGIO_INDEFINIDO)
+    {
+        return rodovia->volta[indice];
+    }
+    return rodovia->ida[indice];
+}
+
+static void escolherNomeCidade(RodoviaModelo *rodovia, char nome[], unsigned int *semente)
+{
+    if (rodovia->quantidade > 0 && rand_r(semente) % 4)
+    {
+        strcpy(nome, rodovia->cidades[rand_r(semente) % rodovia->quantidade]);
+    }
+    else
+    {
+        gerarNomeCidade(nome, semente);
+    }
+}
+
+static Rodovia *inserirRodoviaEstresse(Modelo *modelo, Rodovia *lista, unsigned int *semente)
+{
+    char nome[50];
+    gerarNomeRodovia(nome, semente);
+    if (modelo->quantidade == MAXIMO_RODOVIAS_MODELO)
+    {
+        return lista;
+    }
+
+    Rodovia *nova = inserirRodovia(lista, nome);
+    int esperado = buscarRodoviaModelo(modelo, nome) < 0;
+    if ((nova != lista) != esperado)
+    {
+        divergir(modelo, "inserirRodovia", nome);
+    }
+    if (nova != lista)
+    {
+        memmove(&modelo->rodovias[1], &modelo->rodovias[0], sizeof(RodoviaModelo) * modelo->quantidade);
+        memset(&modelo->rodovias[0], 0, sizeof(RodoviaModelo));
+        strcpy(modelo->rodovias[0].nome, nome);
+        modelo->quantidade++;
+    }
+    return nova;
+}
+
+static Rodovia *removerRodoviaEstresse(Modelo *modelo, Rodovia *lista, unsigned int *semente)
+{
+    char nome[50];
+    if (modelo->quantidade > 0 && rand_r(semente) % 2)
+    {
+        strcpy(nome, modelo->rodovias[rand_r(semente) % modelo->quantidade].nome);
+    }
+    else
+    {
+        gerarNomeRodovia(nome, semente);
+    }
+
+    int i = buscarRodoviaModelo(modelo, nome);
+    int encontrada = buscarRodovia(lista, nome) != NULL;
+    lista = removerRodovia(lista, nome);
+    if (encontrada != (i >= 0) || buscarRodovia(lista, nome) != NULL)
+    {
+        divergir(modelo, "removerRodovia", nome);
+    }
+    if (i >= 0)
+    {
+        memmove(&modelo->rodovias[i], &modelo->rodovias[i + 1], sizeof(RodoviaModelo) * (modelo->quantidade - i - 1));
+        modelo->quantidade--;
+    }
+    return lista;
+}
+
+static void inserirCidadeEstresse(Modelo *modelo, Rodovia *lista, unsigned int *semente)
+{
+    if (modelo->quantidade == 0)
+    {
+        return;
+    }
+    RodoviaModelo *esperada = &modelo->rodovias[rand_r(semente) % modelo->quantidade];
+    char nome[50];
+    gerarNomeCidade(nome, semente);
+    Metros distancia = (rand_r(semente) % 8000) * 250 + rand_r(semente) % 250;
+    if (esperada->quantidade == MAXIMO_CIDADES_MODELO)
+    {
+        return;
+    }
+
+    Rodovia *rodovia = buscarRodovia(lista, esperada->nome);
+    if (rodovia == NULL || inserirCidade(rodovia, nome, distancia) == NULL)
+    {
+        divergir(modelo, "inserirCidade", nome);
+        return;
+    }
+
+    int posicao = 0;
+    while (posicao < esperada->quantidade && esperada->distancias[posicao] <= distancia)
+    {
+        posicao++;
+    }
+    int deslocados = esperada->quantidade - posicao;
+    memmove(esperada->cidades[posicao + 1], esperada->cidades[posicao], sizeof(esperada->cidades[0]) * deslocados);
+    memmove(&esperada->distancias[posicao + 1], &esperada->distancias[posicao], sizeof(Metros) * deslocados);
+    memmove(&esperada->ida[posicao + 1], &esperada->ida[posicao], sizeof(Centavos) * deslocados);
+    memmove(&esperada->volta[posicao + 1], &esperada->volta[posicao], sizeof(Centavos) * deslocados);
+    strcpy(esperada->cidades[posicao], nome);
+    esperada->distancias[posicao] = distancia;
+    esperada->ida[posicao] = 0;
+    esperada->volta[posicao] = PEDAGIO_INDEFINIDO;
+    esperada->quantidade++;
+}
+
+static void removerCidadeEstresse(Modelo *modelo, Rodovia *lista, unsigned int *semente)
+{
+    if (modelo->quantidade == 0)
+    {
+        return;
+    }
+    RodoviaModelo *esperada = &modelo->rodovias[rand_r(semente) % modelo->quantidade];
+    char nome[50];
+    escolherNomeCidade(esperada, nome, semente);
+
+    Rodovia *rodovia = buscarRodovia(lista, esperada->nome);
+    int removida = rodovia != NULL && removerCidade(rodovia, nome) == RODOVIAS_OK;
+
+    int indice = buscarCidadeModelo(esperada, nome);
+    indice = indice < 0 ? esperada->quantidade : indice;
+    if (removida != (indice < esperada->quantidade))
+    {
+        divergir(modelo, "removerCidade", nome);
+    }
+    if (indice == esperada->quantidade)
+    {
+        return;
+    }
+
+    Centavos *ida = esperada->ida, *volta = esperada->volta;
+    if (indice > 0)
+    {
+        if (indice + 1 < esperada->quantidade)
+        {
+            if (volta[indice - 1] != PEDAGIO_INDEFINIDO || volta[indice] != PEDAGIO_INDEFINIDO)
+            {
+                volta[indice - 1] = pedagioTrechoModelo(esperada, indice - 1, -1) + pedagioTrechoModelo(esperada, indice, -1);
+            }
+            ida[indice - 1] += ida[indice];
+        }
+        else
+        {
+            ida[indice - 1] = 0;
+            volta[indice - 1] = PEDAGIO_INDEFINIDO;
+        }
+    }
+    int deslocados = esperada->quantidade - indice - 1;
+    memmove(esperada->cidades[indice], esperada->cidades[indice + 1], sizeof(esperada->cidades[0]) * deslocados);
+    memmove(&esperada->distancias[indice], &esperada->distancias[indice + 1], sizeof(Metros) * deslocados);
+    memmove(&ida[indice], &ida[indice + 1], sizeof(Centavos) * deslocados);
+    memmove(&volta[indice], &volta[indice + 1], sizeof(Centavos) * deslocados);
+    esperada->quantidade--;
+}
+
+static void pedagioEstresse(Modelo *modelo, Rodovia *lista, unsigned int *semente)
+{
+    if (modelo->quantidade == 0)
+    {
+        return;
+    }
+    RodoviaModelo *esperada = &modelo->rodovias[rand_r(semente) % modelo->quantidade];
+    Rodovia *rodovia = buscarRodovia(lista, esperada->nome);
+    char nome1[50], nome2[50];
+    escolherNomeCidade(esperada, nome1, semente);
+    escolherNomeCidade(esperada, nome2, semente);
+    Centavos valor = rand_r(semente) % 4000;
+
+    int a = buscarCidadeModelo(esperada, nome1), b = buscarCidadeModelo(esperada, nome2);
+    if (a >= 0 && a + 1 < esperada->quantidade && rand_r(semente) % 2)
+    {
+        strcpy(nome2, esperada->cidades[a + 1]);
+        b = buscarCidadeModelo(esperada, nome2);
+    }
+    int vizinhas = a >= 0 && b >= 0 && abs(a - b) == 1;
+    int sentido = rand_r(semente) % 3 - 1;
+    int adicionado = rodovia != NULL && adicionarPedagio(rodovia, nome1, nome2, valor, sentido) == RODOVIAS_OK;
+    if (adicionado != vizinhas)
+    {
+        divergir(modelo, "adicionarPedagio", nome1);
+    }
+    if (vizinhas)
+    {
+        int trecho = a < b ? a : b;
+        if (sentido != SENTIDO_VOLTA)
+        {
+            esperada->ida[trecho] = valor;
+        }
+        if (sentido != SENTIDO_IDA)
+        {
+            esperada->volta[trecho] = sentido == SENTIDO_VOLTA ? valor : PEDAGIO_INDEFINIDO;
+        }
+    }
+}
+
+static void percursoEstresse(Modelo *modelo, Rodovia *lista, unsigned int *semente)
+{
+    if (modelo->quantidade == 0)
+    {
+        return;
+    }
+    RodoviaModelo *esperada = &modelo->rodovias[rand_r(semente) % modelo->quantidade];
+    Rodovia *rodovia = buscarRodovia(lista, esperada->nome);
+    char nome1[50], nome2[50];
+    escolherNomeCidade(esperada, nome1, semente);
+    escolherNomeCidade(esperada, nome2, semente);
+
+    Centavos pedagio = 0, pedagioEsperado = 0;
+    Metros distancia = 0, distanciaEsperada = 0;
+    if (rodovia != NULL)
+    {
+        somarPercurso(rodovia, nome1, nome2, &pedagio, &distancia);
+    }
+
+    int a = buscarCidadeModelo(esperada, nome1), b = buscarCidadeModelo(esperada, nome2);
+    if (a >= 0 && b >= 0)
+    {
+        int sentido = a <= b ? 1 : -1;
+        for (int i = a; i != b; i += sentido)
+        {
+            int proxima = i + sentido;
+            distanciaEsperada += sentido * (esperada->distancias[proxima] - esperada->distancias[i]);
+            pedagioEsperado += pedagioTrechoModelo(esperada, sentido > 0 ? i : proxima, sentido);
+        }
+    }
+    if (pedagio != pedagioEsperado || distancia != distanciaEsperada)
+    {
+        divergir(modelo, "somarPercurso", nome1);
+    }
+
+    Centavos total = rodovia != NULL ? calcularPedagioTotal(rodovia) : 0, totalEsperado = 0;
+    for (int i = 0; i < esperada->quantidade; i++)
+    {
+        totalEsperado += esperada->ida[i];
+    }
+    if (total != totalEsperado)
+    {
+        divergir(modelo, "calcularPedagioTotal", esperada->nome);
+    }
+}
+
+static void verificarEstrutura(Modelo *modelo, Rodovia *lista)
+{
+    int i = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima, i++)
+    {
+        if (i >= modelo->quantidade)
+        {
+            divergir(modelo, "rodovia a mais na lista", r->nome);
+            return;
+        }
+        RodoviaModelo *esperada = &modelo->rodovias[i];
+        if (strcmp(r->nome, esperada->nome) != 0 || r->numeroCidades != esperada->quantidade)
+        {
+            divergir(modelo, "rodovia diferente do modelo", r->nome);
+            return;
+        }
+
+        int j = 0;
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima, j++)
+        {
+            if (j >= esperada->quantidade || c->indice != j || strcmp(c->nomeCidade, esperada->cidades[j]) != 0 ||
+                c->distancia != esperada->distancias[j] || r->pedagiosIda[j] != esperada->ida[j] ||
+                r->pedagiosVolta[j] != esperada->volta[j] || (c->proxima != NULL && c->proxima->anterior != c))
+            {
+                divergir(modelo, "cidade diferente do modelo", c->nomeCidade);
+                return;
+            }
+        }
+        if (j != esperada->quantidade)
+        {
+            divergir(modelo, "cidades faltando na lista", r->nome);
+        }
+    }
+    if (i != modelo->quantidade)
+    {
+        divergir(modelo, "rodovias faltando na lista", "");
+    }
+}
+
+static int verticeModelo(char (*nomes)[50], int quantidade, char nome[])
+{
+    for (int v = 0; v < quantidade; v++)
+    {
+        if (strcasecmp(nomes[v], nome) == 0)
+        {
+            return v;
+        }
+    }
+    return -1;
+}
+
+static void proximidadeEstresse(Modelo *modelo, Rodovia *lista, char (*nomes)[50], int quantidade,
+                                unsigned int *semente)
+{
+    static double pontos[MAXIMO_RODOVIAS_MODELO * MAXIMO_CIDADES_MODELO][3];
+    static double esperadas[MAXIMO_RODOVIAS_MODELO * MAXIMO_CIDADES_MODELO];
+    VizinhoEspacial vizinhos[8];
+    for (int v = 0; v < quantidade; v++)
+    {
+        Micrograus latitude = (Micrograus)(rand_r(semente) % 2000001) - 1000000 - 23000000;
+        Micrograus longitude = (Micrograus)(rand_r(semente) % 2000001) - 1000000 - 46000000;
+        definirCoordenadas(lista, nomes[v], latitude, longitude);
+        double phi = micrograusParaGraus(latitude) * M_PI / 180, lambda = micrograusParaGraus(longitude) * M_PI / 180;
+        pontos[v][0] = cos(phi) * cos(lambda);
+        pontos[v][1] = cos(phi) * sin(lambda);
+        pontos[v][2] = sin(phi);
+    }
+
+    IndiceEspacial *indice = construirIndiceEspacial(lista);
+    if (indice == NULL || indice->quantidade != quantidade)
+    {
+        divergir(modelo, "construirIndiceEspacial", "quantidade de pontos");
+        liberarIndiceEspacial(indice);
+        return;
+    }
+
+    for (int consulta = 0; consulta < 16; consulta++)
+    {
+        Micrograus latitude = (Micrograus)(rand_r(semente) % 2400001) - 1200000 - 23000000;
+        Micrograus longitude = (Micrograus)(rand_r(semente) % 2400001) - 1200000 - 46000000;
+        double raio = consulta % 2 == 0 ? INFINITY : (rand_r(semente) % 150000);
+        int maximo = 1 + rand_r(semente) % 8;
+        double phi = micrograusParaGraus(latitude) * M_PI / 180, lambda = micrograusParaGraus(longitude) * M_PI / 180;
+        double alvo[3] = {cos(phi) * cos(lambda), cos(phi) * sin(lambda), sin(phi)};
+
+        int dentro = 0;
+        for (int v = 0; v < quantidade; v++)
+        {
+            double dx = alvo[0] - pontos[v][0], dy = alvo[1] - pontos[v][1], dz = alvo[2] - pontos[v][2];
+            double metros = cordaParaMetros(sqrt(dx * dx + dy * dy + dz * dz));
+            if (metros <= raio * (1 - 1e-9))
+            {
+                int posicao = dentro++;
+                while (posicao > 0 && esperadas[posicao - 1] > metros)
+                {
+                    esperadas[posicao] = esperadas[posicao - 1];
+                    posicao--;
+                }
+                esperadas[posicao] = metros;
+            }
+        }
+
+        int obtidos = vizinhosEspaciais(indice, latitude, longitude, raio, vizinhos, maximo);
+        int minimo = dentro < maximo ? dentro : maximo;
+        if (obtidos < minimo || obtidos > maximo)
+        {
+            divergir(modelo, "vizinhosEspaciais", "quantidade de vizinhos");
+            break;
+        }
+        for (int i = 0; i < minimo; i++)
+        {
+            if (fabs(cordaParaMetros(vizinhos[i].corda) - esperadas[i]) > 0.01)
+            {
+                divergir(modelo, "vizinhosEspaciais", indice->nomes[vizinhos[i].ponto]);
+                break;
+            }
+        }
+    }
+    liberarIndiceEspacial(indice);
+}
+
+static void alcanceEstresse(Modelo *modelo, Rodovia *lista, BuscaAlcance *busca, unsigned int *semente)
+{
+    static char nomes[MAXIMO_RODOVIAS_MODELO * MAXIMO_CIDADES_MODELO][50];
+    static Metros distancias[MAXIMO_RODOVIAS_MODELO * MAXIMO_CIDADES_MODELO];
+    static unsigned char fechadas[MAXIMO_RODOVIAS_MODELO * MAXIMO_CIDADES_MODELO];
+    int quantidade = 0;
+    for (int r = 0; r < modelo->quantidade; r++)
+    {
+        for (int c = 0; c < modelo->rodovias[r].quantidade; c++)
+        {
+            if (verticeModelo(nomes, quantidade, modelo->rodovias[r].cidades[c]) < 0)
+            {
+                strcpy(nomes[quantidade++], modelo->rodovias[r].cidades[c]);
+            }
+        }
+    }
+
+    proximidadeEstresse(modelo, lista, nomes, quantidade, semente);
+
+    Grafo *grafo = construirGrafo(lista);
+    if (grafo == NULL || grafo->quantidadeVertices != quantidade)
+    {
+        divergir(modelo, "construirGrafo", "quantidade de vértices");
+        liberarGrafo(grafo);
+        return;
+    }
+    if (quantidade == 0 || !prepararBuscaAlcance(busca, grafo))
+    {
+        liberarGrafo(grafo);
+        return;
+    }
+
+    int origem = rand_r(semente) % quantidade;
+    for (int v = 0; v < quantidade; v++)
+    {
+        distancias[v] = CUSTO_INFINITO;
+        fechadas[v] = 0;
+    }
+    distancias[origem] = 0;
+    for (;;)
+    {
+        int atual = -1;
+        for (int v = 0; v < quantidade; v++)
+        {
+            if (!fechadas[v] && distancias[v] != CUSTO_INFINITO && (atual < 0 || distancias[v] < distancias[atual]))
+            {
+                atual = v;
+            }
+        }
+        if (atual < 0)
+        {
+            break;
+        }
+        fechadas[atual] = 1;
+
+        for (int r = 0; r < modelo->quantidade; r++)
+        {
+            RodoviaModelo *rodovia = &modelo->rodovias[r];
+            for (int c = 0; c < rodovia->quantidade; c++)
+            {
+                if (strcasecmp(rodovia->cidades[c], nomes[atual]) != 0)
+                {
+                    continue;
+                }
+                for (int vizinha = c - 1; vizinha <= c + 1; vizinha += 2)
+                {
+                    if (vizinha < 0 || vizinha >= rodovia->quantidade)
+                    {
+                        continue;
+                    }
+                    int v = verticeModelo(nomes, quantidade, rodovia->cidades[vizinha]);
+                    Metros candidata = distancias[atual] + llabs(rodovia->distancias[vizinha] - rodovia->distancias[c]);
+                    if (candidata < distancias[v])
+                    {
+                        distancias[v] = candidata;
+                    }
+                }
+            }
+        }
+    }
+
+    buscarAlcance(busca, buscarVertice(grafo, nomes[origem]), ALCANCE_DISTANCIA, CUSTO_INFINITO);
+    for (int v = 0; v < quantidade; v++)
+    {
+        int vertice = buscarVertice(grafo, nomes[v]);
+        Metros obtida = vertice >= 0 && busca->fechadas[vertice] == busca->geracao ? busca->distancias[vertice]
+                                                                                   : CUSTO_INFINITO;
+        if (obtida != distancias[v])
+        {
+            divergir(modelo, "buscarAlcance", nomes[v]);
+            break;
+        }
+    }
+    liberarGrafo(grafo);
+
+    conectarRodovias(lista);
+    conectarRodovias(lista);
+    ResultadoPercurso resultado;
+    if (consultarPercurso(lista, nomes[origem], nomes[origem], PARTIDA_INDEFINIDA, 0, &resultado) != CONSULTA_OK || resultado.distancia != 0)
+    {
+        divergir(modelo, "consultarPercurso", nomes[origem]);
+    }
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        liberarAdjacentes(r);
+    }
+}
+
+static void arquivoEstresse(Modelo *modelo, Rodovia *lista)
+{
+    char nomeArquivo[64];
+    snprintf(nomeArquivo, sizeof(nomeArquivo), "/tmp/estresse_rodovias_%d.txt", (int)getpid());
+    imprimirRodoviasEmArquivo(lista, nomeArquivo);
+
+    Rodovia *carregada = NULL;
+    carregarRodoviasDeArquivo(&carregada, nomeArquivo);
+    unlink(nomeArquivo);
+
+    int quantidade = 0;
+    for (Rodovia *r = carregada; r != NULL; r = r->proxima)
+    {
+        quantidade++;
+    }
+    if (quantidade != modelo->quantidade)
+    {
+        divergir(modelo, "arquivo", "quantidade de rodovias");
+    }
+
+    for (int i = 0; i < modelo->quantidade; i++)
+    {
+        RodoviaModelo *esperada = &modelo->rodovias[i];
+        Rodovia *r = buscarRodovia(carregada, esperada->nome);
+        if (r == NULL || r->numeroCidades != esperada->quantidade)
+        {
+            divergir(modelo, "arquivo", esperada->nome);
+            continue;
+        }
+        int j = 0;
+        Cidade *original = buscarRodovia(lista, esperada->nome)->cidades;
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima, original = original->proxima, j++)
+        {
+            if (strcmp(c->nomeCidade, esperada->cidades[j]) != 0 || c->distancia != esperada->distancias[j] ||
+                r->pedagiosIda[j] != esperada->ida[j] || r->pedagiosVolta[j] != esperada->volta[j] ||
+                c->latitude != original->latitude || c->longitude != original->longitude)
+            {
+                divergir(modelo, "arquivo", c->nomeCidade);
+                break;
+            }
+        }
+    }
+    liberarMemoria(carregada);
+}
+
+typedef struct TarefaConcorrente
+{
+    RedeRodovias *rede;
+    unsigned int semente;
+    long operacoes;
+    long falhas;
+} TarefaConcorrente;
+
+static void *escreverConcorrente(void *argumento)
+{
+    TarefaConcorrente *tarefa = argumento;
+    char rodovia[50], cidade1[50], cidade2[50];
+    for (long n = 0; n < tarefa->operacoes; n++)
+    {
+        gerarNomeRodovia(rodovia, &tarefa->semente);
+        gerarNomeCidade(cidade1, &tarefa->semente);
+        gerarNomeCidade(cidade2, &tarefa->semente);
+        int status;
+        switch (rand_r(&tarefa->semente) % 8)
+        {
+        case 0:
+            status = inserirRodoviaRede(tarefa->rede, rodovia);
+            tarefa->falhas += status != RODOVIAS_OK && status != RODOVIAS_RODOVIA_EXISTENTE;
+            break;
+        case 1:
+            status = removerRodoviaRede(tarefa->rede, rodovia);
+            tarefa->falhas += status != RODOVIAS_OK && status != RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+            break;
+        case 2:
+        case 3:
+            status = inserirCidadeRede(tarefa->rede, rodovia, cidade1, (double)(rand_r(&tarefa->semente) % 1000));
+            tarefa->falhas += status == RODOVIAS_ERRO_MEMORIA || status == RODOVIAS_ARGUMENTO_INVALIDO;
+            break;
+        case 4:
+            status = removerCidadeRede(tarefa->rede, rodovia, cidade1);
+            tarefa->falhas += status == RODOVIAS_ERRO_MEMORIA || status == RODOVIAS_ARGUMENTO_INVALIDO;
+            break;
+        case 5:
+            status = definirPedagioRede(tarefa->rede, rodovia, cidade1, cidade2,
+                                        (double)(rand_r(&tarefa->semente) % 20));
+            tarefa->falhas += status == RODOVIAS_ERRO_MEMORIA;
+            break;
+        case 6:
+            status = interditarTrechoRede(tarefa->rede, rodovia, cidade1, cidade2, rand_r(&tarefa->semente) % 2);
+            tarefa->falhas += status == RODOVIAS_ERRO_MEMORIA || status == RODOVIAS_ARGUMENTO_INVALIDO;
+            break;
+        case 7:
+            tarefa->falhas += n % 64 == 0 && compactarRede(tarefa->rede) != RODOVIAS_OK;
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void *lerConcorrente(void *argumento)
+{
+    TarefaConcorrente *tarefa = argumento;
+    InfoRotas *rotas = malloc(sizeof(InfoRotas));
+    InfoAlcance *alcancadas = malloc(sizeof(InfoAlcance) * 64);
+    InfoCidade cidades[MAXIMO_CIDADES_MODELO];
+    InfoRestricoes restricoes;
+    memset(&restricoes, 0, sizeof(restricoes));
+    if (rotas == NULL || alcancadas == NULL)
+    {
+        tarefa->falhas++;
+        free(rotas);
+        free(alcancadas);
+        return NULL;
+    }
+
+    char rodovia[50], cidade1[50], cidade2[50];
+    for (long n = 0; n < tarefa->operacoes; n++)
+    {
+        gerarNomeRodovia(rodovia, &tarefa->semente);
+        gerarNomeCidade(cidade1, &tarefa->semente);
+        gerarNomeCidade(cidade2, &tarefa->semente);
+        int status, quantidade;
+        InfoPercurso percurso;
+        switch (rand_r(&tarefa->semente) % 4)
+        {
+        case 0:
+            status = consultarPercursoRede(tarefa->rede, cidade1, cidade2, &percurso);
+            tarefa->falhas += status != RODOVIAS_OK && status != RODOVIAS_SEM_ROTA &&
+                              status != RODOVIAS_CIDADE_NAO_ENCONTRADA;
+            break;
+        case 1:
+            restricoes.pedagioMaximoTrecho = rand_r(&tarefa->semente) % 20 - 1;
+            strcpy(restricoes.rodoviasEvitadas[0], rodovia);
+            restricoes.quantidadeRodoviasEvitadas = rand_r(&tarefa->semente) % 2;
+            status = rotasRestritasRede(tarefa->rede, cidade1, cidade2, ROTA_PARETO, 0, 0, &restricoes, rotas);
+            tarefa->falhas += status != RODOVIAS_OK && status != RODOVIAS_SEM_ROTA &&
+                              status != RODOVIAS_CIDADE_NAO_ENCONTRADA && status != RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+            status = rotasAlternativasRede(tarefa->rede, cidade1, cidade2, ROTA_PARETO, 0, 0, rotas);
+            tarefa->falhas += status != RODOVIAS_OK && status != RODOVIAS_SEM_ROTA &&
+                              status != RODOVIAS_CIDADE_NAO_ENCONTRADA;
+            break;
+        case 2:
+            status = cidadesAlcancaveisRede(tarefa->rede, cidade1, ALCANCE_DISTANCIA, 300, alcancadas, 64,
+                                            &quantidade);
+            tarefa->falhas += status != RODOVIAS_OK && status != RODOVIAS_CIDADE_NAO_ENCONTRADA;
+            break;
+        case 3:
+            status = listarCidadesRede(tarefa->rede, rodovia, cidades, MAXIMO_CIDADES_MODELO, &quantidade);
+            tarefa->falhas += status != RODOVIAS_OK && status != RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+            for (int i = 1; i < quantidade && i < MAXIMO_CIDADES_MODELO; i++)
+            {
+                tarefa->falhas += cidades[i].distancia < cidades[i - 1].distancia;
+            }
+            break;
+        }
+    }
+    free(rotas);
+    free(alcancadas);
+    return NULL;
+}
+
+static long concorrenciaEstresse(long operacoes, unsigned int semente)
+{
+    RedeRodovias *rede = criarRede();
+    if (rede == NULL)
+    {
+        return 1;
+    }
+
+    pthread_t threads[LEITORES_CONCORRENTES + 1];
+    TarefaConcorrente tarefas[LEITORES_CONCORRENTES + 1];
+    for (int i = 0; i <= LEITORES_CONCORRENTES; i++)
+    {
+        tarefas[i].rede = rede;
+        tarefas[i].semente = semente + i;
+        tarefas[i].operacoes = operacoes;
+        tarefas[i].falhas = 0;
+        pthread_create(&threads[i], NULL, i == 0 ? escreverConcorrente : lerConcorrente, &tarefas[i]);
+    }
+
+    long falhas = 0;
+    for (int i = 0; i <= LEITORES_CONCORRENTES; i++)
+    {
+        pthread_join(threads[i], NULL);
+        falhas += tarefas[i].falhas;
+    }
+    destruirRede(rede);
+    return falhas;
+}
+
+static int rotaConsistente(RedeRodovias *rede, InfoRota *rota, char origem[], char destino[])
+{
+    if (rota->quantidadeTrechos < 1 || strcasecmp(rota->trechos[0].origem, origem) != 0 ||
+        strcasecmp(rota->trechos[rota->quantidadeTrechos - 1].destino, destino) != 0)
+    {
+        return 0;
+    }
+    for (int i = 0; i < rota->quantidadeTrechos; i++)
+    {
+        InfoTrecho *trecho = &rota->trechos[i];
+        Rodovia *r = buscarRodovia(rede->lista, trecho->rodovia);
+        if (r == NULL || buscarCidade(r, trecho->origem) == NULL || buscarCidade(r, trecho->destino) == NULL ||
+            (i > 0 && strcmp(rota->trechos[i - 1].destino, trecho->origem) != 0))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static long conferirRotasRede(RedeRodovias *rede, char origem[], char destino[], InfoRotas *info)
+{
+    int status = rotasAlternativasRede(rede, origem, destino, ROTA_PARETO, 0, 0, info);
+    pthread_rwlock_rdlock(&rede->trava);
+    Grafo *grafo = construirGrafo(rede->lista);
+    int inicio = grafo != NULL ? buscarVertice(grafo, origem) : -1;
+    int fim = grafo != NULL ? buscarVertice(grafo, destino) : -1;
+    long divergencias = grafo == NULL;
+    if (grafo != NULL && (inicio < 0 || fim < 0))
+    {
+        divergencias = status != RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    else if (grafo != NULL)
+    {
+        BuscaRotas busca;
+        RotaAlternativa rotas[MAXIMO_ROTAS_ALTERNATIVAS];
+        iniciarBuscaRotas(&busca, grafo, LIMITE_ROTULOS_ROTAS);
+        int quantidade = rotasPareto(&busca, inicio, fim, rotas, MAXIMO_ROTAS_ALTERNATIVAS);
+        divergencias = status != (quantidade > 0 ? RODOVIAS_OK : RODOVIAS_SEM_ROTA) ||
+                       (status == RODOVIAS_OK && quantidade != info->quantidade);
+        for (int i = 0; !divergencias && i < quantidade; i++)
+        {
+            divergencias = rotas[i].distancia != kmParaMetros(info->rotas[i].distancia) ||
+                           rotas[i].pedagio != reaisParaCentavos(info->rotas[i].pedagio) ||
+                           (inicio != fim && !rotaConsistente(rede, &info->rotas[i], origem, destino));
+        }
+        liberarBuscaRotas(&busca);
+    }
+    liberarGrafo(grafo);
+    pthread_rwlock_unlock(&rede->trava);
+    return divergencias;
+}
+
+typedef struct TarefaCompactacao
+{
+    RedeRodovias *rede;
+    int encerrar;
+    long falhas;
+} TarefaCompactacao;
+
+static void *compactarContinuamente(void *argumento)
+{
+    TarefaCompactacao *tarefa = argumento;
+    while (!__atomic_load_n(&tarefa->encerrar, __ATOMIC_ACQUIRE))
+    {
+        tarefa->falhas += compactarRede(tarefa->rede) != RODOVIAS_OK;
+        sched_yield();
+    }
+    return NULL;
+}
+
+static int trechoNaRodovia(RedeRodovias *rede, char rodovia[], char cidade1[], char cidade2[], unsigned int *semente)
+{
+    pthread_rwlock_rdlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, rodovia);
+    Cidade *c = r != NULL ? buscarCidade(r, cidade1) : NULL;
+    if (c == NULL && r != NULL && r->numeroCidades > 0)
+    {
+        c = r->cidades;
+        for (int i = rand_r(semente) % r->numeroCidades; i > 0; i--)
+        {
+            c = c->proxima;
+        }
+    }
+    Cidade *vizinha = c == NULL ? NULL : c->proxima != NULL ? c->proxima : c->anterior;
+    if (vizinha != NULL)
+    {
+        strcpy(cidade1, c->nomeCidade);
+        strcpy(cidade2, vizinha->nomeCidade);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return vizinha != NULL;
+}
+
+static long lapidesEstresse(long operacoes, unsigned int semente, long *compactacoes)
+{
+    RedeRodovias *rede = criarRede();
+    InfoRotas *info = malloc(sizeof(InfoRotas));
+    if (rede == NULL || info == NULL)
+    {
+        destruirRede(rede);
+        free(info);
+        return 1;
+    }
+
+    TarefaCompactacao compactacao = {rede, 0, 0};
+    pthread_t compactador;
+    int iniciado = pthread_create(&compactador, NULL, compactarContinuamente, &compactacao) == 0;
+
+    char rodovia[50], cidade1[50], cidade2[50];
+    long divergencias = !iniciado;
+    for (long n = 0; n < operacoes; n++)
+    {
+        gerarNomeRodovia(rodovia, &semente);
+        gerarNomeCidade(cidade1, &semente);
+        gerarNomeCidade(cidade2, &semente);
+        int sorteio = rand_r(&semente) % 100;
+        if (n < operacoes / 4 || sorteio < 10)
+        {
+            inserirRodoviaRede(rede, rodovia);
+            inserirCidadeRede(rede, rodovia, cidade1, (double)(rand_r(&semente) % 1000));
+        }
+        else if (sorteio < 15)
+        {
+            removerRodoviaRede(rede, rodovia);
+        }
+        else if (sorteio < 50)
+        {
+            removerCidadeRede(rede, rodovia, cidade1);
+        }
+        else if (sorteio < 51)
+        {
+            divergencias += compactarRede(rede) != RODOVIAS_OK;
+        }
+        if ((n < operacoes / 4 || sorteio < 10 || sorteio >= 51) &&
+            trechoNaRodovia(rede, rodovia, cidade1, cidade2, &semente))
+        {
+            divergencias += definirPedagioRede(rede, rodovia, cidade1, cidade2, (double)(rand_r(&semente) % 20)) !=
+                            RODOVIAS_OK;
+        }
+        if (n >= operacoes / 4)
+        {
+            divergencias += conferirRotasRede(rede, cidade1, cidade2, info);
+        }
+    }
+
+    __atomic_store_n(&compactacao.encerrar, 1, __ATOMIC_RELEASE);
+    if (iniciado)
+    {
+        pthread_join(compactador, NULL);
+    }
+    *compactacoes = rede->compactacoes;
+    destruirRede(rede);
+    free(info);
+    return divergencias + compactacao.falhas;
+}
+
+static int trechoAtualizado(RedeRodovias *rede, int trecho, double distancia, double pedagio, InfoRotas *info)
+{
+    char cidade1[50], cidade2[50];
+    snprintf(cidade1, sizeof(cidade1), "Cidade %d", trecho);
+    snprintf(cidade2, sizeof(cidade2), "Cidade %d", trecho + 1);
+    int status = rotasAlternativasRede(rede, cidade1, cidade2, ROTA_PARETO, 0, 0, info);
+    return status == RODOVIAS_OK && info->quantidade == 1 && fabs(info->rotas[0].distancia - distancia) <= 1e-3 &&
+           fabs(info->rotas[0].pedagio - pedagio) <= 1e-3;
+}
+
+typedef struct TarefaPesos
+{
+    RedeRodovias *rede;
+    unsigned int semente;
+    long operacoes;
+    int indice;
+    double *distancias;
+    double *pedagios;
+    long divergencias;
+} TarefaPesos;
+
+static void *atualizarPesosConcorrente(void *argumento)
+{
+    TarefaPesos *tarefa = argumento;
+    InfoRotas *info = malloc(sizeof(InfoRotas));
+    if (info == NULL)
+    {
+        tarefa->divergencias++;
+        return NULL;
+    }
+
+    char cidade1[50], cidade2[50], anexo[50];
+    int anterior = tarefa->indice;
+    for (long n = 0; n < tarefa->operacoes; n++)
+    {
+        if (n % ATUALIZACOES_POR_REMOCAO == 0)
+        {
+            snprintf(anexo, sizeof(anexo), "Anexo %d-%ld", tarefa->indice, n);
+            removerRodoviaRede(tarefa->rede, anexo);
+        }
+
+        int trecho = tarefa->indice + ATUALIZADORES_PESOS * (rand_r(&tarefa->semente) % (CIDADES_PESOS /
+                                                                                       ATUALIZADORES_PESOS - 1));
+        snprintf(cidade1, sizeof(cidade1), "Cidade %d", trecho);
+        snprintf(cidade2, sizeof(cidade2), "Cidade %d", trecho + 1);
+        tarefa->pedagios[trecho] = rand_r(&tarefa->semente) % 100;
+        if (n % 2 == 0)
+        {
+            tarefa->divergencias += definirPedagioRede(tarefa->rede, "BR-0", cidade1, cidade2,
+                                                       tarefa->pedagios[trecho]) != RODOVIAS_OK;
+        }
+        else
+        {
+            InfoAtualizacaoTrecho atualizacao = {"BR-0", "", "", 1 + rand_r(&tarefa->semente) % 100,
+                                                 tarefa->pedagios[trecho]};
+            strcpy(atualizacao.cidade1, cidade1);
+            strcpy(atualizacao.cidade2, cidade2);
+            tarefa->distancias[trecho] = atualizacao.distancia;
+            tarefa->divergencias += atualizarTrechosRede(tarefa->rede, &atualizacao, 1, NULL) != RODOVIAS_OK;
+        }
+
+        tarefa->divergencias +=
+            !trechoAtualizado(tarefa->rede, anterior, tarefa->distancias[anterior], tarefa->pedagios[anterior], info);
+        anterior = trecho;
+    }
+    free(info);
+    return NULL;
+}
+
+static long pesosCompactacaoEstresse(long operacoes, unsigned int semente, long *compactacoes)
+{
+    RedeRodovias *rede = criarRede();
+    InfoRotas *info = malloc(sizeof(InfoRotas));
+    if (rede == NULL || info == NULL)
+    {
+        destruirRede(rede);
+        free(info);
+        return 1;
+    }
+
+    static double distancias[CIDADES_PESOS], pedagios[CIDADES_PESOS];
+    char cidade[50];
+    inserirRodoviaRede(rede, "BR-0");
+    for (int i = 0; i < CIDADES_PESOS; i++)
+    {
+        snprintf(cidade, sizeof(cidade), "Cidade %d", i);
+        inserirCidadeRede(rede, "BR-0", cidade, i * 10.0);
+        distancias[i] = 10.0;
+        pedagios[i] = 0;
+    }
+
+    long operacoesPorTarefa = operacoes / ATUALIZADORES_PESOS + 1;
+    for (int i = 0; i < ATUALIZADORES_PESOS; i++)
+    {
+        for (long n = 0; n < operacoesPorTarefa; n += ATUALIZACOES_POR_REMOCAO)
+        {
+            char anexo[50];
+            snprintf(anexo, sizeof(anexo), "Anexo %d-%ld", i, n);
+            snprintf(cidade, sizeof(cidade), "Vila %d-%ld", i, n);
+            inserirRodoviaRede(rede, anexo);
+            inserirCidadeRede(rede, anexo, cidade, 0);
+        }
+    }
+    rotasAlternativasRede(rede, "Cidade 0", "Cidade 1", ROTA_PARETO, 0, 0, info);
+
+    TarefaCompactacao compactacao = {rede, 0, 0};
+    pthread_t compactador, atualizadores[ATUALIZADORES_PESOS];
+    TarefaPesos tarefas[ATUALIZADORES_PESOS];
+    int iniciado = pthread_create(&compactador, NULL, compactarContinuamente, &compactacao) == 0;
+    for (int i = 0; i < ATUALIZADORES_PESOS; i++)
+    {
+        tarefas[i] = (TarefaPesos){rede, semente + i, operacoesPorTarefa, i, distancias, pedagios, 0};
+        pthread_create(&atualizadores[i], NULL, atualizarPesosConcorrente, &tarefas[i]);
+    }
+
+    long divergencias = !iniciado;
+    for (int i = 0; i < ATUALIZADORES_PESOS; i++)
+    {
+        pthread_join(atualizadores[i], NULL);
+        divergencias += tarefas[i].divergencias;
+    }
+    __atomic_store_n(&compactacao.encerrar, 1, __ATOMIC_RELEASE);
+    if (iniciado)
+    {
+        pthread_join(compactador, NULL);
+    }
+    Metros distanciaTotal = 0;
+    Centavos pedagioTotal = 0;
+    for (int trecho = 0; trecho < CIDADES_PESOS - 1; trecho++)
+    {
+        distanciaTotal += kmParaMetros(distancias[trecho]);
+        pedagioTotal += reaisParaCentavos(pedagios[trecho]);
+    }
+    snprintf(cidade, sizeof(cidade), "Cidade %d", CIDADES_PESOS - 1);
+    int status = rotasAlternativasRede(rede, "Cidade 0", cidade, ROTA_PARETO, 0, 0, info);
+    divergencias += status != RODOVIAS_OK || info->quantidade != 1 ||
+                    kmParaMetros(info->rotas[0].distancia) != distanciaTotal ||
+                    reaisParaCentavos(info->rotas[0].pedagio) != pedagioTotal;
+
+    *compactacoes = rede->compactacoes;
+    destruirRede(rede);
+    free(info);
+    return divergencias + compactacao.falhas;
+}
+
+static int compararCustos(const void *a, const void *b)
+{
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int64_t custoPonderado(int pesos[], Metros distancia, Centavos pedagio)
+{
+    return pesos[0] * distancia + pesos[1] * pedagio * (METROS_POR_KM / CENTAVOS_POR_REAL);
+}
+
+static int enumerarCaminhos(Grafo *grafo, int v, int destino, Metros distancia, Centavos pedagio, int pesos[],
+                            unsigned char visitados[], int64_t custos[], int quantidade)
+{
+    if (v == destino)
+    {
+        if (quantidade < CAPACIDADE_ENUMERACAO)
+        {
+            custos[quantidade] = custoPonderado(pesos, distancia, pedagio);
+        }
+        return quantidade + 1;
+    }
+    visitados[v] = 1;
+    for (int e = grafo->primeiraAresta[v]; e < grafo->primeiraAresta[v + 1]; e++)
+    {
+        int w = grafo->destinos[e];
+        if (!visitados[w])
+        {
+            quantidade = enumerarCaminhos(grafo, w, destino, distancia + grafo->distancias[e],
+                                          pedagio + grafo->pedagios[e], pesos, visitados, custos, quantidade);
+        }
+    }
+    visitados[v] = 0;
+    return quantidade;
+}
+
+static int rotasDistintasESimples(BuscaRotas *busca, RotaAlternativa rotas[], int quantidade, int origem)
+{
+    static int arestas[MAXIMO_ROTAS_ALTERNATIVAS][CIDADES_ENUMERACAO];
+    int usadas[MAXIMO_ROTAS_ALTERNATIVAS];
+    for (int i = 0; i < quantidade; i++)
+    {
+        unsigned char visitados[CIDADES_ENUMERACAO] = {0};
+        usadas[i] = arestasDaRota(busca, &rotas[i], arestas[i], CIDADES_ENUMERACAO);
+        visitados[origem] = 1;
+        for (int j = 0; j < usadas[i]; j++)
+        {
+            int w = busca->grafo->destinos[arestas[i][j]];
+            if (visitados[w]++)
+            {
+                return 0;
+            }
+        }
+        for (int j = 0; j < i; j++)
+        {
+            if (usadas[j] == usadas[i] && memcmp(arestas[j], arestas[i], sizeof(int) * usadas[i]) == 0)
+            {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static long melhoresRotasEstresse(long consultas, unsigned int semente)
+{
+    int64_t *custos = malloc(sizeof(int64_t) * CAPACIDADE_ENUMERACAO);
+    if (custos == NULL)
+    {
+        return 1;
+    }
+    long divergencias = 0;
+    for (long n = 0; n < consultas; n++)
+    {
+        Rodovia *lista = NULL;
+        for (int r = 0, rodovias = 2 + rand_r(&semente) % 5; r < rodovias; r++)
+        {
+            char nome[50];
+            snprintf(nome, sizeof(nome), "BR-%d", r);
+            lista = inserirRodovia(lista, nome);
+            Metros distancia = 0;
+            for (int c = 0, cidades = 2 + rand_r(&semente) % 4; c < cidades; c++)
+            {
+                snprintf(nome, sizeof(nome), "Cidade %d", rand_r(&semente) % CIDADES_ENUMERACAO);
+                distancia += 1 + rand_r(&semente) % 100000;
+                Cidade *cidade = buscarCidade(lista, nome) == NULL ? inserirCidade(lista, nome, distancia) : NULL;
+                if (cidade != NULL && cidade->anterior != NULL)
+                {
+                    lista->pedagiosIda[cidade->anterior->indice] = rand_r(&semente) % 2000;
+                    lista->pedagiosVolta[cidade->anterior->indice] = rand_r(&semente) % 2000;
+                }
+            }
+        }
+
+        Grafo *grafo = construirGrafo(lista);
+        BuscaRotas busca;
+        if (grafo == NULL || !iniciarBuscaRotas(&busca, grafo, 1 << 16))
+        {
+            liberarGrafo(grafo);
+            liberarMemoria(lista);
+            divergencias++;
+            continue;
+        }
+        int origem = rand_r(&semente) % grafo->quantidadeVertices;
+        int destino = rand_r(&semente) % grafo->quantidadeVertices;
+        int pesos[2] = {rand_r(&semente) % 3, rand_r(&semente) % 3};
+        pesos[0] += pesos[0] == 0 && pesos[1] == 0;
+
+        RotaAlternativa rotas[MAXIMO_ROTAS_ALTERNATIVAS];
+        int quantidade = rotasPonderadas(&busca, origem, destino, pesos[0], pesos[1], rotas, MAXIMO_ROTAS_ALTERNATIVAS);
+        unsigned char visitados[CIDADES_ENUMERACAO] = {0};
+        int total = enumerarCaminhos(grafo, origem, destino, 0, 0, pesos, visitados, custos, 0);
+        if (total <= CAPACIDADE_ENUMERACAO)
+        {
+            qsort(custos, total, sizeof(int64_t), compararCustos);
+            int diferente = quantidade != (total < MAXIMO_ROTAS_ALTERNATIVAS ? total : MAXIMO_ROTAS_ALTERNATIVAS) ||
+                            busca.truncada || !rotasDistintasESimples(&busca, rotas, quantidade, origem);
+            for (int i = 0; !diferente && i < quantidade; i++)
+            {
+                diferente = custoPonderado(pesos, rotas[i].distancia, rotas[i].pedagio) != custos[i];
+            }
+            divergencias += diferente;
+        }
+
+        liberarBuscaRotas(&busca);
+        liberarGrafo(grafo);
+        liberarMemoria(lista);
+    }
+    free(custos);
+    return divergencias;
+}
+
+static long somasExatasEstresse(unsigned int semente)
+{
+    Rodovia *lista = inserirRodovia(NULL, "BR-0");
+    Metros distancia = 0;
+    Centavos ida = 0, volta = 0;
+    for (int i = 0; i < CIDADES_SOMA_EXATA; i++)
+    {
+        char nome[50];
+        snprintf(nome, sizeof(nome), "Cidade %d", i);
+        distancia += i > 0 ? 1 + rand_r(&semente) % 99999 : 0;
+        Cidade *cidade = inserirCidade(lista, nome, distancia);
+        if (cidade == NULL)
+        {
+            liberarMemoria(lista);
+            return 1;
+        }
+        if (cidade->anterior != NULL)
+        {
+            lista->pedagiosIda[cidade->anterior->indice] = rand_r(&semente) % 9999;
+            lista->pedagiosVolta[cidade->anterior->indice] = rand_r(&semente) % 9999;
+            ida += lista->pedagiosIda[cidade->anterior->indice];
+            volta += lista->pedagiosVolta[cidade->anterior->indice];
+        }
+    }
+
+    Grafo *grafo = construirGrafo(lista);
+    BuscaRotas busca;
+    if (grafo == NULL || !iniciarBuscaRotas(&busca, grafo, 1 << 16))
+    {
+        liberarGrafo(grafo);
+        liberarMemoria(lista);
+        return 1;
+    }
+    char ultima[50];
+    snprintf(ultima, sizeof(ultima), "Cidade %d", CIDADES_SOMA_EXATA - 1);
+    int extremos[2] = {buscarVertice(grafo, "Cidade 0"), buscarVertice(grafo, ultima)};
+
+    long divergencias = 0;
+    RotaAlternativa rota;
+    divergencias += rotasPareto(&busca, extremos[0], extremos[1], &rota, 1) != 1 || rota.distancia != distancia ||
+                    rota.pedagio != ida;
+    divergencias += rotasPareto(&busca, extremos[1], extremos[0], &rota, 1) != 1 || rota.distancia != distancia ||
+                    rota.pedagio != volta;
+
+    Metros distancias[4];
+    Centavos pedagios[4];
+    divergencias += !calcularMatriz(grafo, extremos, 2, extremos, 2, 2, distancias, pedagios) ||
+                    distancias[1] != distancia || distancias[2] != distancia || pedagios[1] != ida ||
+                    pedagios[2] != volta || distancias[0] != 0 || distancias[3] != 0;
+
+    liberarBuscaRotas(&busca);
+    liberarGrafo(grafo);
+    liberarMemoria(lista);
+    return divergencias;
+}
+
+int main(int argc, char *argv[])
+{
+    long operacoes = argc > 1 ? atol(argv[1]) : 200000;
+    unsigned int semente = argc > 2 ? (unsigned int)atol(argv[2]) : (unsigned int)time(NULL);
+    if (operacoes <= 0)
+    {
+        printf("Uso: %s [operacoes] [semente]\n", argv[0]);
+        return 1;
+    }
+    printf("Estresse: %ld operações, semente %u\n", operacoes, semente);
+    fflush(stdout);
+
+    Modelo *modelo = calloc(1, sizeof(Modelo));
+    if (modelo == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        return 1;
+    }
+    Rodovia *lista = NULL;
+    BuscaAlcance busca;
+    memset(&busca, 0, sizeof(busca));
+    double tempos[8] = {0};
+
+    int saidaOriginal = dup(STDOUT_FILENO);
+    int nulo = open("/dev/null", O_WRONLY);
+    dup2(nulo, STDOUT_FILENO);
+    close(nulo);
+
+    double inicio = agoraSegundos();
+    for (long n = 0; n < operacoes && modelo->divergencias == 0; n++)
+    {
+        int sorteio = rand_r(&semente) % 1000;
+        int operacao = sorteio < 40    ? OPERACAO_INSERIR_RODOVIA
+                       : sorteio < 60  ? OPERACAO_REMOVER_RODOVIA
+                       : sorteio < 500 ? OPERACAO_INSERIR_CIDADE
+                       : sorteio < 700 ? OPERACAO_REMOVER_CIDADE
+                       : sorteio < 850 ? OPERACAO_PEDAGIO
+                       : sorteio < 997 ? OPERACAO_PERCURSO
+                       : sorteio < 999 ? OPERACAO_ALCANCE
+                                       : OPERACAO_ARQUIVO;
+
+        double antes = agoraSegundos();
+        switch (operacao)
+        {
+        case OPERACAO_INSERIR_RODOVIA:
+            lista = inserirRodoviaEstresse(modelo, lista, &semente);
+            break;
+        case OPERACAO_REMOVER_RODOVIA:
+            lista = removerRodoviaEstresse(modelo, lista, &semente);
+            break;
+        case OPERACAO_INSERIR_CIDADE:
+            inserirCidadeEstresse(modelo, lista, &semente);
+            break;
+        case OPERACAO_REMOVER_CIDADE:
+            removerCidadeEstresse(modelo, lista, &semente);
+            break;
+        case OPERACAO_PEDAGIO:
+            pedagioEstresse(modelo, lista, &semente);
+            break;
+        case OPERACAO_PERCURSO:
+            percursoEstresse(modelo, lista, &semente);
+            break;
+        case OPERACAO_ALCANCE:
+            alcanceEstresse(modelo, lista, &busca, &semente);
+            break;
+        case OPERACAO_ARQUIVO:
+            arquivoEstresse(modelo, lista);
+            break;
+        }
+        tempos[operacao] += agoraSegundos() - antes;
+        modelo->operacoes[operacao]++;
+
+        if (n % 1000 == 0)
+        {
+            verificarEstrutura(modelo, lista);
+        }
+    }
+    verificarEstrutura(modelo, lista);
+    double total = agoraSegundos() - inicio;
+
+    fflush(stdout);
+    dup2(saidaOriginal, STDOUT_FILENO);
+    close(saidaOriginal);
+
+    for (int i = 0; i < 8; i++)
+    {
+        printf("%-16s %9ld  %8.3f s\n", nomesOperacoes[i], modelo->operacoes[i], tempos[i]);
+    }
+
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+    printf("Total: %.3f s (%.0f operações/s), pico de memória residente %ld KiB\n", total,
+           operacoes / total, uso.ru_maxrss);
+
+    long operacoesConcorrentes = operacoes / 10 > 0 ? operacoes / 10 : 1;
+    double antesConcorrencia = agoraSegundos();
+    long falhasConcorrentes = concorrenciaEstresse(operacoesConcorrentes, semente);
+    printf("Concorrência: 1 escritor e %d leitores, %ld operações cada, %.3f s, %ld falha(s)\n",
+           LEITORES_CONCORRENTES, operacoesConcorrentes, agoraSegundos() - antesConcorrencia, falhasConcorrentes);
+
+    long compactacoes = 0;
+    double antesLapides = agoraSegundos();
+    long operacoesLapides = operacoesConcorrentes / 5 + 1;
+    long divergenciasLapides = lapidesEstresse(operacoesLapides, semente, &compactacoes);
+    printf("Remoções incrementais: %ld operações, %ld compactação(ões), %.3f s, %ld divergência(s) em relação a "
+           "um grafo novo\n",
+           operacoesLapides, compactacoes, agoraSegundos() - antesLapides, divergenciasLapides);
+
+    long compactacoesPesos = 0;
+    double antesPesos = agoraSegundos();
+    long operacoesPesos = operacoesConcorrentes / 2 + 1;
+    long divergenciasPesos = pesosCompactacaoEstresse(operacoesPesos, semente, &compactacoesPesos);
+    printf("Pesos durante compactação: %ld atualizações, %ld compactação(ões), %.3f s, %ld divergência(s) em "
+           "relação ao último valor gravado\n",
+           operacoesPesos, compactacoesPesos, agoraSegundos() - antesPesos, divergenciasPesos);
+
+    long consultasRotas = operacoesConcorrentes / 5 + 1;
+    double antesRotas = agoraSegundos();
+    long divergenciasRotas = melhoresRotasEstresse(consultasRotas, semente);
+    printf("Melhores rotas por custo: %ld consulta(s), %.3f s, %ld divergência(s) em relação à enumeração de todos "
+           "os caminhos simples\n",
+           consultasRotas, agoraSegundos() - antesRotas, divergenciasRotas);
+
+    double antesSomas = agoraSegundos();
+    long divergenciasSomas = somasExatasEstresse(semente);
+    printf("Somas exatas: rota e matriz sobre %d trechos, %.3f s, %ld divergência(s) em relação à soma inteira "
+           "dos trechos\n",
+           CIDADES_SOMA_EXATA - 1, agoraSegundos() - antesSomas, divergenciasSomas);
+
+    int falhou = modelo->divergencias > 0 || falhasConcorrentes > 0 || divergenciasLapides > 0 ||
+                 divergenciasPesos > 0 || divergenciasRotas > 0 || divergenciasSomas > 0;
+    if (modelo->divergencias > 0)
+    {
+        printf("FALHA: %ld divergência(s); primeira: %s\n", modelo->divergencias, modelo->primeiraDivergencia);
+    }
+    else
+    {
+        printf("Nenhuma divergência em relação ao modelo de referência.\n");
+    }
+
+    liberarBuscaAlcance(&busca);
+    liberarMemoria(lista);
+    free(modelo);
+    return falhou;
+}
@@ -1,18 +1,36 @@
 #ifndef ESTRUTURAS_H
 #define ESTRUTURAS_H
 
-typedef struct Pedagio
-{
-    char nomeCidade[50];
-    float valor;
-    struct Pedagio *proximo;
-} Pedagio;
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "rodovias.h"
+
+#define TAMANHO_CHAVE 64
+#define CENTAVOS_POR_REAL 100
+#define METROS_POR_KM 1000
+#define MICROGRAUS_POR_GRAU 1000000
+#define COORDENADA_INDEFINIDA INT32_MIN
+#define PEDAGIO_INDEFINIDO (-1)
+#define SENTIDO_IDA 1
+#define SENTIDO_VOLTA (-1)
+#define SENTIDO_AMBOS 0
+#define CUSTO_INFINITO INT64_MAX
+#define RAIO_TERRA_METROS 6371008.8
+
+typedef int64_t Centavos;
+typedef int64_t Metros;
+typedef int32_t Micrograus;
 
 typedef struct Cidade
 {
     char nomeCidade[50];
-    float distancia;
-    Pedagio *pedagios;
+    char chave[TAMANHO_CHAVE];
+    unsigned int hash;
+    Metros distancia;
+    Micrograus latitude;
+    Micrograus longitude;
+    int indice;
     struct Cidade *proxima;
     struct Cidade *anterior;
 } Cidade;
@@ -24,35 +42,664 @@ typedef struct RodoviaAdjacente
     struct RodoviaAdjacente *proxima;
 } RodoviaAdjacente;
 
+typedef struct KernelsNomes
+{
+    const char *nome;
+    void (*dobrarCaixa)(char chave[]);
+    int (*iguais)(char chave1[], char chave2[]);
+    unsigned int (*hash)(char chave[]);
+} KernelsNomes;
+
+typedef struct FaixaTarifa
+{
+    int classe;
+    int inicio;
+    Centavos valor;
+} FaixaTarifa;
+
+typedef struct TabelaTarifas
+{
+    FaixaTarifa *faixas;
+    int quantidade;
+    int capacidade;
+} TabelaTarifas;
+
 typedef struct Rodovia
 {
     char nome[50];
+    char chave[TAMANHO_CHAVE];
+    unsigned int hash;
     Cidade *cidades;
-    float pedagio;
+    int numeroCidades;
+    Centavos *pedagiosIda;
+    Centavos *pedagiosVolta;
+    int capacidadePedagios;
+    TabelaTarifas *tarifas;
+    Centavos pedagio;
+    int modificada;
     struct Rodovia *proxima;
     RodoviaAdjacente *rodovias_adjacentes;
 } Rodovia;
 
-void carregarRodoviasDeArquivo(Rodovia **lista, char *nomeArquivo);
+#define TAMANHO_MAXIMO_REGISTRO 256
+
+enum TipoAlteracao
+{
+    ALTERACAO_INSERIR_RODOVIA = 1,
+    ALTERACAO_REMOVER_RODOVIA,
+    ALTERACAO_INSERIR_CIDADE,
+    ALTERACAO_REMOVER_CIDADE,
+    ALTERACAO_PEDAGIO,
+    ALTERACAO_TARIFA,
+    ALTERACAO_COORDENADAS,
+    ALTERACAO_DISTANCIA
+};
+
+typedef struct Alteracao
+{
+    int tipo;
+    char rodovia[50];
+    char cidade1[50];
+    char cidade2[50];
+    int64_t valor;
+    int classe;
+    int inicio;
+} Alteracao;
+
+typedef struct Diario
+{
+    int descritor;
+    char arquivoDados[256];
+    char caminho[300];
+    char caminhoCompactacao[300];
+    int compactador;
+    int pendentes;
+    long bytesDescartados;
+    int falhaCompactacao;
+    int alimentacao;
+    char caminhoAlimentacao[256];
+    uint64_t geracao;
+    long registrosAlimentacao;
+} Diario;
+
+#define MARCA_ALIMENTACAO "RODALT01"
+#define CABECALHO_ALIMENTACAO 16
+
+#define TAMANHO_BUFFER_SAIDA (1 << 20)
+
+typedef struct BufferSaida
+{
+    int descritor;
+    char *dados;
+    size_t usado;
+    size_t capacidade;
+    int erro;
+} BufferSaida;
+
+enum ResultadoConsulta
+{
+    CONSULTA_OK = 0,
+    CONSULTA_CIDADE_NAO_ENCONTRADA,
+    CONSULTA_SEM_ROTA
+};
+
+typedef struct ResultadoPercurso
+{
+    Rodovia *rodoviaInicio;
+    Rodovia *rodoviaFim;
+    char origem[50];
+    char destino[50];
+    char cidadeConexao[50];
+    Metros distancia;
+    Centavos pedagio;
+} ResultadoPercurso;
+
+typedef struct Grafo
+{
+    int quantidadeVertices;
+    int quantidadeArestas;
+    char (*nomes)[50];
+    char (*chaves)[TAMANHO_CHAVE];
+    unsigned int *hashes;
+    int *tabela;
+    int capacidadeTabela;
+    int *primeiraAresta;
+    int *destinos;
+    Metros *distancias;
+    Centavos *pedagios;
+    Rodovia **rodovias;
+    int *trechos;
+    int *gemeas;
+    int quantidadeSegmentos;
+    int *segmentos;
+    int *arestasSegmentos;
+    uint64_t *interditados;
+    uint64_t *removidos;
+    unsigned long *versoesSegmentos;
+    int *ocorrencias;
+} Grafo;
+
+typedef struct EntradaFila
+{
+    int64_t chave;
+    int vertice;
+} EntradaFila;
+
+typedef struct RotuloRota
+{
+    Metros distancia;
+    Centavos pedagio;
+    double custo;
+    int vertice;
+    int anterior;
+    int aresta;
+} RotuloRota;
+
+typedef struct BuscaRotas
+{
+    Grafo *grafo;
+    RotuloRota *rotulos;
+    int quantidadeRotulos;
+    int limiteRotulos;
+    int *heap;
+    int tamanhoHeap;
+    EntradaFila *fila;
+    int tamanhoFila;
+    Centavos *melhorPedagio;
+    Metros *limiteDistancia;
+    Centavos *limitePedagio;
+    int *visitas;
+    unsigned int *marcas;
+    unsigned int geracao;
+    int truncada;
+    uint64_t *bloqueados;
+    Centavos pedagioMaximo;
+} BuscaRotas;
+
+typedef struct RotaAlternativa
+{
+    Metros distancia;
+    Centavos pedagio;
+    int rotulo;
+} RotaAlternativa;
+
+typedef struct CidadeAlcancada
+{
+    int vertice;
+    Metros distancia;
+    Centavos pedagio;
+} CidadeAlcancada;
+
+typedef struct BuscaAlcance
+{
+    Grafo *grafo;
+    int capacidadeVertices;
+    int capacidadeArestas;
+    Metros *distancias;
+    Centavos *pedagios;
+    unsigned int *marcas;
+    unsigned int *fechadas;
+    unsigned int geracao;
+    EntradaFila *fila;
+    int tamanhoFila;
+    CidadeAlcancada *alcancadas;
+    int quantidadeAlcancadas;
+    unsigned char *alvos;
+    int quantidadeAlvos;
+    int reverso;
+} BuscaAlcance;
+
+typedef struct MatrizDistancias
+{
+    Grafo *grafo;
+    int *origens;
+    int quantidadeOrigens;
+    int *destinos;
+    int quantidadeDestinos;
+    Metros *distancias;
+    Centavos *pedagios;
+    unsigned char *alvos;
+    int quantidadeAlvos;
+    int proximaOrigem;
+    int falhas;
+} MatrizDistancias;
+
+typedef struct OtimizacaoRoteiro
+{
+    int quantidade;
+    float *custos;
+    int *melhor;
+    double melhorCusto;
+    double custoInicial;
+    double prazo;
+    long tentativas;
+    unsigned int semente;
+    pthread_mutex_t trava;
+} OtimizacaoRoteiro;
+
+#define LIMITE_ROTULOS_ROTAS (1 << 20)
+#define LIMITE_ARESTAS_ROTA 1024
+#define MAXIMO_CACHE_ROTAS 4096
+#define MINIMO_LAPIDES_COMPACTACAO 64
+#define PROPORCAO_LAPIDES 8
+#define TENTATIVAS_COMPACTACAO 4
+
+typedef struct EntradaCacheRotas
+{
+    int origem;
+    int destino;
+    int criterio;
+    float pesoDistancia;
+    float pesoPedagio;
+    unsigned long versaoGrafo;
+    unsigned long versaoPesos;
+    int quantidade;
+    Metros distancias[MAXIMO_ROTAS_ALTERNATIVAS];
+    Centavos pedagios[MAXIMO_ROTAS_ALTERNATIVAS];
+    int inicioRotas[MAXIMO_ROTAS_ALTERNATIVAS + 1];
+    int *arestas;
+} EntradaCacheRotas;
+
+typedef struct CacheRotas
+{
+    EntradaCacheRotas entradas[MAXIMO_CACHE_ROTAS];
+    pthread_mutex_t trava;
+    long acertos;
+    long faltas;
+    long invalidadas;
+} CacheRotas;
+
+#define TAMANHO_PAGINA 4096
+#define ASSINATURA_REDE_PAGINADA 0x47415052u
+#define VERSAO_REDE_PAGINADA 4
+
+typedef struct CabecalhoRedePaginada
+{
+    uint32_t assinatura;
+    uint32_t versao;
+    uint32_t quantidadeRodovias;
+    uint32_t quantidadeCidades;
+    uint32_t paginasDiretorio;
+    uint32_t paginasIndice;
+    uint32_t totalPaginas;
+} CabecalhoRedePaginada;
+
+typedef struct RegistroRodovia
+{
+    char nome[50];
+    char reservado[2];
+    uint32_t hash;
+    uint32_t numeroCidades;
+    uint32_t primeiraPagina;
+    Centavos pedagioTotal;
+} RegistroRodovia;
+
+typedef struct RegistroCidade
+{
+    char nome[50];
+    char reservado[2];
+    uint32_t hash;
+    Metros distancia;
+    Centavos pedagioIda;
+    Centavos pedagioVolta;
+    Micrograus latitude;
+    Micrograus longitude;
+} RegistroCidade;
+
+typedef struct EntradaIndiceCidade
+{
+    uint32_t hash;
+    uint32_t rodovia;
+    uint32_t posicao;
+} EntradaIndiceCidade;
+
+#define REGISTROS_POR_PAGINA (TAMANHO_PAGINA / sizeof(RegistroCidade))
+#define ENTRADAS_POR_PAGINA_INDICE ((TAMANHO_PAGINA - 2 * sizeof(uint32_t)) / sizeof(EntradaIndiceCidade))
+
+typedef struct PaginaIndice
+{
+    uint32_t quantidade;
+    uint32_t proxima;
+    EntradaIndiceCidade entradas[ENTRADAS_POR_PAGINA_INDICE];
+} PaginaIndice;
+
+#define ASSINATURA_REDE_COMPACTADA "RODARQ02"
+#define CIDADES_POR_BLOCO_COMPACTADO 4096
+
+typedef struct CabecalhoRedeCompactada
+{
+    char assinatura[8];
+    uint32_t quantidadeRodovias;
+    uint32_t quantidadeBlocos;
+    uint64_t quantidadeCidades;
+    uint64_t posicaoDiretorio;
+} CabecalhoRedeCompactada;
+
+typedef struct BlocoCompactado
+{
+    uint64_t posicao;
+    uint32_t tamanho;
+    uint32_t verificacao;
+    uint32_t primeiraRodovia;
+    uint32_t quantidadeRodovias;
+} BlocoCompactado;
+
+typedef struct EntradaRodoviaCompactada
+{
+    uint32_t hash;
+    uint32_t bloco;
+} EntradaRodoviaCompactada;
+
+typedef struct QuadroPagina
+{
+    uint32_t pagina;
+    int ocupado;
+    int sujo;
+    int anterior;
+    int proximo;
+    int proximoNaTabela;
+    char *dados;
+} QuadroPagina;
+
+typedef struct CachePaginas
+{
+    int descritor;
+    int quantidadeQuadros;
+    QuadroPagina *quadros;
+    char *memoria;
+    int *tabela;
+    int capacidadeTabela;
+    int maisRecente;
+    int menosRecente;
+    long acertos;
+    long faltas;
+    long gravacoes;
+    int erro;
+} CachePaginas;
+
+typedef struct RedePaginada
+{
+    CachePaginas cache;
+    CabecalhoRedePaginada cabecalho;
+} RedePaginada;
+
+typedef struct OcorrenciaCidade
+{
+    uint32_t rodovia;
+    uint32_t posicao;
+    Metros distancia;
+} OcorrenciaCidade;
+
+#define MAXIMO_OCORRENCIAS_CIDADE 64
+#define QUADROS_PADRAO_CACHE 1024
+
+typedef struct NoIndiceNomes
+{
+    int inicioRotulo;
+    int tamanhoRotulo;
+    int primeiroFilho;
+    int proximoIrmao;
+    int ocorrencias;
+    int inicioNome;
+} NoIndiceNomes;
+
+typedef struct IndiceNomes
+{
+    NoIndiceNomes *nos;
+    int quantidadeNos;
+    int capacidadeNos;
+    char *textos;
+    int tamanhoTextos;
+    int capacidadeTextos;
+    int quantidadeNomes;
+} IndiceNomes;
+
+typedef struct SugestaoNome
+{
+    const char *nome;
+    int distancia;
+} SugestaoNome;
+
+typedef struct IndiceEspacial
+{
+    int quantidade;
+    double (*pontos)[3];
+    unsigned char *eixos;
+    Micrograus *latitudes;
+    Micrograus *longitudes;
+    char (*nomes)[50];
+} IndiceEspacial;
+
+typedef struct VizinhoEspacial
+{
+    int ponto;
+    double corda;
+} VizinhoEspacial;
+
+struct RedeRodovias
+{
+    Rodovia *lista;
+    Diario diario;
+    pthread_rwlock_t trava;
+    pthread_mutex_t travaDerivados;
+    unsigned long versao;
+    unsigned long versaoAdjacencias;
+    unsigned long versaoGrafo;
+    Grafo *grafo;
+    pthread_mutex_t travaBusca;
+    BuscaAlcance busca;
+    IndiceNomes indiceRodovias;
+    IndiceNomes indiceCidades;
+    int indicesDesatualizados;
+    IndiceEspacial *espacial;
+    unsigned long versaoEspacial;
+    InfoInterdicao *interdicoes;
+    int quantidadeInterdicoes;
+    int capacidadeInterdicoes;
+    unsigned long versaoPesos;
+    unsigned long versaoMelhoria;
+    CacheRotas cacheRotas;
+    Rodovia *removidas;
+    int lapides;
+    long compactacoes;
+    pthread_t compactador;
+    int compactadorIniciado;
+    int compactacaoPendente;
+    int encerrarCompactador;
+    pthread_mutex_t travaCompactacao;
+    pthread_cond_t sinalCompactacao;
+};
+
+#define TAMANHO_ENTRADA_SERVIDOR 4096
+
+typedef struct ConexaoServidor
+{
+    int descritor;
+    char entrada[TAMANHO_ENTRADA_SERVIDOR];
+    size_t usado;
+    char *pendente;
+    size_t tamanhoPendente;
+    size_t enviado;
+    struct ConexaoServidor *proxima;
+    struct ConexaoServidor *anteriorAtiva;
+    struct ConexaoServidor *proximaAtiva;
+} ConexaoServidor;
+
+typedef struct Coordenador Coordenador;
+
+typedef struct Servidor
+{
+    Rodovia *lista;
+    Grafo *grafo;
+    int epoll;
+    int escuta;
+    pthread_t *trabalhadores;
+    int quantidadeTrabalhadores;
+    ConexaoServidor *primeiraPendente;
+    ConexaoServidor *ultimaPendente;
+    ConexaoServidor *ativas;
+    pthread_mutex_t trava;
+    pthread_cond_t sinal;
+    int encerrando;
+    int *fronteiras;
+    int quantidadeFronteiras;
+    Coordenador *coordenador;
+    pthread_rwlock_t travaDados;
+    unsigned long versao;
+    uint64_t geracao;
+    long registros;
+} Servidor;
+
+#define MAXIMO_REGIOES 64
+
+int carregarRodoviasDeArquivo(Rodovia **lista, char *nomeArquivo);
 Rodovia *buscarRodovia(Rodovia *lista, char nome[]);
 Rodovia *inserirRodovia(Rodovia *lista, char nome[]);
 Rodovia *removerRodovia(Rodovia *lista, char nome[]);
-Cidade *inserirCidade(Rodovia *rodovia, char nomeCidade[], float distancia);
-void adicionarPedagio(Rodovia *rodovia, char nomeCidade1[], char nomeCidade2[], float valorPedagio);
-float calcularPedagioTotal(Cidade *cidades);
-void removerCidade(Rodovia *rodovia, char nomeCidade[]);
-void percursoCidades(Rodovia *rodovia, char cidadeInicio[], char cidadeFim[]);
-void listarCruzamentos(Rodovia *rodovia1, Rodovia *rodovia2);
-void imprimirRodovias(Rodovia *lista);
-void salvarRodoviasArquivo(Rodovia *lista, char *nomeArquivo);
-void listarCruzamentosEspecificos(Rodovia *rodovia1, Rodovia *rodovia2);
+Rodovia *desligarRodovia(Rodovia **lista, char nome[]);
+Cidade *buscarCidade(Rodovia *rodovia, char nomeCidade[]);
+Cidade *inserirCidade(Rodovia *rodovia, char nomeCidade[], Metros distancia);
+int adicionarPedagio(Rodovia *rodovia, char nomeCidade1[], char nomeCidade2[], Centavos valorPedagio, int sentido);
+int definirDistanciaTrecho(Rodovia *rodovia, char nomeCidade1[], char nomeCidade2[], Metros comprimento);
+Centavos calcularPedagioTotal(Rodovia *rodovia);
+Centavos pedagioTrecho(Rodovia *rodovia, int indice, int sentido);
+Centavos tarifaTrecho(Rodovia *rodovia, int indice, int sentido, int minuto, int classe);
+int definirTarifaPedagio(Rodovia *rodovia, char nomeCidade1[], char nomeCidade2[], int classe, int inicio,
+                         Centavos valor);
+int minutoDePassagem(int partida, Metros distancia);
+Centavos reaisParaCentavos(double reais);
+Metros kmParaMetros(double km);
+int64_t limiteEmUnidades(double valor, int unidades);
+double centavosParaReais(Centavos valor);
+double metrosParaKm(Metros distancia);
+Micrograus grausParaMicrograus(double graus);
+double micrograusParaGraus(Micrograus valor);
+int coordenadasValidas(Micrograus latitude, Micrograus longitude);
+int definirCoordenadas(Rodovia *lista, char nomeCidade[], Micrograus latitude, Micrograus longitude);
+int removerCidade(Rodovia *rodovia, char nomeCidade[]);
 void converterMinusculo(char *str);
 void apresentarInformacoes();
 void menu();
-void conectarRodovias(Rodovia *listaRodovias);
-void percursoEntreRodovias(Rodovia *listaRodovias, char cidadeInicio[], char cidadeFim[]);
-void calcularPercurso(Rodovia *rodovia, char cidadeInicio[], char cidadeFim[], float *totalPedagio, float *totalDistancia);
+void liberarAdjacentes(Rodovia *rodovia);
+void liberarListasAdjacentes(RodoviaAdjacente *adjacentes[], int quantidade);
+int montarAdjacencias(Rodovia *listaRodovias, RodoviaAdjacente *adjacentes[]);
+void trocarAdjacencias(Rodovia *listaRodovias, RodoviaAdjacente *adjacentes[]);
+int conectarRodovias(Rodovia *listaRodovias);
+void somarPercurso(Rodovia *rodovia, char cidadeInicio[], char cidadeFim[], Centavos *totalPedagio,
+                   Metros *totalDistancia);
+void somarPercursoTarifado(Rodovia *rodovia, char cidadeInicio[], char cidadeFim[], int partida, int classe,
+                           Centavos *totalPedagio, Metros *totalDistancia);
+int consultarPercurso(Rodovia *listaRodovias, char cidadeInicio[], char cidadeFim[], int partida, int classe,
+                      ResultadoPercurso *resultado);
+FaixaTarifa *buscarFaixaTarifa(TabelaTarifas *tabela, int classe, int minuto);
+Centavos valorTarifa(TabelaTarifas *tabela, int classe, int minuto, Centavos fixo);
+int gravarFaixaTarifa(TabelaTarifas *tabela, int classe, int inicio, Centavos valor);
+int combinarTabelasTarifas(TabelaTarifas *primeira, Centavos fixoPrimeira, TabelaTarifas *segunda,
+                           Centavos fixoSegunda, TabelaTarifas *resultado);
+void liberarTabelaTarifas(TabelaTarifas *tabela);
 void removerEspacos(char *texto);
+void normalizarNome(char nome[], char chave[]);
+unsigned int calcularHash(char chave[]);
+int mesmaChave(unsigned int hash1, char chave1[], unsigned int hash2, char chave2[]);
+KernelsNomes *listarKernelsNomes(int *quantidade);
+KernelsNomes *obterKernelsNomes(void);
+void dobrarCaixaChave(char chave[]);
+int chavesIguais(char chave1[], char chave2[]);
+unsigned int hashChave(char chave[]);
 void liberarMemoria(Rodovia *lista);
+int imprimirRodoviasEmArquivo(Rodovia *lista, char *nomeArquivo);
+int codificarAlteracao(Alteracao *alteracao, unsigned char buffer[]);
+int decodificarAlteracao(unsigned char buffer[], int disponivel, Alteracao *alteracao);
+int aplicarAlteracao(Rodovia **lista, Alteracao *alteracao);
+int abrirDiario(Diario *diario, char nomeArquivo[], Rodovia **lista);
+int lerDiario(char nomeArquivo[], Rodovia **lista, long *ignorados);
+int registrarAlteracao(Diario *diario, int tipo, char rodovia[], char cidade1[], char cidade2[], int64_t valor);
+int registrarTarifa(Diario *diario, char rodovia[], char cidade1[], char cidade2[], int classe, int inicio,
+                    Centavos valor);
+int registrarCoordenadas(Diario *diario, char cidade[], Micrograus latitude, Micrograus longitude);
+int compactarDiario(Diario *diario, Rodovia *lista, int aguardar);
+void descartarDiario(Diario *diario);
+void fecharDiario(Diario *diario);
+int iniciarBufferSaida(BufferSaida *saida, int descritor);
+void descarregarSaida(BufferSaida *saida);
+int finalizarBufferSaida(BufferSaida *saida);
+int sincronizarDiretorio(const char *caminho);
+void saidaBytes(BufferSaida *saida, const char *dados, size_t tamanho);
+void saidaTexto(BufferSaida *saida, const char *texto);
+void saidaInteiro(BufferSaida *saida, long long valor);
+void saidaDecimal(BufferSaida *saida, float valor);
+void saidaCentavos(BufferSaida *saida, Centavos valor);
+void saidaMetros(BufferSaida *saida, Metros distancia);
+void saidaMicrograus(BufferSaida *saida, Micrograus valor);
+void escreverRodovia(BufferSaida *saida, Rodovia *rodovia, int formatoArquivo);
+void escreverRodovias(BufferSaida *saida, Rodovia *lista, int formatoArquivo);
+Grafo *construirGrafo(Rodovia *lista);
+void liberarGrafo(Grafo *grafo);
+int buscarVertice(Grafo *grafo, char nome[]);
+int primeiroSegmento(Grafo *grafo, Rodovia *rodovia);
+void marcarSegmentos(uint64_t marcados[], int inicio, int fim);
+int removerRodoviaGrafo(Grafo *grafo, Rodovia *rodovia, unsigned long versao);
+void removerCidadeGrafo(Grafo *grafo, int vertice, int base, int indice, int cidades, unsigned long versao);
+int iniciarBuscaRotas(BuscaRotas *busca, Grafo *grafo, int limiteRotulos);
+void liberarBuscaRotas(BuscaRotas *busca);
+void inserirFila(EntradaFila fila[], int *tamanho, int64_t chave, int vertice);
+EntradaFila retirarFila(EntradaFila fila[], int *tamanho);
+int rotasPareto(BuscaRotas *busca, int origem, int destino, RotaAlternativa rotas[], int maximoRotas);
+int rotasPonderadas(BuscaRotas *busca, int origem, int destino, float pesoDistancia, float pesoPedagio,
+                    RotaAlternativa rotas[], int maximoRotas);
+int arestasDaRota(BuscaRotas *busca, RotaAlternativa *rota, int arestas[], int maximo);
+int prepararBuscaAlcance(BuscaAlcance *busca, Grafo *grafo);
+void liberarBuscaAlcance(BuscaAlcance *busca);
+int buscarAlcance(BuscaAlcance *busca, int origem, int criterio, int64_t limite);
+int calcularMatriz(Grafo *grafo, int origens[], int quantidadeOrigens, int destinos[], int quantidadeDestinos,
+                   int quantidadeThreads, Metros distancias[], Centavos pedagios[]);
+int otimizarRoteiro(Metros distancias[], int quantidade, int quantidadeThreads, double tempoLimite, int ordem[],
+                    long *tentativas, double *distanciaInicial);
+int executarMatriz(char nomeArquivo[], char arquivoOrigens[], char arquivoDestinos[], char arquivoSaida[],
+                   int binario, int quantidadeThreads);
+int abrirCachePaginas(CachePaginas *cache, int descritor, int quantidadeQuadros);
+char *lerPagina(CachePaginas *cache, uint32_t pagina);
+char *alterarPagina(CachePaginas *cache, uint32_t pagina);
+int descarregarCache(CachePaginas *cache);
+void fecharCachePaginas(CachePaginas *cache);
+int converterParaPaginas(char arquivoTexto[], char arquivoPaginas[], int quantidadeQuadros);
+int abrirRedePaginada(RedePaginada *rede, char arquivoPaginas[], int quantidadeQuadros);
+void fecharRedePaginada(RedePaginada *rede);
+int buscarRodoviaPaginada(RedePaginada *rede, char nome[], RegistroRodovia *registro);
+int lerRegistroRodovia(RedePaginada *rede, uint32_t indice, RegistroRodovia *registro);
+int lerRegistroCidade(RedePaginada *rede, RegistroRodovia *rodovia, uint32_t posicao, RegistroCidade *cidade);
+int localizarCidadePaginada(RedePaginada *rede, char nomeCidade[], OcorrenciaCidade ocorrencias[], int maximo);
+void somarTrechoPaginado(RedePaginada *rede, RegistroRodovia *rodovia, uint32_t inicio, uint32_t fim,
+                         Centavos *pedagioTotal, Metros *distanciaTotal);
+int executarConsultasPaginadas(char arquivoPaginas[], int quantidadeQuadros);
+int gravarRedeCompactada(Rodovia *lista, char nomeArquivo[]);
+int carregarRedeCompactada(Rodovia **lista, char nomeArquivo[], int quantidadeThreads);
+int carregarRodoviaCompactada(char nomeArquivo[], char nomeRodovia[], Rodovia **rodovia);
+int executarCompactacao(char arquivoTexto[], char arquivoCompactado[]);
+int executarDescompactacao(char arquivoCompactado[], char arquivoTexto[], int quantidadeThreads);
+int executarServidor(char nomeArquivo[], char caminhoSocket[], int quantidadeTrabalhadores);
+void iniciarServidor(Servidor *servidor);
+void liberarServidor(Servidor *servidor);
+int atenderClientes(Servidor *servidor, char caminhoSocket[], int quantidadeTrabalhadores);
+int lerFronteiras(char nomeArquivo[], char (**nomes)[50]);
+int lerManifestoRegioes(char nomeArquivo[], char (**fragmentos)[256]);
+int executarParticionamento(char nomeArquivo[], char prefixo[], int quantidadeRegioes);
+int executarCoordenador(char manifesto[], char caminhoSocket[], int quantidadeTrabalhadores);
+int rotacionarAlimentacao(Diario *diario, Rodovia *lista, char caminho[]);
+int executarReplica(char caminhoAlimentacao[], char caminhoSocket[], int quantidadeTrabalhadores);
+int distanciaCoordenada(Coordenador *coordenador, char origem[], char destino[], double *distancia,
+                        double *pedagio);
+int iniciarIndiceNomes(IndiceNomes *indice);
+void liberarIndiceNomes(IndiceNomes *indice);
+int inserirNomeIndice(IndiceNomes *indice, char nome[]);
+void removerNomeIndice(IndiceNomes *indice, char nome[]);
+const char *buscarNomeIndice(IndiceNomes *indice, char nome[]);
+int completarNomeIndice(IndiceNomes *indice, char prefixo[], SugestaoNome sugestoes[], int maximo);
+int aproximarNomeIndice(IndiceNomes *indice, char nome[], int distanciaMaxima, SugestaoNome sugestoes[], int maximo);
+IndiceEspacial *construirIndiceEspacial(Rodovia *lista);
+void liberarIndiceEspacial(IndiceEspacial *indice);
+int vizinhosEspaciais(IndiceEspacial *indice, Micrograus latitude, Micrograus longitude, double raioMetros,
+                      VizinhoEspacial vizinhos[], int maximo);
+double cordaParaMetros(double corda);
 
 #endif
\ No newline at end of file
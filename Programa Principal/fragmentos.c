@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "estruturas.h"
+
+#define CONSULTAS_FRAGMENTOS 2000
+
+typedef struct ClienteFragmentos
+{
+    pid_t processo;
+    FILE *entrada;
+    FILE *saida;
+} ClienteFragmentos;
+
+static double agoraSegundos(void)
+{
+    struct timespec instante;
+    clock_gettime(CLOCK_MONOTONIC, &instante);
+    return instante.tv_sec + instante.tv_nsec / 1e9;
+}
+
+static Rodovia *gerarRede(int lado, int cidadesPorRodovia, unsigned int semente)
+{
+    Rodovia *lista = NULL;
+    int quantidadeRodovias = 2 * lado * lado / cidadesPorRodovia + 1;
+    static const int passos[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+    for (int r = 0; r < quantidadeRodovias; r++)
+    {
+        char nomeRodovia[50];
+        snprintf(nomeRodovia, sizeof(nomeRodovia), "BR-%d", r);
+        lista = inserirRodovia(lista, nomeRodovia);
+
+        int x = rand_r(&semente) % lado, y = rand_r(&semente) % lado;
+        Metros distancia = 0;
+        for (int c = 0; c < cidadesPorRodovia; c++)
+        {
+            char nomeCidade[50];
+            snprintf(nomeCidade, sizeof(nomeCidade), "Cidade %d", y * lado + x);
+            distancia += METROS_POR_KM + (rand_r(&semente) % 100000) * 10;
+            Cidade *cidade = inserirCidade(lista, nomeCidade, distancia);
+            if (cidade != NULL && cidade->anterior != NULL && rand_r(&semente) % 3 == 0)
+            {
+                lista->pedagiosIda[cidade->anterior->indice] = rand_r(&semente) % 4000;
+                lista->pedagiosVolta[cidade->anterior->indice] = rand_r(&semente) % 4000;
+            }
+
+            const int *passo = passos[rand_r(&semente) % 4];
+            x = (x + passo[0] + lado) % lado;
+            y = (y + passo[1] + lado) % lado;
+        }
+    }
+    return lista;
+}
+
+static int gravarRede(Rodovia *lista, char nomeArquivo[])
+{
+    int descritor = open(nomeArquivo, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0)
+    {
+        return 0;
+    }
+    BufferSaida saida;
+    iniciarBufferSaida(&saida, descritor);
+    escreverRodovias(&saida, lista, 1);
+    int sucesso = finalizarBufferSaida(&saida) == 0;
+    return close(descritor) == 0 && sucesso;
+}
+
+static int iniciarProcesso(ClienteFragmentos *cliente, char executavel[], char modo[], char arquivo[],
+                           char caminhoSocket[])
+{
+    cliente->processo = fork();
+    if (cliente->processo == 0)
+    {
+        int nulo = open("/dev/null", O_WRONLY);
+        if (nulo >= 0)
+        {
+            dup2(nulo, STDOUT_FILENO);
+            close(nulo);
+        }
+        execl(executavel, executavel, modo, arquivo, caminhoSocket, "2", (char *)NULL);
+        _exit(127);
+    }
+    if (cliente->processo < 0)
+    {
+        return 0;
+    }
+
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    snprintf(endereco.sun_path, sizeof(endereco.sun_path), "%s", caminhoSocket);
+    for (int tentativa = 0; tentativa < 6000; tentativa++)
+    {
+        if (waitpid(cliente->processo, NULL, WNOHANG) == cliente->processo)
+        {
+            cliente->processo = -1;
+            return 0;
+        }
+        int descritor = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (descritor >= 0 && connect(descritor, (struct sockaddr *)&endereco, sizeof(endereco)) == 0)
+        {
+            cliente->entrada = fdopen(descritor, "r");
+            cliente->saida = fdopen(dup(descritor), "w");
+            return cliente->entrada != NULL && cliente->saida != NULL;
+        }
+        if (descritor >= 0)
+        {
+            close(descritor);
+        }
+        usleep(10000);
+    }
+    return 0;
+}
+
+static void encerrarProcesso(ClienteFragmentos *cliente)
+{
+    if (cliente->entrada != NULL)
+    {
+        fclose(cliente->entrada);
+    }
+    if (cliente->saida != NULL)
+    {
+        fclose(cliente->saida);
+    }
+    if (cliente->processo > 0)
+    {
+        kill(cliente->processo, SIGTERM);
+        waitpid(cliente->processo, NULL, 0);
+    }
+}
+
+static int consultarDistancia(ClienteFragmentos *cliente, char origem[], char destino[], double *distancia,
+                              double *pedagio, char resposta[], int tamanho)
+{
+    fprintf(cliente->saida, "DISTANCIA\t%s\t%s\n", origem, destino);
+    fflush(cliente->saida);
+    if (fgets(resposta, tamanho, cliente->entrada) == NULL)
+    {
+        return -1;
+    }
+    resposta[strcspn(resposta, "\n")] = '\0';
+    if (strcmp(resposta, "OK\t1") != 0)
+    {
+        return 0;
+    }
+    char linha[256];
+    if (fgets(linha, sizeof(linha), cliente->entrada) == NULL ||
+        sscanf(linha, "TOTAL\t%lf\t%lf", distancia, pedagio) != 2)
+    {
+        return -1;
+    }
+    return 1;
+}
+
+static void removerArquivos(char base[], int regioes)
+{
+    char caminho[300];
+    const char *sufixos[] = {"", ".diario", ".regioes"};
+    for (int i = 0; i < 3; i++)
+    {
+        snprintf(caminho, sizeof(caminho), "%s%s", base, sufixos[i]);
+        unlink(caminho);
+    }
+    for (int i = 0; i < regioes; i++)
+    {
+        snprintf(caminho, sizeof(caminho), "%s.%d.txt", base, i);
+        unlink(caminho);
+        snprintf(caminho, sizeof(caminho), "%s.%d.txt.diario", base, i);
+        unlink(caminho);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        printf("Uso: %s <executavel rodovias> [cidades] [regioes] [semente]\n", argv[0]);
+        return 1;
+    }
+    int quantidadeCidades = argc > 2 ? atoi(argv[2]) : 10000;
+    int regioes = argc > 3 ? atoi(argv[3]) : 4;
+    unsigned int semente = argc > 4 ? (unsigned int)atoi(argv[4]) : 1;
+    if (quantidadeCidades < 10 || regioes < 1 || regioes > MAXIMO_REGIOES)
+    {
+        printf("Uso: %s <executavel rodovias> [cidades] [regioes] [semente]\n", argv[0]);
+        return 1;
+    }
+
+    char base[128], arquivo[160], socketMonolitico[160], socketCoordenador[160];
+    snprintf(base, sizeof(base), "/tmp/fragmentos.%d", (int)getpid());
+    snprintf(arquivo, sizeof(arquivo), "%s", base);
+    snprintf(socketMonolitico, sizeof(socketMonolitico), "%s.mono", base);
+    snprintf(socketCoordenador, sizeof(socketCoordenador), "%s.coord", base);
+
+    int lado = (int)sqrt(quantidadeCidades);
+    Rodovia *lista = gerarRede(lado, 40, semente);
+    if (!gravarRede(lista, arquivo))
+    {
+        printf("Erro ao gravar a rede em '%s'!\n", arquivo);
+        liberarMemoria(lista);
+        return 1;
+    }
+    liberarMemoria(lista);
+
+    fflush(stdout);
+    if (executarParticionamento(arquivo, base, regioes) != 0)
+    {
+        removerArquivos(base, regioes);
+        return 1;
+    }
+
+    char manifesto[160];
+    snprintf(manifesto, sizeof(manifesto), "%s.regioes", base);
+    ClienteFragmentos monolitico = {0}, coordenador = {0};
+    fflush(stdout);
+    double inicio = agoraSegundos();
+    int sucesso = iniciarProcesso(&monolitico, argv[1], "--servidor", arquivo, socketMonolitico) &&
+                  iniciarProcesso(&coordenador, argv[1], "--coordenador", manifesto, socketCoordenador);
+    printf("Processos prontos em %.2f s.\n", agoraSegundos() - inicio);
+
+    long divergencias = 0, rotas = 0, semRota = 0;
+    double tempoMonolitico = 0, tempoCoordenador = 0;
+    for (int i = 0; sucesso && i < CONSULTAS_FRAGMENTOS; i++)
+    {
+        char origem[50], destino[50], resposta1[256], resposta2[256];
+        snprintf(origem, sizeof(origem), "Cidade %d", (int)(rand_r(&semente) % (lado * lado + 1)));
+        snprintf(destino, sizeof(destino), "Cidade %d", (int)(rand_r(&semente) % (lado * lado + 1)));
+
+        double distancia1 = 0, pedagio1 = 0, distancia2 = 0, pedagio2 = 0;
+        double instante = agoraSegundos();
+        int situacao1 = consultarDistancia(&monolitico, origem, destino, &distancia1, &pedagio1, resposta1,
+                                           sizeof(resposta1));
+        tempoMonolitico += agoraSegundos() - instante;
+        instante = agoraSegundos();
+        int situacao2 = consultarDistancia(&coordenador, origem, destino, &distancia2, &pedagio2, resposta2,
+                                           sizeof(resposta2));
+        tempoCoordenador += agoraSegundos() - instante;
+
+        if (situacao1 < 0 || situacao2 < 0)
+        {
+            printf("Erro de comunicação com os servidores!\n");
+            sucesso = 0;
+            break;
+        }
+        rotas += situacao1 == 1;
+        semRota += situacao1 == 0;
+        if (situacao1 != situacao2 || (situacao1 == 0 && strcmp(resposta1, resposta2) != 0) ||
+            fabs(distancia1 - distancia2) > 0.05 + 1e-5 * distancia1)
+        {
+            if (divergencias++ == 0)
+            {
+                printf("Divergência em %s -> %s: monolítico '%s' %.2f km, coordenador '%s' %.2f km\n", origem,
+                       destino, resposta1, distancia1, resposta2, distancia2);
+            }
+        }
+    }
+
+    encerrarProcesso(&monolitico);
+    encerrarProcesso(&coordenador);
+    removerArquivos(base, regioes);
+
+    if (!sucesso)
+    {
+        printf("Falha ao executar a verificação das regiões.\n");
+        return 1;
+    }
+    printf("%d consultas (%ld com rota, %ld sem rota ou com cidade ausente), %ld divergência(s).\n",
+           CONSULTAS_FRAGMENTOS, rotas, semRota, divergencias);
+    printf("Monolítico: %.1f us/consulta, coordenador com %d regiões: %.1f us/consulta\n",
+           tempoMonolitico * 1e6 / CONSULTAS_FRAGMENTOS, regioes, tempoCoordenador * 1e6 / CONSULTAS_FRAGMENTOS);
+    return divergencias == 0 ? 0 : 1;
+}
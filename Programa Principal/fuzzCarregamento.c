@@ -0,0 +1,155 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "estruturas.h"
+
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+    (void)argc;
+    (void)argv;
+    int nulo = open("/dev/null", O_WRONLY);
+    dup2(nulo, STDOUT_FILENO);
+    close(nulo);
+    return 0;
+}
+
+static void corrigirVerificacoes(uint8_t *dados, size_t tamanho)
+{
+    CabecalhoRedeCompactada cabecalho;
+    memcpy(&cabecalho, dados, sizeof(cabecalho));
+    if (cabecalho.posicaoDiretorio > tamanho ||
+        cabecalho.quantidadeBlocos > (tamanho - cabecalho.posicaoDiretorio) / sizeof(BlocoCompactado))
+    {
+        return;
+    }
+    for (uint32_t b = 0; b < cabecalho.quantidadeBlocos; b++)
+    {
+        BlocoCompactado bloco;
+        size_t posicao = cabecalho.posicaoDiretorio + b * sizeof(BlocoCompactado);
+        memcpy(&bloco, dados + posicao, sizeof(bloco));
+        if (bloco.posicao <= tamanho && bloco.tamanho <= tamanho - bloco.posicao)
+        {
+            uint32_t hash = 2166136261u;
+            for (uint32_t i = 0; i < bloco.tamanho; i++)
+            {
+                hash = (hash ^ dados[bloco.posicao + i]) * 16777619u;
+            }
+            bloco.verificacao = hash;
+            memcpy(dados + posicao, &bloco, sizeof(bloco));
+        }
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *dados, size_t tamanho)
+{
+    int compactado = tamanho >= sizeof(CabecalhoRedeCompactada) &&
+                     memcmp(dados, ASSINATURA_REDE_COMPACTADA, strlen(ASSINATURA_REDE_COMPACTADA)) == 0;
+    uint8_t *corrigidos = NULL;
+    if (compactado && (corrigidos = malloc(tamanho)) != NULL)
+    {
+        memcpy(corrigidos, dados, tamanho);
+        corrigirVerificacoes(corrigidos, tamanho);
+        dados = corrigidos;
+    }
+
+    int descritor = memfd_create("rodovias", 0);
+    if (descritor < 0)
+    {
+        free(corrigidos);
+        return 0;
+    }
+    for (size_t escritos = 0; escritos < tamanho;)
+    {
+        ssize_t n = write(descritor, dados + escritos, tamanho - escritos);
+        if (n <= 0)
+        {
+            close(descritor);
+            free(corrigidos);
+            return 0;
+        }
+        escritos += n;
+    }
+    free(corrigidos);
+
+    char caminho[64];
+    snprintf(caminho, sizeof(caminho), "/proc/self/fd/%d", descritor);
+    Rodovia *lista = NULL;
+    if (compactado)
+    {
+        Rodovia *avulsa = NULL;
+        carregarRodoviaCompactada(caminho, "BR-116", &avulsa);
+        liberarMemoria(avulsa);
+        carregarRedeCompactada(&lista, caminho, 2);
+    }
+    else
+    {
+        carregarRodoviasDeArquivo(&lista, caminho);
+    }
+
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        calcularPedagioTotal(r);
+        if (r->cidades != NULL)
+        {
+            Cidade *ultima = r->cidades;
+            while (ultima->proxima != NULL)
+            {
+                ultima = ultima->proxima;
+            }
+            Centavos pedagio;
+            Metros distancia;
+            somarPercurso(r, ultima->nomeCidade, r->cidades->nomeCidade, &pedagio, &distancia);
+        }
+    }
+
+    conectarRodovias(lista);
+    conectarRodovias(lista);
+    Grafo *grafo = construirGrafo(lista);
+    if (grafo != NULL && grafo->quantidadeVertices > 0)
+    {
+        BuscaAlcance busca;
+        memset(&busca, 0, sizeof(busca));
+        if (prepararBuscaAlcance(&busca, grafo))
+        {
+            buscarAlcance(&busca, 0, ALCANCE_DISTANCIA, 1000);
+        }
+        liberarBuscaAlcance(&busca);
+    }
+    liberarGrafo(grafo);
+
+    imprimirRodoviasEmArquivo(lista, "/dev/null");
+    liberarMemoria(lista);
+    close(descritor);
+    return 0;
+}
+
+#ifdef FUZZ_AVULSO
+int main(int argc, char *argv[])
+{
+    LLVMFuzzerInitialize(&argc, &argv);
+    for (int i = 1; i < argc; i++)
+    {
+        FILE *arquivo = fopen(argv[i], "rb");
+        if (arquivo == NULL)
+        {
+            continue;
+        }
+        fseek(arquivo, 0, SEEK_END);
+        long tamanho = ftell(arquivo);
+        rewind(arquivo);
+        uint8_t *dados = malloc(tamanho > 0 ? tamanho : 1);
+        if (dados != NULL && fread(dados, 1, tamanho, arquivo) == (size_t)tamanho)
+        {
+            LLVMFuzzerTestOneInput(dados, tamanho);
+        }
+        free(dados);
+        fclose(arquivo);
+    }
+    return 0;
+}
+#endif
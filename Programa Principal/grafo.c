@@ -0,0 +1,941 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "estruturas.h"
+
+static int localizarVertice(Grafo *grafo, char chave[], unsigned int hash, int inserir)
+{
+    int mascara = grafo->capacidadeTabela - 1;
+    for (int posicao = hash & mascara;; posicao = (posicao + 1) & mascara)
+    {
+        int vertice = grafo->tabela[posicao];
+        if (vertice < 0)
+        {
+            if (!inserir)
+            {
+                return -1;
+            }
+            vertice = grafo->quantidadeVertices++;
+            grafo->tabela[posicao] = vertice;
+            memcpy(grafo->chaves[vertice], chave, TAMANHO_CHAVE);
+            grafo->hashes[vertice] = hash;
+            return vertice;
+        }
+        if (mesmaChave(grafo->hashes[vertice], grafo->chaves[vertice], hash, chave))
+        {
+            return vertice;
+        }
+    }
+}
+
+Grafo *construirGrafo(Rodovia *lista)
+{
+    int totalCidades = 0, totalTrechos = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        totalCidades += r->numeroCidades;
+        totalTrechos += r->numeroCidades > 0 ? r->numeroCidades - 1 : 0;
+    }
+
+    Grafo *grafo = calloc(1, sizeof(Grafo));
+    if (grafo == NULL)
+    {
+        return NULL;
+    }
+
+    grafo->capacidadeTabela = 16;
+    while (grafo->capacidadeTabela < 2 * totalCidades)
+    {
+        grafo->capacidadeTabela *= 2;
+    }
+    grafo->tabela = malloc(sizeof(int) * grafo->capacidadeTabela);
+    grafo->nomes = malloc(sizeof(char[50]) * (totalCidades + 1));
+    grafo->chaves = malloc(sizeof(char[TAMANHO_CHAVE]) * (totalCidades + 1));
+    grafo->hashes = malloc(sizeof(unsigned int) * (totalCidades + 1));
+    grafo->primeiraAresta = calloc(totalCidades + 2, sizeof(int));
+    grafo->destinos = malloc(sizeof(int) * (2 * totalTrechos + 1));
+    grafo->distancias = malloc(sizeof(Metros) * (2 * totalTrechos + 1));
+    grafo->pedagios = malloc(sizeof(Centavos) * (2 * totalTrechos + 1));
+    grafo->rodovias = malloc(sizeof(Rodovia *) * (2 * totalTrechos + 1));
+    grafo->trechos = malloc(sizeof(int) * (2 * totalTrechos + 1));
+    grafo->gemeas = malloc(sizeof(int) * (2 * totalTrechos + 1));
+    grafo->segmentos = malloc(sizeof(int) * (2 * totalTrechos + 1));
+    grafo->arestasSegmentos = malloc(sizeof(int) * (totalTrechos + 1));
+    grafo->interditados = calloc(totalTrechos / 64 + 1, sizeof(uint64_t));
+    grafo->removidos = calloc(totalTrechos / 64 + 1, sizeof(uint64_t));
+    grafo->versoesSegmentos = calloc(totalTrechos + 1, sizeof(unsigned long));
+    grafo->ocorrencias = calloc(totalCidades + 1, sizeof(int));
+    int *verticesCidades = malloc(sizeof(int) * (totalCidades + 1));
+    if (grafo->tabela == NULL || grafo->nomes == NULL || grafo->chaves == NULL || grafo->hashes == NULL ||
+        grafo->primeiraAresta == NULL || grafo->destinos == NULL || grafo->distancias == NULL ||
+        grafo->pedagios == NULL || grafo->rodovias == NULL || grafo->trechos == NULL || grafo->gemeas == NULL ||
+        grafo->segmentos == NULL || grafo->arestasSegmentos == NULL || grafo->interditados == NULL ||
+        grafo->removidos == NULL || grafo->versoesSegmentos == NULL || grafo->ocorrencias == NULL ||
+        verticesCidades == NULL)
+    {
+        free(verticesCidades);
+        liberarGrafo(grafo);
+        return NULL;
+    }
+    memset(grafo->tabela, -1, sizeof(int) * grafo->capacidadeTabela);
+
+    int posicao = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima)
+        {
+            int existentes = grafo->quantidadeVertices;
+            int vertice = localizarVertice(grafo, c->chave, c->hash, 1);
+            if (vertice == existentes)
+            {
+                strcpy(grafo->nomes[vertice], c->nomeCidade);
+            }
+            grafo->ocorrencias[vertice]++;
+            verticesCidades[posicao++] = vertice;
+            if (c->anterior != NULL)
+            {
+                grafo->primeiraAresta[vertice + 1]++;
+                grafo->primeiraAresta[verticesCidades[posicao - 2] + 1]++;
+            }
+        }
+    }
+
+    for (int v = 0; v < grafo->quantidadeVertices; v++)
+    {
+        grafo->primeiraAresta[v + 1] += grafo->primeiraAresta[v];
+    }
+    grafo->quantidadeArestas = grafo->primeiraAresta[grafo->quantidadeVertices];
+
+    int *proximaLivre = malloc(sizeof(int) * (grafo->quantidadeVertices + 1));
+    if (proximaLivre == NULL)
+    {
+        free(verticesCidades);
+        liberarGrafo(grafo);
+        return NULL;
+    }
+    memcpy(proximaLivre, grafo->primeiraAresta, sizeof(int) * (grafo->quantidadeVertices + 1));
+
+    posicao = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima, posicao++)
+        {
+            if (c->anterior == NULL)
+            {
+                continue;
+            }
+            int a = verticesCidades[posicao - 1], b = verticesCidades[posicao];
+            int trecho = c->anterior->indice;
+            Metros distancia = c->distancia - c->anterior->distancia;
+
+            int ida = proximaLivre[a]++;
+            grafo->destinos[ida] = b;
+            grafo->distancias[ida] = distancia;
+            grafo->pedagios[ida] = pedagioTrecho(r, trecho, 1);
+            grafo->rodovias[ida] = r;
+            grafo->trechos[ida] = trecho;
+
+            int volta = proximaLivre[b]++;
+            grafo->destinos[volta] = a;
+            grafo->distancias[volta] = distancia;
+            grafo->pedagios[volta] = pedagioTrecho(r, trecho, -1);
+            grafo->rodovias[volta] = r;
+            grafo->trechos[volta] = trecho;
+
+            grafo->gemeas[ida] = volta;
+            grafo->gemeas[volta] = ida;
+            grafo->arestasSegmentos[grafo->quantidadeSegmentos] = ida;
+            grafo->segmentos[ida] = grafo->quantidadeSegmentos;
+            grafo->segmentos[volta] = grafo->quantidadeSegmentos++;
+        }
+    }
+
+    free(proximaLivre);
+    free(verticesCidades);
+    return grafo;
+}
+
+void liberarGrafo(Grafo *grafo)
+{
+    if (grafo == NULL)
+    {
+        return;
+    }
+    free(grafo->tabela);
+    free(grafo->nomes);
+    free(grafo->chaves);
+    free(grafo->hashes);
+    free(grafo->primeiraAresta);
+    free(grafo->destinos);
+    free(grafo->distancias);
+    free(grafo->pedagios);
+    free(grafo->rodovias);
+    free(grafo->trechos);
+    free(grafo->gemeas);
+    free(grafo->segmentos);
+    free(grafo->arestasSegmentos);
+    free(grafo->interditados);
+    free(grafo->removidos);
+    free(grafo->versoesSegmentos);
+    free(grafo->ocorrencias);
+    free(grafo);
+}
+
+int buscarVertice(Grafo *grafo, char nome[])
+{
+    char chave[TAMANHO_CHAVE];
+    normalizarNome(nome, chave);
+    int vertice = localizarVertice(grafo, chave, calcularHash(chave), 0);
+    return vertice >= 0 && grafo->ocorrencias[vertice] > 0 ? vertice : -1;
+}
+
+int primeiroSegmento(Grafo *grafo, Rodovia *rodovia)
+{
+    if (rodovia->numeroCidades < 2)
+    {
+        return -1;
+    }
+    Cidade *c = rodovia->cidades;
+    int v = localizarVertice(grafo, c->chave, c->hash, 0);
+    for (int e = v < 0 ? 0 : grafo->primeiraAresta[v]; v >= 0 && e < grafo->primeiraAresta[v + 1]; e++)
+    {
+        if (grafo->rodovias[e] == rodovia && grafo->trechos[e] == 0)
+        {
+            return grafo->segmentos[e];
+        }
+    }
+    return -1;
+}
+
+void marcarSegmentos(uint64_t marcados[], int inicio, int fim)
+{
+    for (int s = inicio; s < fim; s++)
+    {
+        marcados[s >> 6] |= (uint64_t)1 << (s & 63);
+    }
+}
+
+static int segmentoMarcado(const uint64_t marcados[], int segmento)
+{
+    return (marcados[segmento >> 6] >> (segmento & 63)) & 1;
+}
+
+static void copiarMarca(uint64_t marcados[], int destino, int origem)
+{
+    uint64_t bit = (uint64_t)1 << (destino & 63);
+    marcados[destino >> 6] = segmentoMarcado(marcados, origem) ? marcados[destino >> 6] | bit
+                                                                 : marcados[destino >> 6] & ~bit;
+}
+
+static void sepultarSegmento(Grafo *grafo, int segmento, unsigned long versao)
+{
+    int ida = grafo->arestasSegmentos[segmento];
+    grafo->trechos[ida] = -1;
+    grafo->trechos[grafo->gemeas[ida]] = -1;
+    marcarSegmentos(grafo->removidos, segmento, segmento + 1);
+    marcarSegmentos(grafo->interditados, segmento, segmento + 1);
+    grafo->versoesSegmentos[segmento] = versao;
+}
+
+int removerRodoviaGrafo(Grafo *grafo, Rodovia *rodovia, unsigned long versao)
+{
+    int base = primeiroSegmento(grafo, rodovia);
+    for (Cidade *c = rodovia->cidades; c != NULL; c = c->proxima)
+    {
+        int vertice = localizarVertice(grafo, c->chave, c->hash, 0);
+        if (vertice >= 0)
+        {
+            grafo->ocorrencias[vertice]--;
+        }
+    }
+    if (base < 0)
+    {
+        return 0;
+    }
+    for (int s = base; s < base + rodovia->numeroCidades - 1; s++)
+    {
+        sepultarSegmento(grafo, s, versao);
+    }
+    return rodovia->numeroCidades - 1;
+}
+
+void removerCidadeGrafo(Grafo *grafo, int vertice, int base, int indice, int cidades, unsigned long versao)
+{
+    if (vertice >= 0)
+    {
+        grafo->ocorrencias[vertice]--;
+    }
+    if (base < 0 || cidades < 2)
+    {
+        return;
+    }
+
+    int ultimo = base + cidades - 2;
+    int morto = indice == 0 ? base : indice == cidades - 1 ? ultimo : base + indice;
+    if (indice > 0 && indice < cidades - 1)
+    {
+        int ida = grafo->arestasSegmentos[base + indice - 1], volta = grafo->gemeas[ida];
+        int seguinte = grafo->arestasSegmentos[base + indice], retorno = grafo->gemeas[seguinte];
+        grafo->destinos[ida] = grafo->destinos[seguinte];
+        grafo->destinos[retorno] = grafo->destinos[volta];
+        grafo->gemeas[ida] = retorno;
+        grafo->gemeas[retorno] = ida;
+        grafo->gemeas[volta] = seguinte;
+        grafo->gemeas[seguinte] = volta;
+        grafo->segmentos[retorno] = base + indice - 1;
+        grafo->trechos[retorno] = indice - 1;
+        grafo->arestasSegmentos[base + indice] = seguinte;
+        grafo->segmentos[volta] = base + indice;
+    }
+
+    int idaMorta = grafo->arestasSegmentos[morto];
+    for (int s = morto; s < ultimo; s++)
+    {
+        int e = grafo->arestasSegmentos[s + 1];
+        grafo->arestasSegmentos[s] = e;
+        grafo->segmentos[e] = s;
+        grafo->segmentos[grafo->gemeas[e]] = s;
+        grafo->trechos[e]--;
+        grafo->trechos[grafo->gemeas[e]]--;
+        grafo->versoesSegmentos[s] = grafo->versoesSegmentos[s + 1];
+        copiarMarca(grafo->interditados, s, s + 1);
+    }
+    grafo->arestasSegmentos[ultimo] = idaMorta;
+    grafo->segmentos[idaMorta] = ultimo;
+    grafo->segmentos[grafo->gemeas[idaMorta]] = ultimo;
+    sepultarSegmento(grafo, ultimo, versao);
+}
+
+static int arestaBloqueada(BuscaRotas *busca, int aresta)
+{
+    Grafo *grafo = busca->grafo;
+    return segmentoMarcado(busca->bloqueados, grafo->segmentos[aresta]) ||
+           grafo->pedagios[aresta] > busca->pedagioMaximo;
+}
+
+int iniciarBuscaRotas(BuscaRotas *busca, Grafo *grafo, int limiteRotulos)
+{
+    int vertices = grafo->quantidadeVertices + 1;
+    busca->grafo = grafo;
+    busca->limiteRotulos = limiteRotulos;
+    busca->quantidadeRotulos = 0;
+    busca->tamanhoHeap = 0;
+    busca->tamanhoFila = 0;
+    busca->geracao = 0;
+    busca->truncada = 0;
+    busca->bloqueados = grafo->interditados;
+    busca->pedagioMaximo = CUSTO_INFINITO;
+    busca->rotulos = malloc(sizeof(RotuloRota) * limiteRotulos);
+    busca->heap = malloc(sizeof(int) * limiteRotulos);
+    busca->fila = malloc(sizeof(EntradaFila) * (grafo->quantidadeArestas + 1));
+    busca->melhorPedagio = malloc(sizeof(Centavos) * vertices);
+    busca->limiteDistancia = malloc(sizeof(Metros) * vertices);
+    busca->limitePedagio = malloc(sizeof(Centavos) * vertices);
+    busca->visitas = malloc(sizeof(int) * vertices);
+    busca->marcas = calloc(vertices, sizeof(unsigned int));
+    if (busca->rotulos == NULL || busca->heap == NULL || busca->fila == NULL || busca->melhorPedagio == NULL ||
+        busca->limiteDistancia == NULL || busca->limitePedagio == NULL || busca->visitas == NULL ||
+        busca->marcas == NULL)
+    {
+        liberarBuscaRotas(busca);
+        return 0;
+    }
+    return 1;
+}
+
+void liberarBuscaRotas(BuscaRotas *busca)
+{
+    free(busca->rotulos);
+    free(busca->heap);
+    free(busca->fila);
+    free(busca->melhorPedagio);
+    free(busca->limiteDistancia);
+    free(busca->limitePedagio);
+    free(busca->visitas);
+    free(busca->marcas);
+    busca->rotulos = NULL;
+    busca->heap = NULL;
+    busca->fila = NULL;
+    busca->melhorPedagio = NULL;
+    busca->limiteDistancia = NULL;
+    busca->limitePedagio = NULL;
+    busca->visitas = NULL;
+    busca->marcas = NULL;
+}
+
+void inserirFila(EntradaFila fila[], int *tamanho, int64_t chave, int vertice)
+{
+    int posicao = (*tamanho)++;
+    while (posicao > 0)
+    {
+        int pai = (posicao - 1) / 2;
+        if (fila[pai].chave <= chave)
+        {
+            break;
+        }
+        fila[posicao] = fila[pai];
+        posicao = pai;
+    }
+    fila[posicao].chave = chave;
+    fila[posicao].vertice = vertice;
+}
+
+EntradaFila retirarFila(EntradaFila fila[], int *tamanho)
+{
+    EntradaFila topo = fila[0];
+    EntradaFila ultima = fila[--(*tamanho)];
+    int posicao = 0;
+    for (;;)
+    {
+        int filho = 2 * posicao + 1;
+        if (filho >= *tamanho)
+        {
+            break;
+        }
+        if (filho + 1 < *tamanho && fila[filho + 1].chave < fila[filho].chave)
+        {
+            filho++;
+        }
+        if (fila[filho].chave >= ultima.chave)
+        {
+            break;
+        }
+        fila[posicao] = fila[filho];
+        posicao = filho;
+    }
+    fila[posicao] = ultima;
+    return topo;
+}
+
+static int rotuloAntes(RotuloRota *a, RotuloRota *b)
+{
+    if (a->custo != b->custo)
+    {
+        return a->custo < b->custo;
+    }
+    if (a->distancia != b->distancia)
+    {
+        return a->distancia < b->distancia;
+    }
+    return a->pedagio < b->pedagio;
+}
+
+static void subirHeap(BuscaRotas *busca, int posicao)
+{
+    int *heap = busca->heap;
+    int rotulo = heap[posicao];
+    while (posicao > 0)
+    {
+        int pai = (posicao - 1) / 2;
+        if (!rotuloAntes(&busca->rotulos[rotulo], &busca->rotulos[heap[pai]]))
+        {
+            break;
+        }
+        heap[posicao] = heap[pai];
+        posicao = pai;
+    }
+    heap[posicao] = rotulo;
+}
+
+static int retirarHeap(BuscaRotas *busca)
+{
+    int *heap = busca->heap;
+    int topo = heap[0];
+    int rotulo = heap[--busca->tamanhoHeap];
+    int posicao = 0;
+    for (;;)
+    {
+        int filho = 2 * posicao + 1;
+        if (filho >= busca->tamanhoHeap)
+        {
+            break;
+        }
+        if (filho + 1 < busca->tamanhoHeap &&
+            rotuloAntes(&busca->rotulos[heap[filho + 1]], &busca->rotulos[heap[filho]]))
+        {
+            filho++;
+        }
+        if (!rotuloAntes(&busca->rotulos[heap[filho]], &busca->rotulos[rotulo]))
+        {
+            break;
+        }
+        heap[posicao] = heap[filho];
+        posicao = filho;
+    }
+    heap[posicao] = rotulo;
+    return topo;
+}
+
+static void tocarVertice(BuscaRotas *busca, int vertice)
+{
+    if (busca->marcas[vertice] != busca->geracao)
+    {
+        busca->marcas[vertice] = busca->geracao;
+        busca->melhorPedagio[vertice] = CUSTO_INFINITO;
+        busca->limiteDistancia[vertice] = CUSTO_INFINITO;
+        busca->limitePedagio[vertice] = CUSTO_INFINITO;
+        busca->visitas[vertice] = 0;
+    }
+}
+
+static void calcularLimites(BuscaRotas *busca, int destino, int64_t limites[], int porPedagio)
+{
+    Grafo *grafo = busca->grafo;
+    busca->tamanhoFila = 0;
+    limites[destino] = 0;
+    inserirFila(busca->fila, &busca->tamanhoFila, 0, destino);
+
+    while (busca->tamanhoFila > 0)
+    {
+        EntradaFila entrada = retirarFila(busca->fila, &busca->tamanhoFila);
+        int v = entrada.vertice;
+        if (entrada.chave > limites[v])
+        {
+            continue;
+        }
+
+        for (int e = grafo->primeiraAresta[v]; e < grafo->primeiraAresta[v + 1]; e++)
+        {
+            if (arestaBloqueada(busca, grafo->gemeas[e]))
+            {
+                continue;
+            }
+            int w = grafo->destinos[e];
+            int64_t peso = porPedagio ? grafo->pedagios[grafo->gemeas[e]] : grafo->distancias[e];
+            tocarVertice(busca, w);
+            if (entrada.chave + peso < limites[w])
+            {
+                limites[w] = entrada.chave + peso;
+                inserirFila(busca->fila, &busca->tamanhoFila, limites[w], w);
+            }
+        }
+    }
+}
+
+static void reiniciarBusca(BuscaRotas *busca, int destino)
+{
+    busca->quantidadeRotulos = 0;
+    busca->tamanhoHeap = 0;
+    busca->truncada = 0;
+    if (++busca->geracao == 0)
+    {
+        memset(busca->marcas, 0, sizeof(unsigned int) * (busca->grafo->quantidadeVertices + 1));
+        busca->geracao = 1;
+    }
+
+    tocarVertice(busca, destino);
+    calcularLimites(busca, destino, busca->limiteDistancia, 0);
+    calcularLimites(busca, destino, busca->limitePedagio, 1);
+}
+
+static int empilharRotulo(BuscaRotas *busca, int vertice, Metros distancia, Centavos pedagio, double custo,
+                          int anterior, int aresta)
+{
+    if (busca->quantidadeRotulos == busca->limiteRotulos)
+    {
+        busca->truncada = 1;
+        return 0;
+    }
+    int indice = busca->quantidadeRotulos++;
+    RotuloRota *rotulo = &busca->rotulos[indice];
+    rotulo->vertice = vertice;
+    rotulo->distancia = distancia;
+    rotulo->pedagio = pedagio;
+    rotulo->custo = custo;
+    rotulo->anterior = anterior;
+    rotulo->aresta = aresta;
+
+    busca->heap[busca->tamanhoHeap++] = indice;
+    subirHeap(busca, busca->tamanhoHeap - 1);
+    return 1;
+}
+
+int rotasPareto(BuscaRotas *busca, int origem, int destino, RotaAlternativa rotas[], int maximoRotas)
+{
+    Grafo *grafo = busca->grafo;
+    int quantidade = 0;
+
+    reiniciarBusca(busca, destino);
+    if (busca->marcas[origem] != busca->geracao || busca->limiteDistancia[origem] == CUSTO_INFINITO)
+    {
+        return 0;
+    }
+    empilharRotulo(busca, origem, 0, 0, (double)busca->limiteDistancia[origem], -1, -1);
+
+    while (busca->tamanhoHeap > 0 && quantidade < maximoRotas)
+    {
+        int indice = retirarHeap(busca);
+        RotuloRota rotulo = busca->rotulos[indice];
+        int v = rotulo.vertice;
+
+        if (rotulo.pedagio >= busca->melhorPedagio[v] ||
+            rotulo.pedagio + busca->limitePedagio[v] >= busca->melhorPedagio[destino])
+        {
+            continue;
+        }
+        busca->melhorPedagio[v] = rotulo.pedagio;
+
+        if (v == destino)
+        {
+            rotas[quantidade].distancia = rotulo.distancia;
+            rotas[quantidade].pedagio = rotulo.pedagio;
+            rotas[quantidade].rotulo = indice;
+            quantidade++;
+            continue;
+        }
+
+        for (int e = grafo->primeiraAresta[v]; e < grafo->primeiraAresta[v + 1]; e++)
+        {
+            int w = grafo->destinos[e];
+            Centavos pedagio = rotulo.pedagio + grafo->pedagios[e];
+            if (arestaBloqueada(busca, e) || busca->marcas[w] != busca->geracao ||
+                busca->limiteDistancia[w] == CUSTO_INFINITO || pedagio >= busca->melhorPedagio[w] ||
+                pedagio + busca->limitePedagio[w] >= busca->melhorPedagio[destino])
+            {
+                continue;
+            }
+            Metros distancia = rotulo.distancia + grafo->distancias[e];
+            empilharRotulo(busca, w, distancia, pedagio, (double)(distancia + busca->limiteDistancia[w]), indice, e);
+        }
+    }
+    return quantidade;
+}
+
+static int buscarDesvio(BuscaRotas *busca, int raiz, int destino, double pesoDistancia, double pesoPedagio, int marca,
+                        int proibidas[], int quantidadeProibidas)
+{
+    Grafo *grafo = busca->grafo;
+    busca->tamanhoHeap = 0;
+    busca->heap[busca->tamanhoHeap++] = raiz;
+
+    while (busca->tamanhoHeap > 0)
+    {
+        int indice = retirarHeap(busca);
+        RotuloRota rotulo = busca->rotulos[indice];
+        int v = rotulo.vertice;
+        if (busca->visitas[v] == marca)
+        {
+            continue;
+        }
+        busca->visitas[v] = marca;
+        if (v == destino)
+        {
+            return indice;
+        }
+
+        for (int e = grafo->primeiraAresta[v]; e < grafo->primeiraAresta[v + 1]; e++)
+        {
+            int w = grafo->destinos[e];
+            if (arestaBloqueada(busca, e) || busca->marcas[w] != busca->geracao || busca->visitas[w] == marca ||
+                busca->limiteDistancia[w] == CUSTO_INFINITO)
+            {
+                continue;
+            }
+            int proibida = 0;
+            for (int i = 0; indice == raiz && i < quantidadeProibidas; i++)
+            {
+                proibida |= proibidas[i] == e;
+            }
+            if (proibida)
+            {
+                continue;
+            }
+            Metros distancia = rotulo.distancia + grafo->distancias[e];
+            Centavos pedagio = rotulo.pedagio + grafo->pedagios[e];
+            double custo = pesoDistancia * (double)(distancia + busca->limiteDistancia[w]) +
+                           pesoPedagio * (double)(pedagio + busca->limitePedagio[w]);
+            if (!empilharRotulo(busca, w, distancia, pedagio, custo, indice, e))
+            {
+                return -1;
+            }
+        }
+    }
+    return -1;
+}
+
+static int mesmaRota(BuscaRotas *busca, int rotulo1, int rotulo2)
+{
+    while (rotulo1 != rotulo2)
+    {
+        if (rotulo1 < 0 || rotulo2 < 0 || busca->rotulos[rotulo1].aresta != busca->rotulos[rotulo2].aresta)
+        {
+            return 0;
+        }
+        rotulo1 = busca->rotulos[rotulo1].anterior;
+        rotulo2 = busca->rotulos[rotulo2].anterior;
+    }
+    return 1;
+}
+
+static void inserirCandidata(BuscaRotas *busca, int candidatas[], int *quantidade, int vagas, int rotulo)
+{
+    int posicao = *quantidade;
+    for (int i = 0; i < *quantidade; i++)
+    {
+        if (mesmaRota(busca, candidatas[i], rotulo))
+        {
+            return;
+        }
+        if (posicao == *quantidade && rotuloAntes(&busca->rotulos[rotulo], &busca->rotulos[candidatas[i]]))
+        {
+            posicao = i;
+        }
+    }
+    if (posicao >= vagas)
+    {
+        return;
+    }
+    int deslocadas = (*quantidade < vagas ? *quantidade : vagas - 1) - posicao;
+    memmove(&candidatas[posicao + 1], &candidatas[posicao], sizeof(int) * deslocadas);
+    candidatas[posicao] = rotulo;
+    *quantidade = posicao + deslocadas + 1;
+}
+
+int rotasPonderadas(BuscaRotas *busca, int origem, int destino, float pesoDistancia, float pesoPedagio,
+                    RotaAlternativa rotas[], int maximoRotas)
+{
+    double porMetro = pesoDistancia, porCentavo = (double)pesoPedagio * METROS_POR_KM / CENTAVOS_POR_REAL;
+    reiniciarBusca(busca, destino);
+    if (maximoRotas > MAXIMO_ROTAS_ALTERNATIVAS)
+    {
+        maximoRotas = MAXIMO_ROTAS_ALTERNATIVAS;
+    }
+    if (maximoRotas < 1 || busca->marcas[origem] != busca->geracao || busca->limiteDistancia[origem] == CUSTO_INFINITO)
+    {
+        return 0;
+    }
+    double custo = porMetro * (double)busca->limiteDistancia[origem] + porCentavo * (double)busca->limitePedagio[origem];
+    empilharRotulo(busca, origem, 0, 0, custo, -1, -1);
+
+    int marca = 1, quantidade = 0, quantidadeCandidatas = 0;
+    int candidatas[MAXIMO_ROTAS_ALTERNATIVAS], proibidas[MAXIMO_ROTAS_ALTERNATIVAS];
+    int inicios[MAXIMO_ROTAS_ALTERNATIVAS + 1] = {0};
+    unsigned char iguais[MAXIMO_ROTAS_ALTERNATIVAS];
+    int *caminhos = NULL;
+    int rotulo = buscarDesvio(busca, 0, destino, porMetro, porCentavo, marca, NULL, 0);
+
+    while (rotulo >= 0)
+    {
+        rotas[quantidade].distancia = busca->rotulos[rotulo].distancia;
+        rotas[quantidade].pedagio = busca->rotulos[rotulo].pedagio;
+        rotas[quantidade].rotulo = rotulo;
+
+        int comprimento = 0;
+        for (int r = rotulo; r >= 0; r = busca->rotulos[r].anterior)
+        {
+            comprimento++;
+        }
+        int *maiores = realloc(caminhos, sizeof(int) * (inicios[quantidade] + comprimento));
+        if (maiores == NULL)
+        {
+            busca->truncada = 1;
+            quantidade++;
+            break;
+        }
+        caminhos = maiores;
+        int *caminho = caminhos + inicios[quantidade];
+        for (int r = rotulo, i = comprimento; i > 0; r = busca->rotulos[r].anterior)
+        {
+            caminho[--i] = r;
+        }
+        inicios[quantidade + 1] = inicios[quantidade] + comprimento;
+        if (++quantidade == maximoRotas)
+        {
+            break;
+        }
+
+        int vagas = maximoRotas - quantidade;
+        quantidadeCandidatas = quantidadeCandidatas < vagas ? quantidadeCandidatas : vagas;
+        memset(iguais, 1, sizeof(iguais));
+        for (int i = 0; i + 1 < comprimento && !busca->truncada; i++)
+        {
+            int quantidadeProibidas = 0;
+            for (int j = 0; j < quantidade; j++)
+            {
+                int *outro = caminhos + inicios[j];
+                iguais[j] = iguais[j] && inicios[j + 1] - inicios[j] > i + 1 &&
+                            busca->rotulos[outro[i]].aresta == busca->rotulos[caminho[i]].aresta;
+                if (iguais[j])
+                {
+                    proibidas[quantidadeProibidas++] = busca->rotulos[outro[i + 1]].aresta;
+                }
+            }
+            if (quantidadeCandidatas == vagas &&
+                !rotuloAntes(&busca->rotulos[caminho[i]], &busca->rotulos[candidatas[vagas - 1]]))
+            {
+                continue;
+            }
+
+            marca++;
+            for (int m = 0; m < i; m++)
+            {
+                busca->visitas[busca->rotulos[caminho[m]].vertice] = marca;
+            }
+            int desvio = buscarDesvio(busca, caminho[i], destino, porMetro, porCentavo, marca, proibidas,
+                                      quantidadeProibidas);
+            if (desvio >= 0)
+            {
+                inserirCandidata(busca, candidatas, &quantidadeCandidatas, vagas, desvio);
+            }
+        }
+
+        rotulo = -1;
+        if (quantidadeCandidatas > 0)
+        {
+            rotulo = candidatas[0];
+            memmove(&candidatas[0], &candidatas[1], sizeof(int) * --quantidadeCandidatas);
+        }
+    }
+    free(caminhos);
+    return quantidade;
+}
+
+int arestasDaRota(BuscaRotas *busca, RotaAlternativa *rota, int arestas[], int maximo)
+{
+    int quantidade = 0;
+    for (int r = rota->rotulo; r >= 0 && busca->rotulos[r].aresta >= 0; r = busca->rotulos[r].anterior)
+    {
+        quantidade++;
+    }
+    if (quantidade > maximo)
+    {
+        return -1;
+    }
+
+    int posicao = quantidade;
+    for (int r = rota->rotulo; r >= 0 && busca->rotulos[r].aresta >= 0; r = busca->rotulos[r].anterior)
+    {
+        arestas[--posicao] = busca->rotulos[r].aresta;
+    }
+    return quantidade;
+}
+
+int prepararBuscaAlcance(BuscaAlcance *busca, Grafo *grafo)
+{
+    int vertices = grafo->quantidadeVertices + 1;
+    int arestas = grafo->quantidadeArestas + 1;
+    busca->grafo = grafo;
+
+    if (vertices > busca->capacidadeVertices)
+    {
+        Metros *distancias = realloc(busca->distancias, sizeof(Metros) * vertices);
+        if (distancias != NULL)
+            busca->distancias = distancias;
+        Centavos *pedagios = realloc(busca->pedagios, sizeof(Centavos) * vertices);
+        if (pedagios != NULL)
+            busca->pedagios = pedagios;
+        unsigned int *marcas = realloc(busca->marcas, sizeof(unsigned int) * vertices);
+        if (marcas != NULL)
+            busca->marcas = marcas;
+        unsigned int *fechadas = realloc(busca->fechadas, sizeof(unsigned int) * vertices);
+        if (fechadas != NULL)
+            busca->fechadas = fechadas;
+        CidadeAlcancada *alcancadas = realloc(busca->alcancadas, sizeof(CidadeAlcancada) * vertices);
+        if (alcancadas != NULL)
+            busca->alcancadas = alcancadas;
+
+        if (distancias == NULL || pedagios == NULL || marcas == NULL || fechadas == NULL || alcancadas == NULL)
+        {
+            return 0;
+        }
+        busca->capacidadeVertices = vertices;
+        busca->geracao = 0;
+    }
+
+    if (arestas > busca->capacidadeArestas)
+    {
+        EntradaFila *fila = realloc(busca->fila, sizeof(EntradaFila) * arestas);
+        if (fila == NULL)
+        {
+            return 0;
+        }
+        busca->fila = fila;
+        busca->capacidadeArestas = arestas;
+    }
+
+    if (busca->geracao == 0)
+    {
+        memset(busca->marcas, 0, sizeof(unsigned int) * busca->capacidadeVertices);
+        memset(busca->fechadas, 0, sizeof(unsigned int) * busca->capacidadeVertices);
+    }
+    return 1;
+}
+
+void liberarBuscaAlcance(BuscaAlcance *busca)
+{
+    free(busca->distancias);
+    free(busca->pedagios);
+    free(busca->marcas);
+    free(busca->fechadas);
+    free(busca->alcancadas);
+    free(busca->fila);
+    memset(busca, 0, sizeof(BuscaAlcance));
+}
+
+int buscarAlcance(BuscaAlcance *busca, int origem, int criterio, int64_t limite)
+{
+    Grafo *grafo = busca->grafo;
+    int64_t *custos = criterio == ALCANCE_PEDAGIO ? busca->pedagios : busca->distancias;
+    int64_t *secundarios = criterio == ALCANCE_PEDAGIO ? busca->distancias : busca->pedagios;
+    int64_t *pesos = criterio == ALCANCE_PEDAGIO ? grafo->pedagios : grafo->distancias;
+    int64_t *pesosSecundarios = criterio == ALCANCE_PEDAGIO ? grafo->distancias : grafo->pedagios;
+
+    if (++busca->geracao == 0)
+    {
+        memset(busca->marcas, 0, sizeof(unsigned int) * busca->capacidadeVertices);
+        memset(busca->fechadas, 0, sizeof(unsigned int) * busca->capacidadeVertices);
+        busca->geracao = 1;
+    }
+    unsigned int geracao = busca->geracao;
+    int alvosRestantes = busca->quantidadeAlvos;
+    busca->quantidadeAlcancadas = 0;
+    busca->tamanhoFila = 0;
+
+    busca->marcas[origem] = geracao;
+    custos[origem] = 0;
+    secundarios[origem] = 0;
+    inserirFila(busca->fila, &busca->tamanhoFila, 0, origem);
+
+    while (busca->tamanhoFila > 0)
+    {
+        EntradaFila entrada = retirarFila(busca->fila, &busca->tamanhoFila);
+        int v = entrada.vertice;
+        if (busca->fechadas[v] == geracao || entrada.chave > custos[v])
+        {
+            continue;
+        }
+        busca->fechadas[v] = geracao;
+
+        CidadeAlcancada *alcancada = &busca->alcancadas[busca->quantidadeAlcancadas++];
+        alcancada->vertice = v;
+        alcancada->distancia = busca->distancias[v];
+        alcancada->pedagio = busca->pedagios[v];
+        if (busca->alvos != NULL && busca->alvos[v] && --alvosRestantes == 0)
+        {
+            break;
+        }
+
+        for (int e = grafo->primeiraAresta[v]; e < grafo->primeiraAresta[v + 1]; e++)
+        {
+            int w = grafo->destinos[e];
+            int aresta = busca->reverso ? grafo->gemeas[e] : e;
+            int64_t custo = entrada.chave + pesos[aresta];
+            if (custo > limite || busca->fechadas[w] == geracao ||
+                segmentoMarcado(grafo->interditados, grafo->segmentos[e]))
+            {
+                continue;
+            }
+
+            int64_t secundario = secundarios[v] + pesosSecundarios[aresta];
+            if (busca->marcas[w] != geracao || custo < custos[w] ||
+                (custo == custos[w] && secundario < secundarios[w]))
+            {
+                busca->marcas[w] = geracao;
+                custos[w] = custo;
+                secundarios[w] = secundario;
+                inserirFila(busca->fila, &busca->tamanhoFila, custo, w);
+            }
+        }
+    }
+    return busca->quantidadeAlcancadas;
+}
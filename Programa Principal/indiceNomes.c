@@ -0,0 +1,432 @@
+#include <stdlib.h>
+#include <string.h>
+#include "estruturas.h"
+
+static int reservarNos(IndiceNomes *indice, int adicionais)
+{
+    if (indice->quantidadeNos + adicionais <= indice->capacidadeNos)
+    {
+        return 1;
+    }
+    int novaCapacidade = indice->capacidadeNos > 0 ? indice->capacidadeNos * 2 : 64;
+    while (novaCapacidade < indice->quantidadeNos + adicionais)
+    {
+        novaCapacidade *= 2;
+    }
+    NoIndiceNomes *nos = realloc(indice->nos, novaCapacidade * sizeof(NoIndiceNomes));
+    if (nos == NULL)
+    {
+        return 0;
+    }
+    indice->nos = nos;
+    indice->capacidadeNos = novaCapacidade;
+    return 1;
+}
+
+static int guardarTexto(IndiceNomes *indice, const char *texto, int tamanho)
+{
+    if (indice->tamanhoTextos + tamanho + 1 > indice->capacidadeTextos)
+    {
+        int novaCapacidade = indice->capacidadeTextos > 0 ? indice->capacidadeTextos * 2 : 1024;
+        while (novaCapacidade < indice->tamanhoTextos + tamanho + 1)
+        {
+            novaCapacidade *= 2;
+        }
+        char *textos = realloc(indice->textos, novaCapacidade);
+        if (textos == NULL)
+        {
+            return -1;
+        }
+        indice->textos = textos;
+        indice->capacidadeTextos = novaCapacidade;
+    }
+    int inicio = indice->tamanhoTextos;
+    memcpy(indice->textos + inicio, texto, tamanho);
+    indice->textos[inicio + tamanho] = '\0';
+    indice->tamanhoTextos += tamanho + 1;
+    return inicio;
+}
+
+static int novoNo(IndiceNomes *indice, int inicioRotulo, int tamanhoRotulo)
+{
+    NoIndiceNomes *no = &indice->nos[indice->quantidadeNos];
+    no->inicioRotulo = inicioRotulo;
+    no->tamanhoRotulo = tamanhoRotulo;
+    no->primeiroFilho = -1;
+    no->proximoIrmao = -1;
+    no->ocorrencias = 0;
+    no->inicioNome = -1;
+    return indice->quantidadeNos++;
+}
+
+int iniciarIndiceNomes(IndiceNomes *indice)
+{
+    memset(indice, 0, sizeof(IndiceNomes));
+    if (!reservarNos(indice, 1))
+    {
+        return 0;
+    }
+    novoNo(indice, 0, 0);
+    return 1;
+}
+
+void liberarIndiceNomes(IndiceNomes *indice)
+{
+    free(indice->nos);
+    free(indice->textos);
+    memset(indice, 0, sizeof(IndiceNomes));
+}
+
+static int prefixoComum(const char *a, int tamanho, const char *b)
+{
+    int i = 0;
+    while (i < tamanho && a[i] == b[i])
+    {
+        i++;
+    }
+    return i;
+}
+
+int inserirNomeIndice(IndiceNomes *indice, char nome[])
+{
+    char chave[TAMANHO_CHAVE];
+    normalizarNome(nome, chave);
+    int tamanho = strlen(chave);
+
+    if (indice->nos == NULL && !iniciarIndiceNomes(indice))
+    {
+        return 0;
+    }
+
+    int atual = 0, posicao = 0;
+    while (posicao < tamanho)
+    {
+        if (!reservarNos(indice, 2))
+        {
+            return 0;
+        }
+
+        int anterior = -1, filho = indice->nos[atual].primeiroFilho;
+        unsigned char letra = (unsigned char)chave[posicao];
+        while (filho >= 0 && (unsigned char)indice->textos[indice->nos[filho].inicioRotulo] < letra)
+        {
+            anterior = filho;
+            filho = indice->nos[filho].proximoIrmao;
+        }
+
+        if (filho < 0 || (unsigned char)indice->textos[indice->nos[filho].inicioRotulo] != letra)
+        {
+            int rotulo = guardarTexto(indice, chave + posicao, tamanho - posicao);
+            if (rotulo < 0)
+            {
+                return 0;
+            }
+            int folha = novoNo(indice, rotulo, tamanho - posicao);
+            indice->nos[folha].proximoIrmao = filho;
+            if (anterior < 0)
+            {
+                indice->nos[atual].primeiroFilho = folha;
+            }
+            else
+            {
+                indice->nos[anterior].proximoIrmao = folha;
+            }
+            atual = folha;
+            break;
+        }
+
+        NoIndiceNomes *no = &indice->nos[filho];
+        int comum = prefixoComum(indice->textos + no->inicioRotulo, no->tamanhoRotulo, chave + posicao);
+        if (comum < no->tamanhoRotulo)
+        {
+            int meio = novoNo(indice, no->inicioRotulo, comum);
+            no = &indice->nos[filho];
+            indice->nos[meio].primeiroFilho = filho;
+            indice->nos[meio].proximoIrmao = no->proximoIrmao;
+            no->proximoIrmao = -1;
+            no->inicioRotulo += comum;
+            no->tamanhoRotulo -= comum;
+            if (anterior < 0)
+            {
+                indice->nos[atual].primeiroFilho = meio;
+            }
+            else
+            {
+                indice->nos[anterior].proximoIrmao = meio;
+            }
+            filho = meio;
+        }
+        atual = filho;
+        posicao += comum;
+    }
+
+    NoIndiceNomes *terminal = &indice->nos[atual];
+    if (terminal->ocorrencias == 0)
+    {
+        int inicioNome = guardarTexto(indice, nome, strlen(nome));
+        if (inicioNome < 0)
+        {
+            return 0;
+        }
+        terminal = &indice->nos[atual];
+        terminal->inicioNome = inicioNome;
+        indice->quantidadeNomes++;
+    }
+    terminal->ocorrencias++;
+    return 1;
+}
+
+static int localizarChave(IndiceNomes *indice, char chave[], int *pai, int *anterior)
+{
+    int atual = 0, posicao = 0, tamanho = strlen(chave);
+    *pai = -1;
+    *anterior = -1;
+    while (posicao < tamanho)
+    {
+        int irmaoAnterior = -1, filho = indice->nos[atual].primeiroFilho;
+        while (filho >= 0 && indice->textos[indice->nos[filho].inicioRotulo] != chave[posicao])
+        {
+            irmaoAnterior = filho;
+            filho = indice->nos[filho].proximoIrmao;
+        }
+        if (filho < 0)
+        {
+            return -1;
+        }
+        NoIndiceNomes *no = &indice->nos[filho];
+        if (no->tamanhoRotulo > tamanho - posicao ||
+            memcmp(indice->textos + no->inicioRotulo, chave + posicao, no->tamanhoRotulo) != 0)
+        {
+            return -1;
+        }
+        *pai = atual;
+        *anterior = irmaoAnterior;
+        atual = filho;
+        posicao += no->tamanhoRotulo;
+    }
+    return atual;
+}
+
+void removerNomeIndice(IndiceNomes *indice, char nome[])
+{
+    if (indice->nos == NULL)
+    {
+        return;
+    }
+
+    char chave[TAMANHO_CHAVE];
+    normalizarNome(nome, chave);
+    int pai, anterior;
+    int no = localizarChave(indice, chave, &pai, &anterior);
+    if (no < 0 || indice->nos[no].ocorrencias == 0)
+    {
+        return;
+    }
+
+    if (--indice->nos[no].ocorrencias > 0)
+    {
+        return;
+    }
+    indice->nos[no].inicioNome = -1;
+    indice->quantidadeNomes--;
+
+    if (indice->nos[no].primeiroFilho < 0 && pai >= 0)
+    {
+        if (anterior < 0)
+        {
+            indice->nos[pai].primeiroFilho = indice->nos[no].proximoIrmao;
+        }
+        else
+        {
+            indice->nos[anterior].proximoIrmao = indice->nos[no].proximoIrmao;
+        }
+    }
+}
+
+const char *buscarNomeIndice(IndiceNomes *indice, char nome[])
+{
+    if (indice->nos == NULL)
+    {
+        return NULL;
+    }
+
+    char chave[TAMANHO_CHAVE];
+    normalizarNome(nome, chave);
+    int pai, anterior;
+    int no = localizarChave(indice, chave, &pai, &anterior);
+    if (no < 0 || indice->nos[no].ocorrencias == 0)
+    {
+        return NULL;
+    }
+    return indice->textos + indice->nos[no].inicioNome;
+}
+
+static void coletarNomes(IndiceNomes *indice, int no, SugestaoNome sugestoes[], int maximo, int *quantidade)
+{
+    for (; no >= 0 && *quantidade < maximo; no = indice->nos[no].proximoIrmao)
+    {
+        if (indice->nos[no].ocorrencias > 0)
+        {
+            sugestoes[*quantidade].nome = indice->textos + indice->nos[no].inicioNome;
+            sugestoes[*quantidade].distancia = 0;
+            (*quantidade)++;
+        }
+        coletarNomes(indice, indice->nos[no].primeiroFilho, sugestoes, maximo, quantidade);
+    }
+}
+
+int completarNomeIndice(IndiceNomes *indice, char prefixo[], SugestaoNome sugestoes[], int maximo)
+{
+    if (indice->nos == NULL || maximo <= 0)
+    {
+        return 0;
+    }
+
+    char chave[TAMANHO_CHAVE];
+    normalizarNome(prefixo, chave);
+    int tamanho = strlen(chave);
+    int atual = 0, posicao = 0;
+
+    while (posicao < tamanho)
+    {
+        int filho = indice->nos[atual].primeiroFilho;
+        while (filho >= 0 && indice->textos[indice->nos[filho].inicioRotulo] != chave[posicao])
+        {
+            filho = indice->nos[filho].proximoIrmao;
+        }
+        if (filho < 0)
+        {
+            return 0;
+        }
+        NoIndiceNomes *no = &indice->nos[filho];
+        int restante = tamanho - posicao;
+        int comparados = no->tamanhoRotulo < restante ? no->tamanhoRotulo : restante;
+        if (memcmp(indice->textos + no->inicioRotulo, chave + posicao, comparados) != 0)
+        {
+            return 0;
+        }
+        atual = filho;
+        posicao += comparados;
+    }
+
+    int quantidade = 0;
+    if (indice->nos[atual].ocorrencias > 0)
+    {
+        sugestoes[quantidade].nome = indice->textos + indice->nos[atual].inicioNome;
+        sugestoes[quantidade].distancia = 0;
+        quantidade++;
+    }
+    coletarNomes(indice, indice->nos[atual].primeiroFilho, sugestoes, maximo, &quantidade);
+    return quantidade;
+}
+
+typedef struct BuscaAproximada
+{
+    IndiceNomes *indice;
+    char *chave;
+    int tamanho;
+    int distanciaMaxima;
+    int linhas[TAMANHO_CHAVE + 1][TAMANHO_CHAVE + 1];
+    SugestaoNome *sugestoes;
+    int maximo;
+    int quantidade;
+} BuscaAproximada;
+
+static void guardarSugestao(BuscaAproximada *busca, const char *nome, int distancia)
+{
+    int posicao = busca->quantidade;
+    while (posicao > 0 && busca->sugestoes[posicao - 1].distancia > distancia)
+    {
+        posicao--;
+    }
+    if (posicao >= busca->maximo)
+    {
+        return;
+    }
+    int ultima = busca->quantidade < busca->maximo ? busca->quantidade : busca->maximo - 1;
+    memmove(&busca->sugestoes[posicao + 1], &busca->sugestoes[posicao], (ultima - posicao) * sizeof(SugestaoNome));
+    busca->sugestoes[posicao].nome = nome;
+    busca->sugestoes[posicao].distancia = distancia;
+    if (busca->quantidade < busca->maximo)
+    {
+        busca->quantidade++;
+    }
+}
+
+static void percorrerAproximado(BuscaAproximada *busca, int no, int profundidade)
+{
+    for (; no >= 0; no = busca->indice->nos[no].proximoIrmao)
+    {
+        NoIndiceNomes *atual = &busca->indice->nos[no];
+        const char *rotulo = busca->indice->textos + atual->inicioRotulo;
+        int linha = profundidade, menor = 0;
+
+        for (int k = 0; k < atual->tamanhoRotulo && linha < TAMANHO_CHAVE; k++)
+        {
+            int *acima = busca->linhas[linha], *nova = busca->linhas[linha + 1];
+            nova[0] = acima[0] + 1;
+            menor = nova[0];
+            for (int j = 1; j <= busca->tamanho; j++)
+            {
+                int custo = acima[j - 1] + (busca->chave[j - 1] != rotulo[k]);
+                int remocao = acima[j] + 1, insercao = nova[j - 1] + 1;
+                nova[j] = custo < remocao ? custo : remocao;
+                nova[j] = nova[j] < insercao ? nova[j] : insercao;
+                menor = nova[j] < menor ? nova[j] : menor;
+            }
+            linha++;
+            if (menor > busca->distanciaMaxima)
+            {
+                break;
+            }
+        }
+
+        if (menor > busca->distanciaMaxima || linha < profundidade + atual->tamanhoRotulo)
+        {
+            continue;
+        }
+        int distancia = busca->linhas[linha][busca->tamanho];
+        if (atual->ocorrencias > 0 && distancia <= busca->distanciaMaxima)
+        {
+            guardarSugestao(busca, busca->indice->textos + atual->inicioNome, distancia);
+        }
+        percorrerAproximado(busca, atual->primeiroFilho, linha);
+    }
+}
+
+int aproximarNomeIndice(IndiceNomes *indice, char nome[], int distanciaMaxima, SugestaoNome sugestoes[], int maximo)
+{
+    if (indice->nos == NULL || maximo <= 0)
+    {
+        return 0;
+    }
+
+    BuscaAproximada *busca = malloc(sizeof(BuscaAproximada));
+    if (busca == NULL)
+    {
+        return 0;
+    }
+    char chave[TAMANHO_CHAVE];
+    normalizarNome(nome, chave);
+    busca->indice = indice;
+    busca->chave = chave;
+    busca->tamanho = strlen(chave);
+    busca->distanciaMaxima = distanciaMaxima;
+    busca->sugestoes = sugestoes;
+    busca->maximo = maximo;
+    busca->quantidade = 0;
+    for (int j = 0; j <= busca->tamanho; j++)
+    {
+        busca->linhas[0][j] = j;
+    }
+
+    if (busca->tamanho <= distanciaMaxima && indice->nos[0].ocorrencias > 0)
+    {
+        guardarSugestao(busca, indice->textos + indice->nos[0].inicioNome, busca->tamanho);
+    }
+    percorrerAproximado(busca, indice->nos[0].primeiroFilho, 0);
+
+    int quantidade = busca->quantidade;
+    free(busca);
+    return quantidade;
+}
@@ -1,8 +1,107 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include "estruturas.h"
 
-int main()
+int main(int argc, char *argv[])
 {
+    if (argc > 1 && strcmp(argv[1], "--servidor") == 0)
+    {
+        if (argc < 4)
+        {
+            printf("Uso: %s --servidor <arquivo> <socket> [threads]\n", argv[0]);
+            return 1;
+        }
+        int trabalhadores = argc > 4 ? atoi(argv[4]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        return executarServidor(argv[2], argv[3], trabalhadores);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--particionar") == 0)
+    {
+        if (argc < 5)
+        {
+            printf("Uso: %s --particionar <arquivo> <prefixo> <regioes>\n", argv[0]);
+            return 1;
+        }
+        return executarParticionamento(argv[2], argv[3], atoi(argv[4]));
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--coordenador") == 0)
+    {
+        if (argc < 4)
+        {
+            printf("Uso: %s --coordenador <manifesto> <socket> [threads]\n", argv[0]);
+            return 1;
+        }
+        int trabalhadores = argc > 4 ? atoi(argv[4]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        return executarCoordenador(argv[2], argv[3], trabalhadores);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--replica") == 0)
+    {
+        if (argc < 4)
+        {
+            printf("Uso: %s --replica <alteracoes> <socket> [threads]\n", argv[0]);
+            return 1;
+        }
+        int trabalhadores = argc > 4 ? atoi(argv[4]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        return executarReplica(argv[2], argv[3], trabalhadores);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--matriz") == 0)
+    {
+        if (argc < 6)
+        {
+            printf("Uso: %s --matriz <arquivo> <origens> <destinos> <saida> [csv|bin] [threads]\n", argv[0]);
+            return 1;
+        }
+        int binario = argc > 6 && strcmp(argv[6], "bin") == 0;
+        int threads = argc > 7 ? atoi(argv[7]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        return executarMatriz(argv[2], argv[3], argv[4], argv[5], binario, threads);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--paginar") == 0)
+    {
+        if (argc < 4)
+        {
+            printf("Uso: %s --paginar <arquivo> <rede.pag> [quadros]\n", argv[0]);
+            return 1;
+        }
+        return converterParaPaginas(argv[2], argv[3], argc > 4 ? atoi(argv[4]) : QUADROS_PADRAO_CACHE);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--paginas") == 0)
+    {
+        if (argc < 3)
+        {
+            printf("Uso: %s --paginas <rede.pag> [quadros]\n", argv[0]);
+            return 1;
+        }
+        return executarConsultasPaginadas(argv[2], argc > 3 ? atoi(argv[3]) : QUADROS_PADRAO_CACHE);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--compactar") == 0)
+    {
+        if (argc < 4)
+        {
+            printf("Uso: %s --compactar <arquivo> <rede.rdz>\n", argv[0]);
+            return 1;
+        }
+        return executarCompactacao(argv[2], argv[3]);
+    }
+
+    if (argc > 1 && strcmp(argv[1], "--descompactar") == 0)
+    {
+        if (argc < 4)
+        {
+            printf("Uso: %s --descompactar <rede.rdz> <arquivo> [threads]\n", argv[0]);
+            return 1;
+        }
+        int threads = argc > 4 ? atoi(argv[4]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        return executarDescompactacao(argv[2], argv[3], threads);
+    }
+
     apresentarInformacoes();
     return 0;
 }
\ No newline at end of file
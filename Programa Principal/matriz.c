@@ -0,0 +1,330 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdint.h>
+#include "estruturas.h"
+
+static void *calcularLinhasMatriz(void *argumento)
+{
+    MatrizDistancias *matriz = argumento;
+    Grafo *grafo = matriz->grafo;
+    int n = matriz->quantidadeDestinos;
+
+    BuscaAlcance busca;
+    memset(&busca, 0, sizeof(busca));
+    if (!prepararBuscaAlcance(&busca, grafo))
+    {
+        __atomic_fetch_add(&matriz->falhas, 1, __ATOMIC_RELAXED);
+        liberarBuscaAlcance(&busca);
+        return NULL;
+    }
+    busca.alvos = matriz->alvos;
+    busca.quantidadeAlvos = matriz->quantidadeAlvos;
+
+    int i;
+    while ((i = __atomic_fetch_add(&matriz->proximaOrigem, 1, __ATOMIC_RELAXED)) < matriz->quantidadeOrigens)
+    {
+        Metros *linhaDistancias = &matriz->distancias[(size_t)i * n];
+        Centavos *linhaPedagios = &matriz->pedagios[(size_t)i * n];
+        int origem = matriz->origens[i];
+
+        if (origem >= 0)
+        {
+            buscarAlcance(&busca, origem, ALCANCE_DISTANCIA, CUSTO_INFINITO);
+        }
+
+        for (int j = 0; j < n; j++)
+        {
+            int destino = matriz->destinos[j];
+            if (origem >= 0 && destino >= 0 && busca.fechadas[destino] == busca.geracao)
+            {
+                linhaDistancias[j] = busca.distancias[destino];
+                linhaPedagios[j] = busca.pedagios[destino];
+            }
+            else
+            {
+                linhaDistancias[j] = CUSTO_INFINITO;
+                linhaPedagios[j] = CUSTO_INFINITO;
+            }
+        }
+    }
+
+    liberarBuscaAlcance(&busca);
+    return NULL;
+}
+
+int calcularMatriz(Grafo *grafo, int origens[], int quantidadeOrigens, int destinos[], int quantidadeDestinos,
+                   int quantidadeThreads, Metros distancias[], Centavos pedagios[])
+{
+    MatrizDistancias matriz;
+    memset(&matriz, 0, sizeof(matriz));
+    matriz.grafo = grafo;
+    matriz.origens = origens;
+    matriz.quantidadeOrigens = quantidadeOrigens;
+    matriz.destinos = destinos;
+    matriz.quantidadeDestinos = quantidadeDestinos;
+    matriz.distancias = distancias;
+    matriz.pedagios = pedagios;
+
+    matriz.alvos = calloc(grafo->quantidadeVertices + 1, 1);
+    if (matriz.alvos == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        return 0;
+    }
+    for (int j = 0; j < quantidadeDestinos; j++)
+    {
+        if (destinos[j] >= 0 && !matriz.alvos[destinos[j]])
+        {
+            matriz.alvos[destinos[j]] = 1;
+            matriz.quantidadeAlvos++;
+        }
+    }
+
+    if (quantidadeThreads < 1)
+    {
+        quantidadeThreads = 1;
+    }
+    if (quantidadeThreads > quantidadeOrigens)
+    {
+        quantidadeThreads = quantidadeOrigens > 0 ? quantidadeOrigens : 1;
+    }
+
+    pthread_t *threads = malloc(sizeof(pthread_t) * quantidadeThreads);
+    int iniciadas = 0;
+    for (int t = 1; threads != NULL && t < quantidadeThreads; t++)
+    {
+        if (pthread_create(&threads[iniciadas], NULL, calcularLinhasMatriz, &matriz) == 0)
+        {
+            iniciadas++;
+        }
+    }
+    calcularLinhasMatriz(&matriz);
+    for (int t = 0; t < iniciadas; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    free(threads);
+    free(matriz.alvos);
+    return matriz.falhas == 0;
+}
+
+static char (*lerNomes(char nomeArquivo[], int *quantidade))[50]
+{
+    FILE *arquivo = fopen(nomeArquivo, "r");
+    if (arquivo == NULL)
+    {
+        printf("Erro ao abrir o arquivo %s para leitura!\n", nomeArquivo);
+        return NULL;
+    }
+
+    int capacidade = 64;
+    char(*nomes)[50] = malloc(sizeof(char[50]) * capacidade);
+    char linha[256];
+    *quantidade = 0;
+
+    while (nomes != NULL && fgets(linha, sizeof(linha), arquivo))
+    {
+        linha[strcspn(linha, "\r\n")] = 0;
+        if (linha[0] == '\0')
+        {
+            continue;
+        }
+        if (*quantidade == capacidade)
+        {
+            capacidade *= 2;
+            char(*maiores)[50] = realloc(nomes, sizeof(char[50]) * capacidade);
+            if (maiores == NULL)
+            {
+                free(nomes);
+                nomes = NULL;
+                break;
+            }
+            nomes = maiores;
+        }
+        linha[49] = '\0';
+        strcpy(nomes[(*quantidade)++], linha);
+    }
+
+    fclose(arquivo);
+    if (nomes == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+    }
+    return nomes;
+}
+
+static int *resolverNomes(Grafo *grafo, char (*nomes)[50], int quantidade, char nomeArquivo[])
+{
+    int *vertices = malloc(sizeof(int) * (quantidade + 1));
+    if (vertices == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        return NULL;
+    }
+    for (int i = 0; i < quantidade; i++)
+    {
+        vertices[i] = buscarVertice(grafo, nomes[i]);
+        if (vertices[i] < 0)
+        {
+            printf("Aviso: cidade '%s' de '%s' não encontrada na rede.\n", nomes[i], nomeArquivo);
+        }
+    }
+    return vertices;
+}
+
+static void escreverMatrizCsv(BufferSaida *saida, char (*origens)[50], int m, char (*destinos)[50], int n,
+                              Metros distancias[], Centavos pedagios[])
+{
+    saidaTexto(saida, "origem,destino,distancia_km,pedagio_rs\n");
+    for (int i = 0; i < m; i++)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            size_t celula = (size_t)i * n + j;
+            saidaTexto(saida, origens[i]);
+            saidaTexto(saida, ",");
+            saidaTexto(saida, destinos[j]);
+            saidaTexto(saida, ",");
+            if (distancias[celula] != CUSTO_INFINITO)
+            {
+                saidaMetros(saida, distancias[celula]);
+                saidaTexto(saida, ",");
+                saidaCentavos(saida, pedagios[celula]);
+            }
+            else
+            {
+                saidaTexto(saida, ",");
+            }
+            saidaTexto(saida, "\n");
+        }
+    }
+}
+
+static void escreverMatrizBinaria(BufferSaida *saida, int m, int n, Metros distancias[], Centavos pedagios[])
+{
+    int32_t dimensoes[2] = {m, n};
+    saidaBytes(saida, "RMA2", 4);
+    saidaBytes(saida, (char *)dimensoes, sizeof(dimensoes));
+    saidaBytes(saida, (char *)distancias, sizeof(Metros) * (size_t)m * n);
+    saidaBytes(saida, (char *)pedagios, sizeof(Centavos) * (size_t)m * n);
+}
+
+static int gravarMatriz(Metros distancias[], Centavos pedagios[], char (*nomesOrigens)[50], int m,
+                        char (*nomesDestinos)[50], int n, char arquivoSaida[], int binario)
+{
+    int descritor = open(arquivoSaida, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0)
+    {
+        printf("Erro ao abrir o arquivo para escrita!\n");
+        return 0;
+    }
+
+    BufferSaida saida;
+    iniciarBufferSaida(&saida, descritor);
+    if (binario)
+    {
+        escreverMatrizBinaria(&saida, m, n, distancias, pedagios);
+    }
+    else
+    {
+        escreverMatrizCsv(&saida, nomesOrigens, m, nomesDestinos, n, distancias, pedagios);
+    }
+
+    int gravou = finalizarBufferSaida(&saida) == 0;
+    if (!gravou)
+    {
+        printf("Erro ao gravar o arquivo '%s'!\n", arquivoSaida);
+    }
+    close(descritor);
+    return gravou;
+}
+
+static int gerarMatriz(Grafo *grafo, char (*nomesOrigens)[50], int m, char (*nomesDestinos)[50], int n,
+                       char arquivoOrigens[], char arquivoDestinos[], char arquivoSaida[], int binario,
+                       int quantidadeThreads)
+{
+    int *origens = resolverNomes(grafo, nomesOrigens, m, arquivoOrigens);
+    int *destinos = resolverNomes(grafo, nomesDestinos, n, arquivoDestinos);
+    Metros *distancias = malloc(sizeof(Metros) * ((size_t)m * n + 1));
+    Centavos *pedagios = malloc(sizeof(Centavos) * ((size_t)m * n + 1));
+    int sucesso = 0;
+
+    if (origens == NULL || destinos == NULL || distancias == NULL || pedagios == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+    }
+    else
+    {
+        struct timespec inicio, termino;
+        clock_gettime(CLOCK_MONOTONIC, &inicio);
+        sucesso = calcularMatriz(grafo, origens, m, destinos, n, quantidadeThreads, distancias, pedagios);
+        clock_gettime(CLOCK_MONOTONIC, &termino);
+
+        if (sucesso && gravarMatriz(distancias, pedagios, nomesOrigens, m, nomesDestinos, n, arquivoSaida, binario))
+        {
+            printf("Matriz %dx%d calculada em %.3f s e salva em '%s'.\n", m, n,
+                   (termino.tv_sec - inicio.tv_sec) + (termino.tv_nsec - inicio.tv_nsec) / 1e9, arquivoSaida);
+        }
+        else
+        {
+            sucesso = 0;
+        }
+    }
+
+    free(origens);
+    free(destinos);
+    free(distancias);
+    free(pedagios);
+    return sucesso;
+}
+
+int executarMatriz(char nomeArquivo[], char arquivoOrigens[], char arquivoDestinos[], char arquivoSaida[],
+                   int binario, int quantidadeThreads)
+{
+    Rodovia *lista = NULL;
+    if (carregarRodoviasDeArquivo(&lista, nomeArquivo) == RODOVIAS_OK)
+    {
+        printf("Dados carregados de '%s' com sucesso!\n", nomeArquivo);
+    }
+    else
+    {
+        printf("Erro ao abrir o arquivo %s para leitura!\n", nomeArquivo);
+    }
+    long ignorados;
+    int recuperadas = lerDiario(nomeArquivo, &lista, &ignorados);
+    if (ignorados > 0)
+    {
+        printf("Aviso: %ld bytes incompletos ignorados no diário de '%s'.\n", ignorados, nomeArquivo);
+    }
+    if (recuperadas > 0)
+    {
+        printf("%d alteração(ões) não salvas recuperadas do diário de '%s'.\n", recuperadas, nomeArquivo);
+    }
+
+    int m = 0, n = 0, sucesso = 0;
+    char(*nomesOrigens)[50] = lerNomes(arquivoOrigens, &m);
+    char(*nomesDestinos)[50] = lerNomes(arquivoDestinos, &n);
+    Grafo *grafo = construirGrafo(lista);
+    if (grafo == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+    }
+
+    if (nomesOrigens != NULL && nomesDestinos != NULL && grafo != NULL)
+    {
+        sucesso = gerarMatriz(grafo, nomesOrigens, m, nomesDestinos, n, arquivoOrigens, arquivoDestinos,
+                              arquivoSaida, binario, quantidadeThreads);
+    }
+
+    free(nomesOrigens);
+    free(nomesDestinos);
+    liberarGrafo(grafo);
+    liberarMemoria(lista);
+    return sucesso ? 0 : 1;
+}
@@ -0,0 +1,1277 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "rodovias.h"
+
+void menu();
+
+static void relatarDiario(int status)
+{
+    if (status == RODOVIAS_ERRO_ARQUIVO)
+    {
+        printf("Erro ao gravar no diário de alterações!\n");
+    }
+}
+
+static void sugerirNome(RedeRodovias *rede, int tipo, char nome[])
+{
+    InfoSugestao sugestoes[5];
+    int quantidade;
+    if (sugerirNomesRede(rede, tipo, nome, 2, sugestoes, 5, &quantidade) != RODOVIAS_OK || quantidade == 0 ||
+        sugestoes[0].distancia == 0)
+    {
+        return;
+    }
+
+    printf("Você quis dizer: ");
+    for (int i = 0; i < quantidade; i++)
+    {
+        printf("%s%s", i > 0 ? ", " : "", sugestoes[i].nome);
+    }
+    printf("?\n");
+}
+
+static void listarNomes(RedeRodovias *rede, int tipo, const char *titulo, char prefixo[])
+{
+    InfoSugestao sugestoes[20];
+    int quantidade;
+    if (completarNomesRede(rede, tipo, prefixo, sugestoes, 20, &quantidade) != RODOVIAS_OK || quantidade == 0)
+    {
+        printf("%s: nenhuma encontrada.\n", titulo);
+        return;
+    }
+
+    printf("%s:\n", titulo);
+    for (int i = 0; i < quantidade; i++)
+    {
+        printf("  %s\n", sugestoes[i].nome);
+    }
+}
+
+static void cidadesNaoEncontradas(RedeRodovias *rede, char cidadeInicio[], char cidadeFim[])
+{
+    printf("Cidade de início ou fim não encontrada!\n");
+    sugerirNome(rede, NOME_CIDADE, cidadeInicio);
+    sugerirNome(rede, NOME_CIDADE, cidadeFim);
+}
+
+static InfoCidade *obterCidades(RedeRodovias *rede, char rodovia[], int *quantidade)
+{
+    InfoRodovia info;
+    *quantidade = 0;
+    if (buscarRodoviaRede(rede, rodovia, &info) != RODOVIAS_OK)
+    {
+        return NULL;
+    }
+
+    InfoCidade *cidades = malloc(sizeof(InfoCidade) * (info.numeroCidades + 1));
+    if (cidades == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        return NULL;
+    }
+    listarCidadesRede(rede, rodovia, cidades, info.numeroCidades, quantidade);
+    if (*quantidade > info.numeroCidades)
+    {
+        *quantidade = info.numeroCidades;
+    }
+    return cidades;
+}
+
+static InfoCruzamento *obterCruzamentos(RedeRodovias *rede, char rodovia1[], char rodovia2[], int *quantidade)
+{
+    int total;
+    if (listarCruzamentosRede(rede, rodovia1, rodovia2, NULL, 0, &total) != RODOVIAS_OK)
+    {
+        *quantidade = 0;
+        return NULL;
+    }
+
+    InfoCruzamento *cruzamentos = malloc(sizeof(InfoCruzamento) * (total + 1));
+    if (cruzamentos == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        *quantidade = 0;
+        return NULL;
+    }
+    listarCruzamentosRede(rede, rodovia1, rodovia2, cruzamentos, total, quantidade);
+    if (*quantidade > total)
+    {
+        *quantidade = total;
+    }
+    return cruzamentos;
+}
+
+static void percursoNaRodovia(RedeRodovias *rede, char rodovia[], char cidadeInicio[], char cidadeFim[],
+                              double *pedagioTotal, double *distanciaTotal)
+{
+    int inicio, fim, quantidade;
+    *pedagioTotal = 0;
+    *distanciaTotal = 0;
+
+    if (localizarCidadeRede(rede, rodovia, cidadeInicio, &inicio) != RODOVIAS_OK ||
+        localizarCidadeRede(rede, rodovia, cidadeFim, &fim) != RODOVIAS_OK)
+    {
+        return;
+    }
+    InfoCidade *cidades = obterCidades(rede, rodovia, &quantidade);
+    if (cidades == NULL || inicio >= quantidade)
+    {
+        free(cidades);
+        return;
+    }
+
+    printf("\n=== Percurso na rodovia %s ===\n", rodovia);
+    printf("Início do percurso em: %s (km %.2f)\n", cidadeInicio, cidades[inicio].distancia);
+
+    for (int atual = inicio; atual != fim && atual < quantidade; atual++)
+    {
+        if (atual + 1 < quantidade)
+        {
+            InfoCidade *proxima = &cidades[atual + 1];
+            double trechoDistancia = proxima->distancia - cidades[atual].distancia;
+            *distanciaTotal += trechoDistancia;
+
+            printf("\n-> Próxima cidade: %s (km %.2f)\n", proxima->nome, proxima->distancia);
+            printf("   Distância do trecho: %.2f km\n", trechoDistancia);
+
+            *pedagioTotal += proxima->pedagioIda;
+        }
+    }
+
+    printf("\n=== Fim do percurso ===\n");
+    printf("Distância total percorrida: %.2f km\n", *distanciaTotal);
+    printf("Custo total em pedágios: R$ %.2f\n", *pedagioTotal);
+    free(cidades);
+}
+
+static void percursoEntreRodovias(RedeRodovias *rede, char cidadeInicio[], char cidadeFim[])
+{
+    InfoPercurso percurso;
+    int status = consultarPercursoRede(rede, cidadeInicio, cidadeFim, &percurso);
+    if (status == RODOVIAS_CIDADE_NAO_ENCONTRADA)
+    {
+        cidadesNaoEncontradas(rede, cidadeInicio, cidadeFim);
+        return;
+    }
+    if (status != RODOVIAS_OK && status != RODOVIAS_SEM_ROTA)
+    {
+        printf("%s\n", descreverStatusRodovias(status));
+        return;
+    }
+
+    printf("\n=== Percurso de %s até %s ===\n", percurso.origem, percurso.destino);
+
+    double pedagio1 = 0.0, distancia1 = 0.0;
+    if (strcmp(percurso.rodoviaInicio, percurso.rodoviaFim) == 0)
+    {
+        printf("Percurso na rodovia %s:\n", percurso.rodoviaInicio);
+        percursoNaRodovia(rede, percurso.rodoviaInicio, percurso.origem, percurso.destino, &pedagio1, &distancia1);
+        return;
+    }
+
+    if (status == RODOVIAS_OK)
+    {
+        double pedagio2 = 0.0, distancia2 = 0.0;
+
+        printf("Rota encontrada:\n");
+        printf("1. Início em %s pela rodovia %s\n", percurso.origem, percurso.rodoviaInicio);
+        printf("2. Conexão em %s\n", percurso.cidadeConexao);
+        printf("3. Continuação pela rodovia %s até %s\n", percurso.rodoviaFim, percurso.destino);
+
+        printf("\nPrimeiro trecho (%s):\n", percurso.rodoviaInicio);
+        percursoNaRodovia(rede, percurso.rodoviaInicio, percurso.origem, percurso.cidadeConexao, &pedagio1,
+                          &distancia1);
+
+        printf("\nSegundo trecho (%s):\n", percurso.rodoviaFim);
+        percursoNaRodovia(rede, percurso.rodoviaFim, percurso.cidadeConexao, percurso.destino, &pedagio2,
+                          &distancia2);
+
+        printf("\n=== Resumo do percurso completo ===\n");
+        printf("Distância total da viagem: %.2f km\n", distancia1 + distancia2);
+        printf("Custo total em pedágios: R$ %.2f\n", pedagio1 + pedagio2);
+        return;
+    }
+
+    printf("Não foi possível encontrar uma rota direta entre as cidades.\n");
+}
+
+static void listarTodosCruzamentos(RedeRodovias *rede)
+{
+    int quantidade;
+    listarRodoviasRede(rede, NULL, 0, &quantidade);
+    if (quantidade < 2)
+    {
+        printf("São necessárias pelo menos duas rodovias para verificar cruzamentos!\n");
+        return;
+    }
+
+    InfoRodovia *rodovias = malloc(sizeof(InfoRodovia) * quantidade);
+    if (rodovias == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        return;
+    }
+    int maximo = quantidade;
+    listarRodoviasRede(rede, rodovias, maximo, &quantidade);
+    if (quantidade > maximo)
+    {
+        quantidade = maximo;
+    }
+
+    int encontrouAlgumCruzamento = 0;
+    printf("\n=== Listagem de Todos os Cruzamentos ===\n");
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        for (int j = i + 1; j < quantidade; j++)
+        {
+            int total;
+            InfoCruzamento *cruzamentos = obterCruzamentos(rede, rodovias[i].nome, rodovias[j].nome, &total);
+            if (total > 0)
+            {
+                printf("\nCruzamento entre %s e %s:\n", rodovias[i].nome, rodovias[j].nome);
+                encontrouAlgumCruzamento = 1;
+            }
+            for (int k = 0; k < total; k++)
+            {
+                printf("- %s (km %.2f na %s, km %.2f na %s)\n", cruzamentos[k].cidade, cruzamentos[k].distancia1,
+                       rodovias[i].nome, cruzamentos[k].distancia2, rodovias[j].nome);
+            }
+            free(cruzamentos);
+        }
+    }
+
+    if (!encontrouAlgumCruzamento)
+    {
+        printf("\nNenhum cruzamento encontrado entre as rodovias cadastradas.\n");
+    }
+    free(rodovias);
+}
+
+static void listarCruzamentos(RedeRodovias *rede, InfoRodovia *rodovia1, InfoRodovia *rodovia2)
+{
+    printf("\nPontos de cruzamento entre %s e %s:\n", rodovia1->nome, rodovia2->nome);
+
+    int total;
+    InfoCruzamento *cruzamentos = obterCruzamentos(rede, rodovia1->nome, rodovia2->nome, &total);
+    for (int i = 0; i < total; i++)
+    {
+        printf("- %s (km %.2f na %s, km %.2f na %s)\n", cruzamentos[i].cidade, cruzamentos[i].distancia1,
+               rodovia1->nome, cruzamentos[i].distancia2, rodovia2->nome);
+    }
+    free(cruzamentos);
+
+    if (total == 0)
+    {
+        printf("Nenhum ponto de cruzamento encontrado entre estas rodovias.\n");
+    }
+}
+
+static void imprimirRota(InfoRota *rota, int numero)
+{
+    printf("\nRota %d: %.2f km, R$ %.2f\n", numero, rota->distancia, rota->pedagio);
+    if (rota->quantidadeTrechos < 0)
+    {
+        printf("   (rota longa demais para ser detalhada)\n");
+        return;
+    }
+
+    for (int i = 0; i < rota->quantidadeTrechos; i++)
+    {
+        InfoTrecho *trecho = &rota->trechos[i];
+        printf("   %s: %s -> %s (%.2f km, R$ %.2f)\n", trecho->rodovia, trecho->origem, trecho->destino,
+               trecho->distancia, trecho->pedagio);
+    }
+}
+
+static void rotasAlternativas(RedeRodovias *rede, char cidadeInicio[], char cidadeFim[], float pesoDistancia,
+                              float pesoPedagio, InfoRestricoes *restricoes)
+{
+    InfoRotas *resultado = malloc(sizeof(InfoRotas));
+    if (resultado == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        return;
+    }
+
+    int criterio = pesoDistancia <= 0 && pesoPedagio <= 0 ? ROTA_PARETO : ROTA_PONDERADA;
+    int status = rotasRestritasRede(rede, cidadeInicio, cidadeFim, criterio, pesoDistancia, pesoPedagio, restricoes,
+                                    resultado);
+    if (status == RODOVIAS_CIDADE_NAO_ENCONTRADA)
+    {
+        cidadesNaoEncontradas(rede, cidadeInicio, cidadeFim);
+    }
+    else if (status != RODOVIAS_OK && status != RODOVIAS_SEM_ROTA)
+    {
+        printf("%s\n", descreverStatusRodovias(status));
+    }
+    else
+    {
+        if (criterio == ROTA_PARETO)
+        {
+            printf("\n=== Rotas não dominadas (distância x pedágio) de %s até %s ===\n", resultado->origem,
+                   resultado->destino);
+        }
+        else
+        {
+            printf("\n=== Melhores rotas por custo (%.2f por km + %.2f por R$) de %s até %s ===\n", pesoDistancia,
+                   pesoPedagio, resultado->origem, resultado->destino);
+        }
+
+        if (resultado->quantidade == 0)
+        {
+            printf("Não foi possível encontrar uma rota entre as cidades.\n");
+        }
+        for (int i = 0; i < resultado->quantidade; i++)
+        {
+            imprimirRota(&resultado->rotas[i], i + 1);
+        }
+        if (resultado->truncada)
+        {
+            printf("\nAviso: a busca atingiu o limite de memória; podem existir outras alternativas.\n");
+        }
+    }
+    free(resultado);
+}
+
+static void cidadesAlcancaveis(RedeRodovias *rede, InfoAlcance **cidades, int *capacidade, char cidadeOrigem[],
+                               int criterio, float limite)
+{
+    int quantidade;
+    int status = cidadesAlcancaveisRede(rede, cidadeOrigem, criterio, limite, *cidades, *capacidade, &quantidade);
+    if (status == RODOVIAS_OK && quantidade > *capacidade)
+    {
+        InfoAlcance *maiores = realloc(*cidades, sizeof(InfoAlcance) * quantidade);
+        if (maiores == NULL)
+        {
+            status = RODOVIAS_ERRO_MEMORIA;
+        }
+        else
+        {
+            *cidades = maiores;
+            *capacidade = quantidade;
+            status = cidadesAlcancaveisRede(rede, cidadeOrigem, criterio, limite, *cidades, *capacidade, &quantidade);
+        }
+    }
+
+    if (status == RODOVIAS_CIDADE_NAO_ENCONTRADA)
+    {
+        printf("Cidade '%s' não encontrada!\n", cidadeOrigem);
+        sugerirNome(rede, NOME_CIDADE, cidadeOrigem);
+        return;
+    }
+    if (status != RODOVIAS_OK)
+    {
+        printf("%s\n", descreverStatusRodovias(status));
+        return;
+    }
+
+    InfoAlcance *alcancadas = *cidades;
+    if (criterio == ALCANCE_PEDAGIO)
+    {
+        printf("\n=== Cidades alcançáveis a partir de %s com até R$ %.2f em pedágios ===\n", alcancadas[0].cidade,
+               limite);
+    }
+    else
+    {
+        printf("\n=== Cidades alcançáveis a partir de %s em até %.2f km ===\n", alcancadas[0].cidade, limite);
+    }
+
+    for (int i = 1; i < quantidade; i++)
+    {
+        printf("- %s (%.2f km, R$ %.2f)\n", alcancadas[i].cidade, alcancadas[i].distancia, alcancadas[i].pedagio);
+    }
+    if (quantidade <= 1)
+    {
+        printf("Nenhuma outra cidade dentro do limite.\n");
+    }
+}
+
+void apresentarInformacoes()
+{
+    printf("Bem-vindo ao sistema de gerenciamento de rodovias!\n");
+    printf("\nPara garantir a melhor experiência, por favor, leia as seguintes informações:\n");
+    printf("\n- Utilize nomes claros e concisos para rodovias e cidades.\n");
+    printf("- Priorize o uso do hífen (-) em nomes de rodovias (ex: BR-101).\n");
+    printf("- Verifique a ortografia para evitar erros.\n");
+    printf("- Faça backups regulares dos seus dados.\n");
+
+    printf("\nAo utilizar este sistema, você concorda com as práticas acima?\n");
+    printf("1 - Sim\n");
+    printf("2 - Não\n");
+
+    int opcao;
+    scanf("%d", &opcao);
+
+    if (opcao == 1)
+    {
+        menu();
+    }
+    else
+    {
+        printf("\n[Você não concordou com os termos de uso. O programa será encerrado.]\n");
+    }
+}
+
+static int lerHorarioClasse(int *partida, int *classe)
+{
+    int dia, hora, minuto;
+    printf("Insira o dia da semana (0-Domingo a 6-Sábado), o horário e a classe do veículo (ex: 1 07:30 2): ");
+    if (scanf("%d %d:%d %d", &dia, &hora, &minuto, classe) != 4 || dia < 0 || dia > 6 || hora < 0 || hora > 23 ||
+        minuto < 0 || minuto > 59 || *classe < 0 || *classe >= MAXIMO_CLASSES_VEICULO)
+    {
+        printf("Erro: entrada inválida para o horário ou a classe\n");
+        while (getchar() != '\n')
+            ;
+        return 0;
+    }
+    getchar();
+    *partida = (dia * 24 + hora) * 60 + minuto;
+    return 1;
+}
+
+static int lerCoordenadas(InfoPosicao *posicao)
+{
+    printf("Insira a latitude e a longitude em graus decimais (ex: -23.5505 -46.6333): ");
+    if (scanf("%lf %lf", &posicao->latitude, &posicao->longitude) != 2 || posicao->latitude < -90 ||
+        posicao->latitude > 90 || posicao->longitude < -180 || posicao->longitude > 180)
+    {
+        printf("Erro: entrada inválida para as coordenadas\n");
+        while (getchar() != '\n')
+            ;
+        return 0;
+    }
+    getchar();
+    return 1;
+}
+
+static void cidadesProximas(RedeRodovias *rede, InfoPosicao *posicao, double raio)
+{
+    InfoCidadeProxima cidades[10];
+    int quantidade = 1;
+    int status = raio > 0 ? cidadesNoRaioRede(rede, posicao, 1, raio, cidades, 10, &quantidade)
+                          : cidadesMaisProximasRede(rede, posicao, 1, cidades);
+    if (status == RODOVIAS_CIDADE_NAO_ENCONTRADA)
+    {
+        printf("Nenhuma cidade possui coordenadas cadastradas.\n");
+        return;
+    }
+    if (status != RODOVIAS_OK)
+    {
+        printf("%s\n", descreverStatusRodovias(status));
+        return;
+    }
+    if (quantidade == 0)
+    {
+        printf("Nenhuma cidade num raio de %.2f km.\n", raio);
+        return;
+    }
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        printf("%d. %s (%.6f, %.6f) a %.2f km\n", i + 1, cidades[i].cidade, cidades[i].latitude,
+               cidades[i].longitude, cidades[i].distancia);
+    }
+}
+
+static void percursoTarifado(RedeRodovias *rede, char cidadeInicio[], char cidadeFim[], int partida, int classe)
+{
+    InfoPercurso percurso;
+    int status = consultarPercursoTarifadoRede(rede, cidadeInicio, cidadeFim, partida, classe, &percurso);
+    if (status == RODOVIAS_CIDADE_NAO_ENCONTRADA)
+    {
+        cidadesNaoEncontradas(rede, cidadeInicio, cidadeFim);
+        return;
+    }
+    if (status == RODOVIAS_SEM_ROTA)
+    {
+        printf("Nenhuma rota direta encontrada entre as rodovias.\n");
+        return;
+    }
+    if (status != RODOVIAS_OK)
+    {
+        printf("%s\n", descreverStatusRodovias(status));
+        return;
+    }
+
+    printf("\n=== Custo de %s até %s (classe %d) ===\n", percurso.origem, percurso.destino, classe);
+    if (percurso.cidadeConexao[0] != '\0')
+    {
+        printf("Pela rodovia %s até %s, depois pela rodovia %s\n", percurso.rodoviaInicio, percurso.cidadeConexao,
+               percurso.rodoviaFim);
+    }
+    else
+    {
+        printf("Pela rodovia %s\n", percurso.rodoviaInicio);
+    }
+    printf("Distância total: %.2f km\n", percurso.distancia);
+    printf("Custo total em pedágios: R$ %.2f\n", percurso.pedagio);
+}
+
+static void roteiroEntregas(RedeRodovias *rede, char deposito[])
+{
+    char cidades[MAXIMO_PARADAS_ROTEIRO][50];
+    const char *nomes[MAXIMO_PARADAS_ROTEIRO];
+    int quantidade = 0;
+    printf("Insira as cidades a visitar, uma por linha (linha vazia para terminar):\n");
+    while (quantidade < MAXIMO_PARADAS_ROTEIRO && fgets(cidades[quantidade], sizeof(cidades[quantidade]), stdin))
+    {
+        cidades[quantidade][strcspn(cidades[quantidade], "\n")] = 0;
+        if (cidades[quantidade][0] == '\0')
+        {
+            break;
+        }
+        nomes[quantidade] = cidades[quantidade];
+        quantidade++;
+    }
+
+    InfoRoteiro roteiro;
+    int status = otimizarRoteiroRede(rede, deposito, nomes, quantidade, 500, &roteiro);
+    if (status == RODOVIAS_SEM_ROTA)
+    {
+        printf("Alguma das cidades não é alcançável a partir de %s.\n", deposito);
+        return;
+    }
+    if (status != RODOVIAS_OK)
+    {
+        printf("%s\n", descreverStatusRodovias(status));
+        return;
+    }
+
+    printf("\n=== Roteiro a partir de %s (%d parada(s)) ===\n", roteiro.paradas[0].cidade,
+           roteiro.quantidadeParadas - 2);
+    for (int i = 1; i < roteiro.quantidadeParadas; i++)
+    {
+        printf("%d. %s -> %s: %.2f km, R$ %.2f\n", i, roteiro.paradas[i - 1].cidade, roteiro.paradas[i].cidade,
+               roteiro.paradas[i].distancia, roteiro.paradas[i].pedagio);
+    }
+    printf("Distância total: %.2f km (vizinho mais próximo: %.2f km)\n", roteiro.distancia,
+           roteiro.distanciaInicial);
+    printf("Custo total em pedágios: R$ %.2f\n", roteiro.pedagio);
+}
+
+static void interdicoesTrechos(RedeRodovias *rede)
+{
+    InfoInterdicao interdicoes[64];
+    int quantidade;
+    listarInterdicoesRede(rede, interdicoes, 64, &quantidade);
+    printf("\n=== %d trecho(s) interditado(s) ===\n", quantidade);
+    for (int i = 0; i < quantidade && i < 64; i++)
+    {
+        printf("%s: %s - %s\n", interdicoes[i].rodovia, interdicoes[i].cidade1, interdicoes[i].cidade2);
+    }
+
+    InfoInterdicao interdicao;
+    printf("Insira o nome da rodovia: ");
+    fgets(interdicao.rodovia, sizeof(interdicao.rodovia), stdin);
+    interdicao.rodovia[strcspn(interdicao.rodovia, "\n")] = 0;
+    printf("Insira a primeira cidade do trecho: ");
+    fgets(interdicao.cidade1, sizeof(interdicao.cidade1), stdin);
+    interdicao.cidade1[strcspn(interdicao.cidade1, "\n")] = 0;
+    printf("Insira a última cidade do trecho: ");
+    fgets(interdicao.cidade2, sizeof(interdicao.cidade2), stdin);
+    interdicao.cidade2[strcspn(interdicao.cidade2, "\n")] = 0;
+    printf("1-Interditar, 0-Liberar: ");
+    int interditar;
+    if (scanf("%d", &interditar) != 1 || (interditar != 0 && interditar != 1))
+    {
+        printf("Erro: entrada inválida\n");
+        while (getchar() != '\n')
+            ;
+        return;
+    }
+    getchar();
+
+    int status = interditarTrechoRede(rede, interdicao.rodovia, interdicao.cidade1, interdicao.cidade2, interditar);
+    if (status == RODOVIAS_OK)
+    {
+        printf("Trecho de %s entre %s e %s %s.\n", interdicao.rodovia, interdicao.cidade1, interdicao.cidade2,
+               interditar ? "interditado" : "liberado");
+    }
+    else
+    {
+        printf("%s\n", descreverStatusRodovias(status));
+    }
+}
+
+static void rotasRestritas(RedeRodovias *rede, char cidadeInicio[], char cidadeFim[])
+{
+    InfoRestricoes restricoes;
+    memset(&restricoes, 0, sizeof(restricoes));
+    printf("Insira as rodovias a evitar, uma por linha (linha vazia para terminar):\n");
+    while (restricoes.quantidadeRodoviasEvitadas < MAXIMO_RESTRICOES_ROTA)
+    {
+        char *rodovia = restricoes.rodoviasEvitadas[restricoes.quantidadeRodoviasEvitadas];
+        if (fgets(rodovia, 50, stdin) == NULL)
+        {
+            break;
+        }
+        rodovia[strcspn(rodovia, "\n")] = 0;
+        if (rodovia[0] == '\0')
+        {
+            break;
+        }
+        restricoes.quantidadeRodoviasEvitadas++;
+    }
+
+    printf("Insira o pedágio máximo por trecho em R$ (-1 para não limitar): ");
+    float pedagioMaximo;
+    if (scanf("%f", &pedagioMaximo) != 1)
+    {
+        printf("Erro: entrada inválida para o pedágio\n");
+        while (getchar() != '\n')
+            ;
+        return;
+    }
+    getchar();
+    restricoes.pedagioMaximoTrecho = pedagioMaximo;
+    rotasAlternativas(rede, cidadeInicio, cidadeFim, 0, 0, &restricoes);
+}
+
+static void atualizarTrechosArquivo(RedeRodovias *rede, char nomeArquivo[])
+{
+    FILE *arquivo = fopen(nomeArquivo, "r");
+    if (arquivo == NULL)
+    {
+        printf("Erro ao abrir o arquivo %s para leitura!\n", nomeArquivo);
+        return;
+    }
+    InfoAtualizacaoTrecho *lote = malloc(sizeof(InfoAtualizacaoTrecho) * 1024);
+    if (lote == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        fclose(arquivo);
+        return;
+    }
+
+    char linha[256];
+    int quantidade = 0, linhaLote = 1, numeroLinha = 0, status = RODOVIAS_OK;
+    long total = 0;
+    while (status == RODOVIAS_OK)
+    {
+        int lida = fgets(linha, sizeof(linha), arquivo) != NULL;
+        if (lida)
+        {
+            numeroLinha++;
+            linha[strcspn(linha, "\r\n")] = 0;
+            if (linha[0] == '\0')
+            {
+                continue;
+            }
+            InfoAtualizacaoTrecho *atualizacao = &lote[quantidade];
+            if (sscanf(linha, "%49[^\t]\t%49[^\t]\t%49[^\t]\t%lf\t%lf", atualizacao->rodovia, atualizacao->cidade1,
+                       atualizacao->cidade2, &atualizacao->distancia, &atualizacao->pedagio) != 5)
+            {
+                printf("Linha %d inválida: '%s'\n", numeroLinha, linha);
+                break;
+            }
+            if (quantidade++ == 0)
+            {
+                linhaLote = numeroLinha;
+            }
+        }
+        if (quantidade == 1024 || (!lida && quantidade > 0))
+        {
+            int aplicadas;
+            status = atualizarTrechosRede(rede, lote, quantidade, &aplicadas);
+            total += aplicadas;
+            if (status != RODOVIAS_OK)
+            {
+                printf("Erro na atualização %d do lote iniciado na linha %d (%s - %s em %s): %s\n", aplicadas + 1,
+                       linhaLote, lote[aplicadas].cidade1, lote[aplicadas].cidade2, lote[aplicadas].rodovia,
+                       descreverStatusRodovias(status));
+            }
+            quantidade = 0;
+        }
+        if (!lida)
+        {
+            break;
+        }
+    }
+    printf("%ld trecho(s) atualizado(s) a partir de '%s'.\n", total, nomeArquivo);
+    free(lote);
+    fclose(arquivo);
+}
+
+void menu()
+{
+    int opcao = -1;
+    char nomeRodovia[50], nomeCidade[50];
+    float distancia;
+    char rodovia1[50], rodovia2[50];
+    char cidadeInicio[50], cidadeFim[50];
+    InfoRodovia r1, r2;
+    char nomeArquivo[50] = "";
+    int status;
+    InfoAlcance *alcancadas = NULL;
+    int capacidadeAlcance = 0;
+    int partida, classe, inicio;
+    float valor;
+    InfoPosicao posicao;
+    char caminhoAlimentacao[200];
+    InfoAlimentacao alimentacao;
+
+    RedeRodovias *rede = criarRede();
+    if (rede == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        return;
+    }
+
+    printf("\nDeseja iniciar o programa com um arquivo em branco ou carregar um arquivo com os dados já existente?\n");
+    printf("0 para começar em branco, 1 para carregar um arquivo com os dados:\n");
+    int escolha;
+    scanf("%d", &escolha);
+    getchar();
+
+    if (escolha == 1)
+    {
+        printf("Insira o nome do arquivo para carregar os dados (ex: rodovias.txt): ");
+        scanf("%49s", nomeArquivo);
+        getchar();
+
+        InfoAbertura abertura;
+        abrirRede(rede, nomeArquivo, &abertura);
+        if (abertura.carregado)
+        {
+            printf("Dados carregados de '%s' com sucesso!\n", nomeArquivo);
+        }
+        else
+        {
+            printf("Erro ao abrir o arquivo %s para leitura!\n", nomeArquivo);
+        }
+        if (abertura.bytesDescartados > 0)
+        {
+            printf("Aviso: %ld bytes incompletos descartados do diário de '%s'.\n", abertura.bytesDescartados,
+                   nomeArquivo);
+        }
+        if (!abertura.diarioAberto)
+        {
+            printf("Erro ao abrir o diário de alterações '%s.diario'!\n", nomeArquivo);
+        }
+        else if (abertura.recuperadas > 0)
+        {
+            printf("%d alteração(ões) não salvas recuperadas do diário de '%s'.\n", abertura.recuperadas, nomeArquivo);
+        }
+    }
+
+    while (opcao != 0)
+    {
+        printf("\n-> Escolha uma opcao:\n");
+        printf("1. Inserir rodovia\n");
+        printf("2. Remover rodovia\n");
+        printf("3. Inserir cidade em rodovia \n");
+        printf("4. Remover cidade de rodovia\n");
+        printf("5. Ver percurso entre duas cidades\n");
+        printf("6. Verificar cruzamento entre todas as rodovias\n");
+        printf("7. Imprimir lista de rodovias\n");
+        printf("8. Salvar lista em arquivo\n");
+        printf("9. Listar todos os cruzamentos entre duas rodovias específicas\n");
+        printf("10. Salvar alterações no arquivo atual\n");
+        printf("11. Ver rotas alternativas entre duas cidades\n");
+        printf("12. Listar cidades alcançáveis a partir de uma cidade\n");
+        printf("13. Definir tarifa de pedágio por horário e classe de veículo\n");
+        printf("14. Ver custo do percurso por horário de partida e classe de veículo\n");
+        printf("15. Buscar nomes de rodovias e cidades por prefixo\n");
+        printf("16. Definir coordenadas geográficas de uma cidade\n");
+        printf("17. Buscar cidades próximas a uma coordenada geográfica\n");
+        printf("18. Publicar alterações para réplicas\n");
+        printf("19. Otimizar roteiro de entregas a partir de um depósito\n");
+        printf("20. Interditar ou liberar trecho de rodovia\n");
+        printf("21. Ver rotas evitando rodovias ou pedágios acima de um valor\n");
+        printf("22. Atualizar distâncias e pedágios de trechos a partir de um arquivo\n");
+        printf("0. Sair\n");
+        scanf("%d", &opcao);
+        getchar();
+
+        switch (opcao)
+        {
+        case 1:
+            printf("Insira o nome da rodovia: ");
+            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
+            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
+            status = inserirRodoviaRede(rede, nomeRodovia);
+            if (status == RODOVIAS_RODOVIA_EXISTENTE)
+            {
+                printf("Erro: A rodovia '%s' já existe!\n", nomeRodovia);
+            }
+            else if (status == RODOVIAS_ERRO_MEMORIA)
+            {
+                printf("Erro de alocação de memória!\n");
+            }
+            relatarDiario(status);
+            break;
+
+        case 2:
+            printf("Insira o nome da rodovia a ser removida: ");
+            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
+            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
+            relatarDiario(removerRodoviaRede(rede, nomeRodovia));
+            break;
+
+        case 3:
+            printf("Insira o nome da rodovia para adicionar a cidade: ");
+            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
+            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
+
+            if (buscarRodoviaRede(rede, nomeRodovia, NULL) == RODOVIAS_OK)
+            {
+                printf("Insira o nome da cidade: ");
+                fgets(nomeCidade, sizeof(nomeCidade), stdin);
+                nomeCidade[strcspn(nomeCidade, "\n")] = 0;
+
+                if (localizarCidadeRede(rede, nomeRodovia, nomeCidade, NULL) == RODOVIAS_OK)
+                {
+                    printf("Erro: A cidade '%s' já existe na rodovia '%s'!\n",
+                           nomeCidade, nomeRodovia);
+                    break;
+                }
+
+                printf("Insira a distância da cidade em relação ao início da rodovia: ");
+                if (scanf("%f", &distancia) != 1)
+                {
+                    printf("Erro: entrada inválida para distância\n");
+                    while (getchar() != '\n')
+                        ;
+                    break;
+                }
+                getchar();
+
+                status = inserirCidadeRede(rede, nomeRodovia, nomeCidade, distancia);
+                if (status != RODOVIAS_OK && status != RODOVIAS_ERRO_ARQUIVO)
+                {
+                    printf("Erro ao inserir cidade\n");
+                    break;
+                }
+                relatarDiario(status);
+
+                int cityCount;
+                InfoCidade *cidades = obterCidades(rede, nomeRodovia, &cityCount);
+
+                if (cityCount > 1)
+                {
+                    printf("\nCidades presentes na rodovia %s:\n", nomeRodovia);
+                    int i = 1;
+                    for (; i <= cityCount; i++)
+                    {
+                        if (strcmp(cidades[i - 1].nome, nomeCidade) != 0)
+                        {
+                            printf("%d. %s (Distância: %.2f km)\n", i, cidades[i - 1].nome, cidades[i - 1].distancia);
+                        }
+                    }
+
+                    printf("\nDeseja adicionar pedágio para alguma cidade? (1-Sim, 0-Não): ");
+                    int addPedagio;
+                    scanf("%d", &addPedagio);
+                    getchar();
+
+                    if (addPedagio == 1)
+                    {
+                        printf("\nEscolha o número da cidade para adicionar pedágio: ");
+                        int escolha;
+                        scanf("%d", &escolha);
+                        getchar();
+
+                        if (escolha >= 1 && escolha < i)
+                        {
+                            InfoCidade *cidadeEscolhida = &cidades[escolha - 1];
+                            float valorPedagio;
+                            printf("Digite o valor do pedágio entre %s e %s: R$ ",
+                                   nomeCidade, cidadeEscolhida->nome);
+                            scanf("%f", &valorPedagio);
+                            getchar();
+
+                            status = definirPedagioRede(rede, nomeRodovia, nomeCidade, cidadeEscolhida->nome,
+                                                        valorPedagio);
+                            if (status == RODOVIAS_OK || status == RODOVIAS_ERRO_ARQUIVO)
+                            {
+                                printf("Pedágio de R$ %.2f adicionado entre %s e %s.\n",
+                                       valorPedagio, nomeCidade, cidadeEscolhida->nome);
+                                relatarDiario(status);
+                            }
+                            else if (status == RODOVIAS_CIDADES_IGUAIS)
+                            {
+                                printf("Erro: As cidades do pedágio devem ser diferentes.\n");
+                            }
+                            else if (status == RODOVIAS_ARGUMENTO_INVALIDO)
+                            {
+                                printf("Erro: O pedágio deve ligar cidades vizinhas na rodovia.\n");
+                            }
+                            else
+                            {
+                                printf("Erro: Uma ou ambas as cidades não foram encontradas na rodovia.\n");
+                            }
+                        }
+                        else
+                        {
+                            printf("Escolha inválida!\n");
+                        }
+                    }
+                }
+                free(cidades);
+
+                printf("Cidade '%s' inserida com sucesso na rodovia '%s'!\n",
+                       nomeCidade, nomeRodovia);
+            }
+            else
+            {
+                printf("Rodovia não encontrada!\n");
+                sugerirNome(rede, NOME_RODOVIA, nomeRodovia);
+            }
+            break;
+
+        case 4:
+            printf("Insira o nome da rodovia para remover a cidade: ");
+            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
+            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
+            if (buscarRodoviaRede(rede, nomeRodovia, &r1) == RODOVIAS_OK)
+            {
+                printf("Insira o nome da cidade a ser removida: ");
+                fgets(nomeCidade, sizeof(nomeCidade), stdin);
+                nomeCidade[strcspn(nomeCidade, "\n")] = 0;
+                status = removerCidadeRede(rede, nomeRodovia, nomeCidade);
+                if (status == RODOVIAS_OK || status == RODOVIAS_ERRO_ARQUIVO)
+                {
+                    printf("Cidade '%s' removida com sucesso!\n", nomeCidade);
+                    relatarDiario(status);
+                }
+                else if (r1.numeroCidades == 0)
+                {
+                    printf("Nenhuma cidade para remover.\n");
+                }
+                else
+                {
+                    printf("Cidade '%s' não encontrada na rodovia.\n", nomeCidade);
+                    sugerirNome(rede, NOME_CIDADE, nomeCidade);
+                }
+            }
+            else
+            {
+                printf("Rodovia não encontrada!\n");
+                sugerirNome(rede, NOME_RODOVIA, nomeRodovia);
+            }
+            break;
+
+        case 5:
+            printf("Insira a cidade de início: ");
+            fgets(cidadeInicio, sizeof(cidadeInicio), stdin);
+            cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
+
+            printf("Insira a cidade de fim: ");
+            fgets(cidadeFim, sizeof(cidadeFim), stdin);
+            cidadeFim[strcspn(cidadeFim, "\n")] = 0;
+
+            percursoEntreRodovias(rede, cidadeInicio, cidadeFim);
+            break;
+
+        case 6:
+            printf("\nVerificando todos os cruzamentos entre rodovias...\n");
+            listarTodosCruzamentos(rede);
+            break;
+
+        case 7:
+            fflush(stdout);
+            escreverRede(rede, STDOUT_FILENO);
+            break;
+
+        case 8:
+            printf("Digite o nome do novo arquivo para salvar (ex: novo_rodovias.txt): ");
+            char novoArquivo[50];
+            scanf("%49s", novoArquivo);
+            getchar();
+            if (exportarRede(rede, novoArquivo) != RODOVIAS_OK)
+            {
+                printf("Erro ao criar novo arquivo!\n");
+                break;
+            }
+            printf("Dados salvos com sucesso em '%s'!\n", novoArquivo);
+            break;
+
+        case 9:
+            printf("Insira o nome das duas rodovias para listar todos os cruzamentos:\n");
+            fgets(rodovia1, sizeof(rodovia1), stdin);
+            rodovia1[strcspn(rodovia1, "\n")] = 0;
+            fgets(rodovia2, sizeof(rodovia2), stdin);
+            rodovia2[strcspn(rodovia2, "\n")] = 0;
+            if (buscarRodoviaRede(rede, rodovia1, &r1) == RODOVIAS_OK &&
+                buscarRodoviaRede(rede, rodovia2, &r2) == RODOVIAS_OK)
+            {
+                listarCruzamentos(rede, &r1, &r2);
+            }
+            else
+            {
+                printf("Uma ou ambas as rodovias não foram encontradas!\n");
+                sugerirNome(rede, NOME_RODOVIA, rodovia1);
+                sugerirNome(rede, NOME_RODOVIA, rodovia2);
+            }
+            break;
+
+        case 10:
+            if (strlen(nomeArquivo) > 0)
+            {
+                if (alteracoesPendentesRede(rede) == 0)
+                {
+                    printf("Nenhuma alteração pendente em '%s'.\n", nomeArquivo);
+                }
+                else if (salvarRede(rede, 0) == RODOVIAS_OK)
+                {
+                    printf("Alterações salvas com sucesso em '%s'!\n", nomeArquivo);
+                }
+                else
+                {
+                    printf("Erro ao salvar as alterações em '%s'!\n", nomeArquivo);
+                }
+            }
+            else
+            {
+                printf("Nenhum arquivo foi carregado inicialmente. Use a opção 8 para salvar em um novo arquivo.\n");
+            }
+            break;
+
+        case 11:
+            printf("Insira a cidade de início: ");
+            fgets(cidadeInicio, sizeof(cidadeInicio), stdin);
+            cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
+
+            printf("Insira a cidade de fim: ");
+            fgets(cidadeFim, sizeof(cidadeFim), stdin);
+            cidadeFim[strcspn(cidadeFim, "\n")] = 0;
+
+            printf("Critério: 1-Todas as opções distância x pedágio, 2-Custo ponderado: ");
+            int criterio;
+            scanf("%d", &criterio);
+            getchar();
+
+            float pesoDistancia = 0, pesoPedagio = 0;
+            if (criterio == 2)
+            {
+                printf("Insira o custo por km e o peso de cada R$ de pedágio (ex: 0.8 1): ");
+                if (scanf("%f %f", &pesoDistancia, &pesoPedagio) != 2 || pesoDistancia < 0 || pesoPedagio < 0)
+                {
+                    printf("Erro: entrada inválida para os pesos\n");
+                    while (getchar() != '\n')
+                        ;
+                    break;
+                }
+                getchar();
+            }
+            rotasAlternativas(rede, cidadeInicio, cidadeFim, pesoDistancia, pesoPedagio, NULL);
+            break;
+
+        case 12:
+            printf("Insira a cidade de origem: ");
+            fgets(cidadeInicio, sizeof(cidadeInicio), stdin);
+            cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
+
+            printf("Limite por: 1-Distância (km), 2-Pedágio (R$): ");
+            int limitePor;
+            scanf("%d", &limitePor);
+            getchar();
+
+            printf("Insira o limite: ");
+            float limite;
+            if (scanf("%f", &limite) != 1 || limite < 0 || (limitePor != 1 && limitePor != 2))
+            {
+                printf("Erro: entrada inválida para o limite\n");
+                while (getchar() != '\n')
+                    ;
+                break;
+            }
+            getchar();
+            cidadesAlcancaveis(rede, &alcancadas, &capacidadeAlcance, cidadeInicio,
+                               limitePor == 2 ? ALCANCE_PEDAGIO : ALCANCE_DISTANCIA, limite);
+            break;
+
+        case 13:
+            printf("Insira o nome da rodovia: ");
+            fgets(nomeRodovia, sizeof(nomeRodovia), stdin);
+            nomeRodovia[strcspn(nomeRodovia, "\n")] = 0;
+
+            printf("Insira as duas cidades do trecho:\n");
+            fgets(cidadeInicio, sizeof(cidadeInicio), stdin);
+            cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
+            fgets(cidadeFim, sizeof(cidadeFim), stdin);
+            cidadeFim[strcspn(cidadeFim, "\n")] = 0;
+
+            if (!lerHorarioClasse(&inicio, &classe))
+            {
+                break;
+            }
+            printf("Insira o valor a partir desse horário (negativo remove a tarifa): R$ ");
+            if (scanf("%f", &valor) != 1)
+            {
+                printf("Erro: entrada inválida para o valor\n");
+                while (getchar() != '\n')
+                    ;
+                break;
+            }
+            getchar();
+
+            status = definirTarifaRede(rede, nomeRodovia, cidadeInicio, cidadeFim, classe, inicio, valor);
+            if (status == RODOVIAS_OK || status == RODOVIAS_ERRO_ARQUIVO)
+            {
+                printf(valor < 0 ? "Tarifa removida.\n" : "Tarifa definida.\n");
+                relatarDiario(status);
+            }
+            else if (status == RODOVIAS_RODOVIA_NAO_ENCONTRADA)
+            {
+                printf("Rodovia não encontrada!\n");
+                sugerirNome(rede, NOME_RODOVIA, nomeRodovia);
+            }
+            else if (status == RODOVIAS_CIDADES_IGUAIS)
+            {
+                printf("Erro: As cidades do pedágio devem ser diferentes.\n");
+            }
+            else if (status == RODOVIAS_CIDADE_NAO_ENCONTRADA)
+            {
+                printf("Erro: Uma ou ambas as cidades não foram encontradas na rodovia.\n");
+            }
+            else
+            {
+                printf("%s\n", descreverStatusRodovias(status));
+            }
+            break;
+
+        case 14:
+            printf("Insira a cidade de início: ");
+            fgets(cidadeInicio, sizeof(cidadeInicio), stdin);
+            cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
+
+            printf("Insira a cidade de fim: ");
+            fgets(cidadeFim, sizeof(cidadeFim), stdin);
+            cidadeFim[strcspn(cidadeFim, "\n")] = 0;
+
+            if (lerHorarioClasse(&partida, &classe))
+            {
+                percursoTarifado(rede, cidadeInicio, cidadeFim, partida, classe);
+            }
+            break;
+
+        case 15:
+            printf("Insira o início do nome: ");
+            fgets(nomeCidade, sizeof(nomeCidade), stdin);
+            nomeCidade[strcspn(nomeCidade, "\n")] = 0;
+            listarNomes(rede, NOME_RODOVIA, "Rodovias", nomeCidade);
+            listarNomes(rede, NOME_CIDADE, "Cidades", nomeCidade);
+            break;
+
+        case 16:
+            printf("Insira o nome da cidade: ");
+            fgets(nomeCidade, sizeof(nomeCidade), stdin);
+            nomeCidade[strcspn(nomeCidade, "\n")] = 0;
+            if (!lerCoordenadas(&posicao))
+            {
+                break;
+            }
+            status = definirCoordenadasRede(rede, nomeCidade, posicao.latitude, posicao.longitude);
+            if (status == RODOVIAS_OK || status == RODOVIAS_ERRO_ARQUIVO)
+            {
+                printf("Coordenadas de '%s' definidas.\n", nomeCidade);
+                relatarDiario(status);
+            }
+            else
+            {
+                printf("Cidade '%s' não encontrada!\n", nomeCidade);
+                sugerirNome(rede, NOME_CIDADE, nomeCidade);
+            }
+            break;
+
+        case 17:
+            if (!lerCoordenadas(&posicao))
+            {
+                break;
+            }
+            printf("Insira o raio de busca em km (0 para apenas a mais próxima): ");
+            if (scanf("%f", &valor) != 1 || valor < 0)
+            {
+                printf("Erro: entrada inválida para o raio\n");
+                while (getchar() != '\n')
+                    ;
+                break;
+            }
+            getchar();
+            cidadesProximas(rede, &posicao, valor);
+            break;
+
+        case 18:
+            printf("Insira o caminho do arquivo de alterações (ex: rodovias.alt): ");
+            fgets(caminhoAlimentacao, sizeof(caminhoAlimentacao), stdin);
+            caminhoAlimentacao[strcspn(caminhoAlimentacao, "\n")] = 0;
+            if (publicarAlteracoesRede(rede, caminhoAlimentacao) == RODOVIAS_OK &&
+                consultarAlimentacaoRede(rede, &alimentacao) == RODOVIAS_OK)
+            {
+                printf("Alterações publicadas em '%s' (geração %llu).\n", caminhoAlimentacao, alimentacao.geracao);
+            }
+            else
+            {
+                printf("Erro ao publicar as alterações em '%s'!\n", caminhoAlimentacao);
+            }
+            break;
+
+        case 19:
+            printf("Insira a cidade do depósito: ");
+            fgets(cidadeInicio, sizeof(cidadeInicio), stdin);
+            cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
+            roteiroEntregas(rede, cidadeInicio);
+            break;
+
+        case 20:
+            interdicoesTrechos(rede);
+            break;
+
+        case 21:
+            printf("Insira a cidade de início: ");
+            fgets(cidadeInicio, sizeof(cidadeInicio), stdin);
+            cidadeInicio[strcspn(cidadeInicio, "\n")] = 0;
+
+            printf("Insira a cidade de fim: ");
+            fgets(cidadeFim, sizeof(cidadeFim), stdin);
+            cidadeFim[strcspn(cidadeFim, "\n")] = 0;
+            rotasRestritas(rede, cidadeInicio, cidadeFim);
+            break;
+
+        case 22:
+            printf("Insira o arquivo de atualizações (rodovia, cidade, cidade seguinte, km e R$ separados por "
+                   "tabulação; -1 mantém o valor): ");
+            fgets(caminhoAlimentacao, sizeof(caminhoAlimentacao), stdin);
+            caminhoAlimentacao[strcspn(caminhoAlimentacao, "\n")] = 0;
+            atualizarTrechosArquivo(rede, caminhoAlimentacao);
+            break;
+
+        default:
+            if (opcao != 0)
+            {
+                printf("Opcao invalida!\n");
+            }
+            break;
+        }
+    }
+
+    if (strlen(nomeArquivo) > 0)
+    {
+        printf("\nDeseja salvar as alterações antes de sair? (1-Sim, 0-Não): ");
+        int salvar;
+        scanf("%d", &salvar);
+        if (salvar == 1)
+        {
+            if (salvarRede(rede, 1) == RODOVIAS_OK)
+            {
+                printf("Alterações salvas com sucesso em '%s'!\n", nomeArquivo);
+            }
+            else
+            {
+                printf("Erro ao salvar as alterações em '%s'!\n", nomeArquivo);
+            }
+        }
+        else
+        {
+            descartarAlteracoesRede(rede);
+        }
+    }
+
+    free(alcancadas);
+    destruirRede(rede);
+    printf("Saindo...\n");
+}
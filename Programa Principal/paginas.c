@@ -0,0 +1,790 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "estruturas.h"
+
+static int posicaoNaTabela(CachePaginas *cache, uint32_t pagina)
+{
+    return (int)((pagina * 2654435761u) & (uint32_t)(cache->capacidadeTabela - 1));
+}
+
+int abrirCachePaginas(CachePaginas *cache, int descritor, int quantidadeQuadros)
+{
+    if (quantidadeQuadros < 4)
+    {
+        quantidadeQuadros = 4;
+    }
+
+    memset(cache, 0, sizeof(CachePaginas));
+    cache->descritor = descritor;
+    cache->quantidadeQuadros = quantidadeQuadros;
+    cache->capacidadeTabela = 16;
+    while (cache->capacidadeTabela < 2 * quantidadeQuadros)
+    {
+        cache->capacidadeTabela *= 2;
+    }
+
+    cache->quadros = calloc(quantidadeQuadros, sizeof(QuadroPagina));
+    cache->memoria = malloc((size_t)quantidadeQuadros * TAMANHO_PAGINA);
+    cache->tabela = malloc(sizeof(int) * cache->capacidadeTabela);
+    if (cache->quadros == NULL || cache->memoria == NULL || cache->tabela == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        fecharCachePaginas(cache);
+        return 0;
+    }
+    memset(cache->tabela, -1, sizeof(int) * cache->capacidadeTabela);
+
+    for (int q = 0; q < quantidadeQuadros; q++)
+    {
+        cache->quadros[q].dados = cache->memoria + (size_t)q * TAMANHO_PAGINA;
+        cache->quadros[q].anterior = q - 1;
+        cache->quadros[q].proximo = q + 1 < quantidadeQuadros ? q + 1 : -1;
+        cache->quadros[q].proximoNaTabela = -1;
+    }
+    cache->maisRecente = 0;
+    cache->menosRecente = quantidadeQuadros - 1;
+    return 1;
+}
+
+static void moverParaFrente(CachePaginas *cache, int q)
+{
+    QuadroPagina *quadro = &cache->quadros[q];
+    if (cache->maisRecente == q)
+    {
+        return;
+    }
+
+    cache->quadros[quadro->anterior].proximo = quadro->proximo;
+    if (quadro->proximo >= 0)
+    {
+        cache->quadros[quadro->proximo].anterior = quadro->anterior;
+    }
+    else
+    {
+        cache->menosRecente = quadro->anterior;
+    }
+
+    quadro->anterior = -1;
+    quadro->proximo = cache->maisRecente;
+    cache->quadros[cache->maisRecente].anterior = q;
+    cache->maisRecente = q;
+}
+
+static void removerDaTabela(CachePaginas *cache, int q)
+{
+    int *elo = &cache->tabela[posicaoNaTabela(cache, cache->quadros[q].pagina)];
+    while (*elo != q)
+    {
+        elo = &cache->quadros[*elo].proximoNaTabela;
+    }
+    *elo = cache->quadros[q].proximoNaTabela;
+    cache->quadros[q].proximoNaTabela = -1;
+}
+
+static void gravarQuadro(CachePaginas *cache, QuadroPagina *quadro)
+{
+    off_t deslocamento = (off_t)quadro->pagina * TAMANHO_PAGINA;
+    if (pwrite(cache->descritor, quadro->dados, TAMANHO_PAGINA, deslocamento) != TAMANHO_PAGINA)
+    {
+        cache->erro = 1;
+    }
+    cache->gravacoes++;
+    quadro->sujo = 0;
+}
+
+static char *obterPagina(CachePaginas *cache, uint32_t pagina, int alterar)
+{
+    int posicao = posicaoNaTabela(cache, pagina);
+    for (int q = cache->tabela[posicao]; q >= 0; q = cache->quadros[q].proximoNaTabela)
+    {
+        if (cache->quadros[q].pagina == pagina)
+        {
+            cache->acertos++;
+            cache->quadros[q].sujo |= alterar;
+            moverParaFrente(cache, q);
+            return cache->quadros[q].dados;
+        }
+    }
+
+    cache->faltas++;
+    int q = cache->menosRecente;
+    QuadroPagina *quadro = &cache->quadros[q];
+    if (quadro->ocupado)
+    {
+        if (quadro->sujo)
+        {
+            gravarQuadro(cache, quadro);
+        }
+        removerDaTabela(cache, q);
+    }
+
+    ssize_t lidos;
+    do
+    {
+        lidos = pread(cache->descritor, quadro->dados, TAMANHO_PAGINA, (off_t)pagina * TAMANHO_PAGINA);
+    } while (lidos < 0 && errno == EINTR);
+    if (lidos < 0)
+    {
+        cache->erro = 1;
+        lidos = 0;
+    }
+    memset(quadro->dados + lidos, 0, TAMANHO_PAGINA - lidos);
+
+    quadro->pagina = pagina;
+    quadro->ocupado = 1;
+    quadro->sujo = alterar;
+    quadro->proximoNaTabela = cache->tabela[posicao];
+    cache->tabela[posicao] = q;
+    moverParaFrente(cache, q);
+    return quadro->dados;
+}
+
+char *lerPagina(CachePaginas *cache, uint32_t pagina)
+{
+    return obterPagina(cache, pagina, 0);
+}
+
+char *alterarPagina(CachePaginas *cache, uint32_t pagina)
+{
+    return obterPagina(cache, pagina, 1);
+}
+
+int descarregarCache(CachePaginas *cache)
+{
+    for (int q = 0; q < cache->quantidadeQuadros; q++)
+    {
+        if (cache->quadros[q].ocupado && cache->quadros[q].sujo)
+        {
+            gravarQuadro(cache, &cache->quadros[q]);
+        }
+    }
+    return cache->erro ? -1 : 0;
+}
+
+void fecharCachePaginas(CachePaginas *cache)
+{
+    free(cache->quadros);
+    free(cache->memoria);
+    free(cache->tabela);
+    cache->quadros = NULL;
+    cache->memoria = NULL;
+    cache->tabela = NULL;
+}
+
+static uint32_t primeiraPaginaIndice(RedePaginada *rede)
+{
+    return 1 + rede->cabecalho.paginasDiretorio;
+}
+
+static int inserirIndice(RedePaginada *rede, EntradaIndiceCidade *entrada)
+{
+    uint32_t pagina = primeiraPaginaIndice(rede) + entrada->hash % rede->cabecalho.paginasIndice;
+    for (;;)
+    {
+        PaginaIndice *indice = (PaginaIndice *)alterarPagina(&rede->cache, pagina);
+        if (indice->quantidade < ENTRADAS_POR_PAGINA_INDICE)
+        {
+            indice->entradas[indice->quantidade++] = *entrada;
+            return 1;
+        }
+        if (indice->proxima == 0)
+        {
+            indice->proxima = rede->cabecalho.totalPaginas++;
+        }
+        pagina = indice->proxima;
+    }
+}
+
+static int compararCidadesLidas(const void *a, const void *b)
+{
+    const RegistroCidade *cidade1 = a, *cidade2 = b;
+    if (cidade1->distancia != cidade2->distancia)
+    {
+        return cidade1->distancia < cidade2->distancia ? -1 : 1;
+    }
+    return cidade1->hash < cidade2->hash ? -1 : cidade1->hash > cidade2->hash;
+}
+
+static void gravarRodoviaPaginada(RedePaginada *rede, char nomeRodovia[], RegistroCidade cidades[], int quantidade)
+{
+    uint32_t indiceRodovia = rede->cabecalho.quantidadeRodovias++;
+    RegistroRodovia rodovia;
+    memset(&rodovia, 0, sizeof(rodovia));
+    strcpy(rodovia.nome, nomeRodovia);
+
+    char chave[TAMANHO_CHAVE];
+    normalizarNome(nomeRodovia, chave);
+    rodovia.hash = calcularHash(chave);
+    rodovia.numeroCidades = quantidade;
+    rodovia.primeiraPagina = quantidade > 0 ? rede->cabecalho.totalPaginas : 0;
+    rede->cabecalho.totalPaginas += (quantidade + REGISTROS_POR_PAGINA - 1) / REGISTROS_POR_PAGINA;
+
+    qsort(cidades, quantidade, sizeof(RegistroCidade), compararCidadesLidas);
+    for (int i = 0; i < quantidade; i++)
+    {
+        cidades[i].pedagioIda = i + 1 < quantidade ? cidades[i + 1].pedagioIda : 0;
+        cidades[i].pedagioVolta = i + 1 < quantidade ? cidades[i + 1].pedagioVolta : PEDAGIO_INDEFINIDO;
+        rodovia.pedagioTotal += cidades[i].pedagioIda;
+
+        normalizarNome(cidades[i].nome, chave);
+        cidades[i].hash = calcularHash(chave);
+
+        RegistroCidade *pagina = (RegistroCidade *)alterarPagina(&rede->cache, rodovia.primeiraPagina + i / REGISTROS_POR_PAGINA);
+        pagina[i % REGISTROS_POR_PAGINA] = cidades[i];
+
+        EntradaIndiceCidade entrada = {cidades[i].hash, indiceRodovia, (uint32_t)i};
+        inserirIndice(rede, &entrada);
+    }
+
+    RegistroRodovia *diretorio = (RegistroRodovia *)alterarPagina(&rede->cache, 1 + indiceRodovia / REGISTROS_POR_PAGINA);
+    diretorio[indiceRodovia % REGISTROS_POR_PAGINA] = rodovia;
+}
+
+static int lerProximaRodovia(FILE *arquivo, char nomeRodovia[], RegistroCidade **cidades, int *capacidade,
+                             int *quantidade)
+{
+    char linha[256];
+    int encontrou = 0;
+    while (!encontrou && fgets(linha, sizeof(linha), arquivo))
+    {
+        encontrou = sscanf(linha, "Rodovia: %49s", nomeRodovia) == 1;
+    }
+    if (!encontrou)
+    {
+        return 0;
+    }
+
+    *quantidade = 0;
+    while (fgets(linha, sizeof(linha), arquivo) && (linha[0] == '\t' || strncmp(linha, "Pedágio:", 9) == 0))
+    {
+        RegistroCidade cidade;
+        memset(&cidade, 0, sizeof(cidade));
+        double latitude, longitude;
+        if (*quantidade > 0 && sscanf(linha, "\t\tCoordenadas: %lf, %lf", &latitude, &longitude) == 2)
+        {
+            Micrograus lat = grausParaMicrograus(latitude), lon = grausParaMicrograus(longitude);
+            if (coordenadasValidas(lat, lon))
+            {
+                (*cidades)[*quantidade - 1].latitude = lat;
+                (*cidades)[*quantidade - 1].longitude = lon;
+            }
+            continue;
+        }
+        cidade.latitude = COORDENADA_INDEFINIDA;
+        cidade.longitude = COORDENADA_INDEFINIDA;
+        double distancia, ida = 0, volta = PEDAGIO_INDEFINIDO;
+        if (sscanf(linha, "\tCidade: %49[^,], Distância: %lf, Pedágio: R$ %lf, Volta: R$ %lf",
+                   cidade.nome, &distancia, &ida, &volta) < 2)
+        {
+            continue;
+        }
+        cidade.distancia = kmParaMetros(distancia);
+        cidade.pedagioIda = reaisParaCentavos(ida);
+        cidade.pedagioVolta = volta >= 0 ? reaisParaCentavos(volta) : PEDAGIO_INDEFINIDO;
+        if (*quantidade == *capacidade)
+        {
+            int novaCapacidade = *capacidade > 0 ? *capacidade * 2 : 256;
+            RegistroCidade *maiores = realloc(*cidades, sizeof(RegistroCidade) * novaCapacidade);
+            if (maiores == NULL)
+            {
+                printf("Erro de alocação de memória!\n");
+                return -1;
+            }
+            *cidades = maiores;
+            *capacidade = novaCapacidade;
+        }
+        cidade.hash = *quantidade;
+        (*cidades)[(*quantidade)++] = cidade;
+    }
+    return 1;
+}
+
+int converterParaPaginas(char arquivoTexto[], char arquivoPaginas[], int quantidadeQuadros)
+{
+    FILE *arquivo = fopen(arquivoTexto, "r");
+    if (arquivo == NULL)
+    {
+        printf("Erro ao abrir o arquivo %s para leitura!\n", arquivoTexto);
+        return 1;
+    }
+
+    char linha[256];
+    char nomeRodovia[50];
+    uint32_t rodovias = 0, cidades = 0;
+    while (fgets(linha, sizeof(linha), arquivo))
+    {
+        rodovias += sscanf(linha, "Rodovia: %49s", nomeRodovia) == 1;
+        cidades += strncmp(linha, "\tCidade: ", 9) == 0;
+    }
+    rewind(arquivo);
+
+    int descritor = open(arquivoPaginas, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    RedePaginada rede;
+    if (descritor < 0 || !abrirCachePaginas(&rede.cache, descritor, quantidadeQuadros))
+    {
+        printf("Erro ao abrir o arquivo para escrita!\n");
+        if (descritor >= 0)
+        {
+            close(descritor);
+        }
+        fclose(arquivo);
+        return 1;
+    }
+
+    memset(&rede.cabecalho, 0, sizeof(rede.cabecalho));
+    rede.cabecalho.assinatura = ASSINATURA_REDE_PAGINADA;
+    rede.cabecalho.versao = VERSAO_REDE_PAGINADA;
+    rede.cabecalho.paginasDiretorio = (rodovias + REGISTROS_POR_PAGINA - 1) / REGISTROS_POR_PAGINA;
+    rede.cabecalho.paginasIndice = 1 + cidades * 4 / (3 * ENTRADAS_POR_PAGINA_INDICE);
+    rede.cabecalho.totalPaginas = 1 + rede.cabecalho.paginasDiretorio + rede.cabecalho.paginasIndice;
+
+    RegistroCidade *lidas = NULL;
+    int capacidade = 0, quantidade = 0, resultado = 0;
+    while (rede.cabecalho.quantidadeRodovias < rodovias &&
+           (resultado = lerProximaRodovia(arquivo, nomeRodovia, &lidas, &capacidade, &quantidade)) > 0)
+    {
+        gravarRodoviaPaginada(&rede, nomeRodovia, lidas, quantidade);
+        rede.cabecalho.quantidadeCidades += quantidade;
+    }
+    free(lidas);
+    fclose(arquivo);
+
+    memcpy(alterarPagina(&rede.cache, 0), &rede.cabecalho, sizeof(rede.cabecalho));
+    int falhou = resultado < 0 || descarregarCache(&rede.cache) != 0 || fsync(descritor) != 0;
+    printf("Rede paginada gravada em '%s': %u rodovias, %u cidades, %u páginas (%ld faltas de página).\n",
+           arquivoPaginas, rede.cabecalho.quantidadeRodovias, rede.cabecalho.quantidadeCidades,
+           rede.cabecalho.totalPaginas, rede.cache.faltas);
+    fecharCachePaginas(&rede.cache);
+    close(descritor);
+
+    if (falhou)
+    {
+        printf("Erro ao gravar o arquivo '%s'!\n", arquivoPaginas);
+        return 1;
+    }
+    return 0;
+}
+
+int abrirRedePaginada(RedePaginada *rede, char arquivoPaginas[], int quantidadeQuadros)
+{
+    int descritor = open(arquivoPaginas, O_RDONLY);
+    if (descritor < 0)
+    {
+        printf("Erro ao abrir o arquivo %s para leitura!\n", arquivoPaginas);
+        return 0;
+    }
+    if (!abrirCachePaginas(&rede->cache, descritor, quantidadeQuadros))
+    {
+        close(descritor);
+        return 0;
+    }
+
+    memcpy(&rede->cabecalho, lerPagina(&rede->cache, 0), sizeof(CabecalhoRedePaginada));
+    if (rede->cabecalho.assinatura != ASSINATURA_REDE_PAGINADA || rede->cabecalho.versao != VERSAO_REDE_PAGINADA ||
+        rede->cabecalho.paginasIndice == 0)
+    {
+        printf("Erro: '%s' não é uma rede paginada válida!\n", arquivoPaginas);
+        fecharRedePaginada(rede);
+        return 0;
+    }
+    return 1;
+}
+
+void fecharRedePaginada(RedePaginada *rede)
+{
+    close(rede->cache.descritor);
+    fecharCachePaginas(&rede->cache);
+}
+
+int lerRegistroRodovia(RedePaginada *rede, uint32_t indice, RegistroRodovia *registro)
+{
+    if (indice >= rede->cabecalho.quantidadeRodovias)
+    {
+        return 0;
+    }
+    RegistroRodovia *pagina = (RegistroRodovia *)lerPagina(&rede->cache, 1 + indice / REGISTROS_POR_PAGINA);
+    *registro = pagina[indice % REGISTROS_POR_PAGINA];
+    return 1;
+}
+
+int lerRegistroCidade(RedePaginada *rede, RegistroRodovia *rodovia, uint32_t posicao, RegistroCidade *cidade)
+{
+    if (posicao >= rodovia->numeroCidades)
+    {
+        return 0;
+    }
+    RegistroCidade *pagina = (RegistroCidade *)lerPagina(&rede->cache, rodovia->primeiraPagina + posicao / REGISTROS_POR_PAGINA);
+    *cidade = pagina[posicao % REGISTROS_POR_PAGINA];
+    return 1;
+}
+
+int buscarRodoviaPaginada(RedePaginada *rede, char nome[], RegistroRodovia *registro)
+{
+    char chaveBusca[TAMANHO_CHAVE], chave[TAMANHO_CHAVE];
+    normalizarNome(nome, chaveBusca);
+    uint32_t hashBusca = calcularHash(chaveBusca);
+
+    for (uint32_t i = 0; i < rede->cabecalho.quantidadeRodovias; i++)
+    {
+        lerRegistroRodovia(rede, i, registro);
+        if (registro->hash != hashBusca)
+        {
+            continue;
+        }
+        normalizarNome(registro->nome, chave);
+        if (chavesIguais(chave, chaveBusca))
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+int localizarCidadePaginada(RedePaginada *rede, char nomeCidade[], OcorrenciaCidade ocorrencias[], int maximo)
+{
+    char chaveBusca[TAMANHO_CHAVE], chave[TAMANHO_CHAVE];
+    normalizarNome(nomeCidade, chaveBusca);
+    uint32_t hashBusca = calcularHash(chaveBusca);
+
+    int quantidade = 0;
+    uint32_t pagina = primeiraPaginaIndice(rede) + hashBusca % rede->cabecalho.paginasIndice;
+    while (pagina != 0 && quantidade < maximo)
+    {
+        PaginaIndice indice;
+        memcpy(&indice, lerPagina(&rede->cache, pagina), sizeof(indice));
+
+        for (uint32_t i = 0; i < indice.quantidade && quantidade < maximo; i++)
+        {
+            EntradaIndiceCidade *entrada = &indice.entradas[i];
+            if (entrada->hash != hashBusca)
+            {
+                continue;
+            }
+
+            RegistroRodovia rodovia;
+            RegistroCidade cidade;
+            if (!lerRegistroRodovia(rede, entrada->rodovia, &rodovia) ||
+                !lerRegistroCidade(rede, &rodovia, entrada->posicao, &cidade))
+            {
+                continue;
+            }
+            normalizarNome(cidade.nome, chave);
+            if (chavesIguais(chave, chaveBusca))
+            {
+                ocorrencias[quantidade].rodovia = entrada->rodovia;
+                ocorrencias[quantidade].posicao = entrada->posicao;
+                ocorrencias[quantidade].distancia = cidade.distancia;
+                quantidade++;
+            }
+        }
+        pagina = indice.proxima;
+    }
+    return quantidade;
+}
+
+void somarTrechoPaginado(RedePaginada *rede, RegistroRodovia *rodovia, uint32_t inicio, uint32_t fim,
+                         Centavos *pedagioTotal, Metros *distanciaTotal)
+{
+    RegistroCidade cidade, inicial, final;
+    memset(&cidade, 0, sizeof(cidade));
+    memset(&inicial, 0, sizeof(inicial));
+    memset(&final, 0, sizeof(final));
+    uint32_t primeira = inicio < fim ? inicio : fim;
+    uint32_t ultima = inicio < fim ? fim : inicio;
+
+    *pedagioTotal = 0;
+    for (uint32_t i = primeira; i < ultima; i++)
+    {
+        lerRegistroCidade(rede, rodovia, i, &cidade);
+        if (inicio > fim && cidade.pedagioVolta >= 0)
+        {
+            *pedagioTotal += cidade.pedagioVolta;
+        }
+        else
+        {
+            *pedagioTotal += cidade.pedagioIda;
+        }
+    }
+
+    lerRegistroCidade(rede, rodovia, inicio, &inicial);
+    lerRegistroCidade(rede, rodovia, fim, &final);
+    *distanciaTotal = inicio < fim ? final.distancia - inicial.distancia : inicial.distancia - final.distancia;
+}
+
+static void responderTrechoPaginado(BufferSaida *saida, RedePaginada *rede, uint32_t indiceRodovia,
+                                    uint32_t inicio, uint32_t fim)
+{
+    RegistroRodovia rodovia;
+    RegistroCidade origem, destino;
+    Centavos pedagio;
+    Metros distancia;
+
+    lerRegistroRodovia(rede, indiceRodovia, &rodovia);
+    somarTrechoPaginado(rede, &rodovia, inicio, fim, &pedagio, &distancia);
+    lerRegistroCidade(rede, &rodovia, inicio, &origem);
+    lerRegistroCidade(rede, &rodovia, fim, &destino);
+
+    saidaTexto(saida, "TRECHO\t");
+    saidaTexto(saida, rodovia.nome);
+    saidaTexto(saida, "\t");
+    saidaTexto(saida, origem.nome);
+    saidaTexto(saida, "\t");
+    saidaTexto(saida, destino.nome);
+    saidaTexto(saida, "\t");
+    saidaMetros(saida, distancia);
+    saidaTexto(saida, "\t");
+    saidaCentavos(saida, pedagio);
+    saidaTexto(saida, "\n");
+}
+
+static Metros distanciaEntre(Metros a, Metros b)
+{
+    return a < b ? b - a : a - b;
+}
+
+static void consultarRotaPaginada(BufferSaida *saida, RedePaginada *rede, char nomeOrigem[], char nomeDestino[])
+{
+    OcorrenciaCidade origens[MAXIMO_OCORRENCIAS_CIDADE], destinos[MAXIMO_OCORRENCIAS_CIDADE];
+    OcorrenciaCidade conexoes[MAXIMO_OCORRENCIAS_CIDADE];
+    int quantidadeOrigens = localizarCidadePaginada(rede, nomeOrigem, origens, MAXIMO_OCORRENCIAS_CIDADE);
+    int quantidadeDestinos = localizarCidadePaginada(rede, nomeDestino, destinos, MAXIMO_OCORRENCIAS_CIDADE);
+    if (quantidadeOrigens == 0 || quantidadeDestinos == 0)
+    {
+        saidaTexto(saida, "ERRO\tcidade de início ou fim não encontrada\n");
+        return;
+    }
+
+    Metros melhor = -1;
+    OcorrenciaCidade inicio, saidaRodovia, entrada, fim;
+    memset(&inicio, 0, sizeof(inicio));
+    memset(&saidaRodovia, 0, sizeof(saidaRodovia));
+    memset(&entrada, 0, sizeof(entrada));
+    memset(&fim, 0, sizeof(fim));
+    for (int o = 0; o < quantidadeOrigens; o++)
+    {
+        for (int d = 0; d < quantidadeDestinos; d++)
+        {
+            Metros distancia = distanciaEntre(origens[o].distancia, destinos[d].distancia);
+            if (origens[o].rodovia == destinos[d].rodovia && (melhor < 0 || distancia < melhor))
+            {
+                melhor = distancia;
+                inicio = origens[o];
+                fim = destinos[d];
+            }
+        }
+    }
+
+    int direta = melhor >= 0;
+    for (int o = 0; !direta && o < quantidadeOrigens; o++)
+    {
+        RegistroRodovia rodovia;
+        lerRegistroRodovia(rede, origens[o].rodovia, &rodovia);
+        for (uint32_t p = 0; p < rodovia.numeroCidades; p++)
+        {
+            RegistroCidade cidade;
+            lerRegistroCidade(rede, &rodovia, p, &cidade);
+            int quantidadeConexoes = localizarCidadePaginada(rede, cidade.nome, conexoes, MAXIMO_OCORRENCIAS_CIDADE);
+
+            for (int c = 0; c < quantidadeConexoes; c++)
+            {
+                for (int d = 0; d < quantidadeDestinos; d++)
+                {
+                    if (conexoes[c].rodovia != destinos[d].rodovia || conexoes[c].rodovia == origens[o].rodovia)
+                    {
+                        continue;
+                    }
+                    Metros distancia = distanciaEntre(origens[o].distancia, cidade.distancia) +
+                                      distanciaEntre(conexoes[c].distancia, destinos[d].distancia);
+                    if (melhor < 0 || distancia < melhor)
+                    {
+                        melhor = distancia;
+                        inicio = origens[o];
+                        saidaRodovia.rodovia = origens[o].rodovia;
+                        saidaRodovia.posicao = p;
+                        entrada = conexoes[c];
+                        fim = destinos[d];
+                    }
+                }
+            }
+        }
+    }
+
+    if (melhor < 0)
+    {
+        saidaTexto(saida, "ERRO\tnenhuma rota direta entre as cidades\n");
+        return;
+    }
+
+    Centavos pedagio1, pedagio2 = 0;
+    Metros distancia1, distancia2 = 0;
+    RegistroRodovia rodovia;
+    lerRegistroRodovia(rede, inicio.rodovia, &rodovia);
+    somarTrechoPaginado(rede, &rodovia, inicio.posicao, direta ? fim.posicao : saidaRodovia.posicao, &pedagio1, &distancia1);
+
+    saidaTexto(saida, direta ? "OK\t2\n" : "OK\t3\n");
+    responderTrechoPaginado(saida, rede, inicio.rodovia, inicio.posicao, direta ? fim.posicao : saidaRodovia.posicao);
+    if (!direta)
+    {
+        lerRegistroRodovia(rede, fim.rodovia, &rodovia);
+        somarTrechoPaginado(rede, &rodovia, entrada.posicao, fim.posicao, &pedagio2, &distancia2);
+        responderTrechoPaginado(saida, rede, fim.rodovia, entrada.posicao, fim.posicao);
+    }
+
+    saidaTexto(saida, "TOTAL\t");
+    saidaMetros(saida, distancia1 + distancia2);
+    saidaTexto(saida, "\t");
+    saidaCentavos(saida, pedagio1 + pedagio2);
+    saidaTexto(saida, "\n");
+}
+
+static void consultarCidadePaginada(BufferSaida *saida, RedePaginada *rede, char nomeCidade[])
+{
+    OcorrenciaCidade ocorrencias[MAXIMO_OCORRENCIAS_CIDADE];
+    int quantidade = localizarCidadePaginada(rede, nomeCidade, ocorrencias, MAXIMO_OCORRENCIAS_CIDADE);
+    if (quantidade == 0)
+    {
+        saidaTexto(saida, "ERRO\tcidade não encontrada\n");
+        return;
+    }
+
+    saidaTexto(saida, "OK\t");
+    saidaInteiro(saida, quantidade);
+    saidaTexto(saida, "\n");
+    for (int i = 0; i < quantidade; i++)
+    {
+        RegistroRodovia rodovia;
+        RegistroCidade cidade;
+        lerRegistroRodovia(rede, ocorrencias[i].rodovia, &rodovia);
+        lerRegistroCidade(rede, &rodovia, ocorrencias[i].posicao, &cidade);
+        saidaTexto(saida, rodovia.nome);
+        saidaTexto(saida, "\t");
+        saidaTexto(saida, cidade.nome);
+        saidaTexto(saida, "\t");
+        saidaMetros(saida, cidade.distancia);
+        saidaTexto(saida, "\n");
+    }
+}
+
+static int posicaoNaRodovia(RedePaginada *rede, int indiceRodovia, char nomeCidade[])
+{
+    OcorrenciaCidade ocorrencias[MAXIMO_OCORRENCIAS_CIDADE];
+    int quantidade = localizarCidadePaginada(rede, nomeCidade, ocorrencias, MAXIMO_OCORRENCIAS_CIDADE);
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (ocorrencias[i].rodovia == (uint32_t)indiceRodovia)
+        {
+            return (int)ocorrencias[i].posicao;
+        }
+    }
+    return -1;
+}
+
+static void consultarPedagioPaginado(BufferSaida *saida, RedePaginada *rede, char *campos[], int quantidadeCampos)
+{
+    RegistroRodovia rodovia;
+    int indice = buscarRodoviaPaginada(rede, campos[1], &rodovia);
+    if (indice < 0)
+    {
+        saidaTexto(saida, "ERRO\trodovia não encontrada\n");
+        return;
+    }
+
+    if (quantidadeCampos == 2)
+    {
+        saidaTexto(saida, "OK\t1\n");
+        saidaTexto(saida, rodovia.nome);
+        saidaTexto(saida, "\t");
+        saidaInteiro(saida, rodovia.numeroCidades);
+        saidaTexto(saida, "\t");
+        saidaCentavos(saida, rodovia.pedagioTotal);
+        saidaTexto(saida, "\n");
+        return;
+    }
+
+    int inicio = quantidadeCampos == 4 ? posicaoNaRodovia(rede, indice, campos[2]) : -1;
+    int fim = quantidadeCampos == 4 ? posicaoNaRodovia(rede, indice, campos[3]) : -1;
+    if (inicio < 0 || fim < 0)
+    {
+        saidaTexto(saida, "ERRO\tuma ou ambas as cidades não foram encontradas na rodovia\n");
+        return;
+    }
+    saidaTexto(saida, "OK\t1\n");
+    responderTrechoPaginado(saida, rede, indice, inicio, fim);
+}
+
+static void responderEstatisticas(BufferSaida *saida, CachePaginas *cache)
+{
+    long acessos = cache->acertos + cache->faltas;
+    saidaTexto(saida, "OK\t1\n");
+    saidaInteiro(saida, cache->quantidadeQuadros);
+    saidaTexto(saida, "\t");
+    saidaInteiro(saida, cache->acertos);
+    saidaTexto(saida, "\t");
+    saidaInteiro(saida, cache->faltas);
+    saidaTexto(saida, "\t");
+    saidaDecimal(saida, acessos > 0 ? 100.0f * cache->acertos / acessos : 0);
+    saidaTexto(saida, "\n");
+}
+
+int executarConsultasPaginadas(char arquivoPaginas[], int quantidadeQuadros)
+{
+    RedePaginada rede;
+    if (!abrirRedePaginada(&rede, arquivoPaginas, quantidadeQuadros))
+    {
+        return 1;
+    }
+
+    BufferSaida saida;
+    if (!iniciarBufferSaida(&saida, STDOUT_FILENO))
+    {
+        printf("Erro de alocação de memória!\n");
+        fecharRedePaginada(&rede);
+        return 1;
+    }
+
+    char linha[TAMANHO_ENTRADA_SERVIDOR];
+    while (fgets(linha, sizeof(linha), stdin))
+    {
+        char *campos[4];
+        int quantidade = 0;
+        linha[strcspn(linha, "\r\n")] = '\0';
+        for (char *campo = strtok(linha, "\t"); campo != NULL && quantidade < 4; campo = strtok(NULL, "\t"))
+        {
+            campos[quantidade++] = campo;
+        }
+
+        if (quantidade == 0)
+        {
+            continue;
+        }
+        else if (strcmp(campos[0], "ROTA") == 0 && quantidade == 3)
+        {
+            consultarRotaPaginada(&saida, &rede, campos[1], campos[2]);
+        }
+        else if (strcmp(campos[0], "CIDADE") == 0 && quantidade == 2)
+        {
+            consultarCidadePaginada(&saida, &rede, campos[1]);
+        }
+        else if (strcmp(campos[0], "PEDAGIO") == 0 && quantidade >= 2)
+        {
+            consultarPedagioPaginado(&saida, &rede, campos, quantidade);
+        }
+        else if (strcmp(campos[0], "ESTATISTICAS") == 0)
+        {
+            responderEstatisticas(&saida, &rede.cache);
+        }
+        else
+        {
+            saidaTexto(&saida, "ERRO\tcomando inválido\n");
+        }
+        descarregarSaida(&saida);
+    }
+
+    finalizarBufferSaida(&saida);
+    fecharRedePaginada(&rede);
+    return 0;
+}
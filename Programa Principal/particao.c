@@ -0,0 +1,388 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "estruturas.h"
+
+typedef struct Particao
+{
+    Grafo *grafo;
+    Rodovia **rodovias;
+    int quantidadeRodovias;
+    int *primeiraCidade;
+    int *verticesCidades;
+    int *primeiraRodovia;
+    int *rodoviasVertices;
+    int *regioes;
+    int *fila;
+    unsigned int *marcas;
+    unsigned int geracao;
+} Particao;
+
+static void liberarParticao(Particao *particao)
+{
+    liberarGrafo(particao->grafo);
+    free(particao->rodovias);
+    free(particao->primeiraCidade);
+    free(particao->verticesCidades);
+    free(particao->primeiraRodovia);
+    free(particao->rodoviasVertices);
+    free(particao->regioes);
+    free(particao->fila);
+    free(particao->marcas);
+}
+
+static int prepararParticao(Particao *particao, Rodovia *lista)
+{
+    memset(particao, 0, sizeof(Particao));
+    int totalCidades = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima)
+    {
+        particao->quantidadeRodovias++;
+        totalCidades += r->numeroCidades;
+    }
+
+    int n = particao->quantidadeRodovias;
+    particao->grafo = construirGrafo(lista);
+    particao->rodovias = malloc(sizeof(Rodovia *) * (n + 1));
+    particao->primeiraCidade = malloc(sizeof(int) * (n + 1));
+    particao->verticesCidades = malloc(sizeof(int) * (totalCidades + 1));
+    particao->regioes = malloc(sizeof(int) * (n + 1));
+    particao->fila = malloc(sizeof(int) * (n + 1));
+    particao->marcas = calloc(n + 1, sizeof(unsigned int));
+    if (particao->grafo == NULL || particao->rodovias == NULL || particao->primeiraCidade == NULL ||
+        particao->verticesCidades == NULL || particao->regioes == NULL || particao->fila == NULL ||
+        particao->marcas == NULL)
+    {
+        return 0;
+    }
+
+    int vertices = particao->grafo->quantidadeVertices;
+    particao->primeiraRodovia = calloc(vertices + 2, sizeof(int));
+    particao->rodoviasVertices = malloc(sizeof(int) * (totalCidades + 1));
+    if (particao->primeiraRodovia == NULL || particao->rodoviasVertices == NULL)
+    {
+        return 0;
+    }
+
+    int i = 0, posicao = 0;
+    for (Rodovia *r = lista; r != NULL; r = r->proxima, i++)
+    {
+        particao->rodovias[i] = r;
+        particao->regioes[i] = -1;
+        particao->primeiraCidade[i] = posicao;
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima)
+        {
+            int vertice = buscarVertice(particao->grafo, c->nomeCidade);
+            particao->verticesCidades[posicao++] = vertice;
+            particao->primeiraRodovia[vertice + 1]++;
+        }
+    }
+    particao->primeiraCidade[n] = posicao;
+
+    for (int v = 0; v < vertices; v++)
+    {
+        particao->primeiraRodovia[v + 1] += particao->primeiraRodovia[v];
+    }
+    int *proximaLivre = malloc(sizeof(int) * (vertices + 1));
+    if (proximaLivre == NULL)
+    {
+        return 0;
+    }
+    memcpy(proximaLivre, particao->primeiraRodovia, sizeof(int) * (vertices + 1));
+    for (int r = 0; r < n; r++)
+    {
+        for (int c = particao->primeiraCidade[r]; c < particao->primeiraCidade[r + 1]; c++)
+        {
+            particao->rodoviasVertices[proximaLivre[particao->verticesCidades[c]]++] = r;
+        }
+    }
+    free(proximaLivre);
+    return 1;
+}
+
+static int pesoRodovia(Particao *particao, int r)
+{
+    int cidades = particao->primeiraCidade[r + 1] - particao->primeiraCidade[r];
+    return cidades > 0 ? cidades : 1;
+}
+
+static int percorrerVizinhas(Particao *particao, int origem, int regiao, int *peso, int alvo)
+{
+    if (++particao->geracao == 0)
+    {
+        memset(particao->marcas, 0, sizeof(unsigned int) * (particao->quantidadeRodovias + 1));
+        particao->geracao = 1;
+    }
+
+    int inicio = 0, fim = 0, ultima = origem;
+    particao->fila[fim++] = origem;
+    particao->marcas[origem] = particao->geracao;
+    while (inicio < fim && (peso == NULL || *peso < alvo))
+    {
+        int r = particao->fila[inicio++];
+        ultima = r;
+        if (peso != NULL)
+        {
+            particao->regioes[r] = regiao;
+            *peso += pesoRodovia(particao, r);
+        }
+        for (int c = particao->primeiraCidade[r]; c < particao->primeiraCidade[r + 1]; c++)
+        {
+            int v = particao->verticesCidades[c];
+            for (int k = particao->primeiraRodovia[v]; k < particao->primeiraRodovia[v + 1]; k++)
+            {
+                int vizinha = particao->rodoviasVertices[k];
+                if (particao->regioes[vizinha] < 0 && particao->marcas[vizinha] != particao->geracao)
+                {
+                    particao->marcas[vizinha] = particao->geracao;
+                    particao->fila[fim++] = vizinha;
+                }
+            }
+        }
+    }
+    return ultima;
+}
+
+static void dividirRegioes(Particao *particao, int quantidadeRegioes)
+{
+    int restante = 0;
+    for (int r = 0; r < particao->quantidadeRodovias; r++)
+    {
+        restante += pesoRodovia(particao, r);
+    }
+
+    int proxima = 0;
+    for (int regiao = 0; regiao < quantidadeRegioes; regiao++)
+    {
+        int alvo = regiao == quantidadeRegioes - 1 ? restante : (restante + quantidadeRegioes - regiao - 1) /
+                                                                   (quantidadeRegioes - regiao);
+        int peso = 0;
+        while (peso < alvo)
+        {
+            while (proxima < particao->quantidadeRodovias && particao->regioes[proxima] >= 0)
+            {
+                proxima++;
+            }
+            if (proxima == particao->quantidadeRodovias)
+            {
+                break;
+            }
+            int semente = percorrerVizinhas(particao, proxima, regiao, NULL, 0);
+            percorrerVizinhas(particao, semente, regiao, &peso, alvo);
+        }
+        restante -= peso;
+    }
+}
+
+static int regioesDoVertice(Particao *particao, int v, int regioes[], int maximo)
+{
+    int quantidade = 0;
+    for (int k = particao->primeiraRodovia[v]; k < particao->primeiraRodovia[v + 1]; k++)
+    {
+        int regiao = particao->regioes[particao->rodoviasVertices[k]];
+        int repetida = 0;
+        for (int i = 0; i < quantidade && !repetida; i++)
+        {
+            repetida = regioes[i] == regiao;
+        }
+        if (!repetida && quantidade < maximo)
+        {
+            regioes[quantidade++] = regiao;
+        }
+    }
+    return quantidade;
+}
+
+static int gravarFragmento(Particao *particao, char caminho[], int regiao, int *rodovias, int *cidades,
+                           int *fronteiras)
+{
+    *rodovias = *cidades = *fronteiras = 0;
+    int descritor = open(caminho, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0)
+    {
+        return 0;
+    }
+
+    BufferSaida saida;
+    iniciarBufferSaida(&saida, descritor);
+    for (int r = 0; r < particao->quantidadeRodovias; r++)
+    {
+        if (particao->regioes[r] == regiao)
+        {
+            escreverRodovia(&saida, particao->rodovias[r], 1);
+            (*rodovias)++;
+            *cidades += particao->rodovias[r]->numeroCidades;
+        }
+    }
+
+    int regioes[64];
+    for (int v = 0; v < particao->grafo->quantidadeVertices; v++)
+    {
+        int quantidade = regioesDoVertice(particao, v, regioes, 64);
+        int presente = 0;
+        for (int i = 0; i < quantidade; i++)
+        {
+            presente |= regioes[i] == regiao;
+        }
+        if (quantidade < 2 || !presente)
+        {
+            continue;
+        }
+
+        saidaTexto(&saida, "Fronteira: ");
+        saidaTexto(&saida, particao->grafo->nomes[v]);
+        saidaTexto(&saida, ", Regiões:");
+        for (int i = 0; i < quantidade; i++)
+        {
+            saidaTexto(&saida, " ");
+            saidaInteiro(&saida, regioes[i]);
+        }
+        saidaTexto(&saida, "\n");
+        (*fronteiras)++;
+    }
+
+    int sucesso = finalizarBufferSaida(&saida) == 0;
+    return close(descritor) == 0 && sucesso;
+}
+
+int lerFronteiras(char nomeArquivo[], char (**nomes)[50])
+{
+    FILE *arquivo = fopen(nomeArquivo, "r");
+    if (arquivo == NULL)
+    {
+        return -1;
+    }
+
+    char linha[256];
+    int quantidade = 0, capacidade = 0;
+    *nomes = NULL;
+    while (fgets(linha, sizeof(linha), arquivo))
+    {
+        char nome[50];
+        if (sscanf(linha, "Fronteira: %49[^,\n]", nome) != 1)
+        {
+            continue;
+        }
+        if (quantidade == capacidade)
+        {
+            capacidade = capacidade > 0 ? capacidade * 2 : 64;
+            char (*maiores)[50] = realloc(*nomes, sizeof(char[50]) * capacidade);
+            if (maiores == NULL)
+            {
+                free(*nomes);
+                *nomes = NULL;
+                fclose(arquivo);
+                return -1;
+            }
+            *nomes = maiores;
+        }
+        strcpy((*nomes)[quantidade++], nome);
+    }
+    fclose(arquivo);
+    return quantidade;
+}
+
+int lerManifestoRegioes(char nomeArquivo[], char (**fragmentos)[256])
+{
+    FILE *arquivo = fopen(nomeArquivo, "r");
+    if (arquivo == NULL)
+    {
+        return -1;
+    }
+
+    char linha[512];
+    int quantidade = 0, esperadas = 0;
+    *fragmentos = NULL;
+    while (fgets(linha, sizeof(linha), arquivo))
+    {
+        if (sscanf(linha, "Regiões: %d", &esperadas) == 1)
+        {
+            if (esperadas <= 0 || esperadas > MAXIMO_REGIOES || *fragmentos != NULL ||
+                (*fragmentos = calloc(esperadas, sizeof(char[256]))) == NULL)
+            {
+                break;
+            }
+        }
+        else if (*fragmentos != NULL && quantidade < esperadas &&
+                 sscanf(linha, "Fragmento: %255[^,\n]", (*fragmentos)[quantidade]) == 1)
+        {
+            quantidade++;
+        }
+    }
+    fclose(arquivo);
+
+    if (quantidade == 0 || quantidade != esperadas)
+    {
+        free(*fragmentos);
+        *fragmentos = NULL;
+        return -1;
+    }
+    return quantidade;
+}
+
+int executarParticionamento(char nomeArquivo[], char prefixo[], int quantidadeRegioes)
+{
+    if (quantidadeRegioes < 1 || quantidadeRegioes > MAXIMO_REGIOES || strlen(prefixo) > 200)
+    {
+        printf("Erro: quantidade de regiões deve estar entre 1 e %d.\n", MAXIMO_REGIOES);
+        return 1;
+    }
+
+    Rodovia *lista = NULL;
+    if (carregarRodoviasDeArquivo(&lista, nomeArquivo) != RODOVIAS_OK)
+    {
+        printf("Erro ao abrir o arquivo %s para leitura!\n", nomeArquivo);
+        return 1;
+    }
+    long ignorados;
+    lerDiario(nomeArquivo, &lista, &ignorados);
+
+    Particao particao;
+    if (!prepararParticao(&particao, lista))
+    {
+        printf("Erro de alocação de memória!\n");
+        liberarParticao(&particao);
+        liberarMemoria(lista);
+        return 1;
+    }
+    dividirRegioes(&particao, quantidadeRegioes);
+
+    char manifesto[256];
+    snprintf(manifesto, sizeof(manifesto), "%s.regioes", prefixo);
+    FILE *arquivo = fopen(manifesto, "w");
+    int sucesso = arquivo != NULL;
+    if (arquivo != NULL)
+    {
+        fprintf(arquivo, "Regiões: %d\n", quantidadeRegioes);
+    }
+
+    for (int regiao = 0; regiao < quantidadeRegioes && sucesso; regiao++)
+    {
+        char caminho[256];
+        int rodovias, cidades, fronteiras;
+        snprintf(caminho, sizeof(caminho), "%s.%d.txt", prefixo, regiao);
+        sucesso = gravarFragmento(&particao, caminho, regiao, &rodovias, &cidades, &fronteiras);
+        fprintf(arquivo, "Fragmento: %s, Rodovias: %d, Cidades: %d, Fronteiras: %d\n", caminho, rodovias, cidades,
+                fronteiras);
+        printf("Região %d: %d rodovias, %d cidades, %d cidades de fronteira em '%s'\n", regiao, rodovias, cidades,
+               fronteiras, caminho);
+    }
+    if (arquivo != NULL && fclose(arquivo) != 0)
+    {
+        sucesso = 0;
+    }
+
+    if (sucesso)
+    {
+        printf("Manifesto das regiões gravado em '%s'.\n", manifesto);
+    }
+    else
+    {
+        printf("Erro ao gravar os fragmentos de '%s'!\n", prefixo);
+    }
+    liberarParticao(&particao);
+    liberarMemoria(lista);
+    return sucesso ? 0 : 1;
+}
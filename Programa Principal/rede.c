@@ -0,0 +1,1940 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include "estruturas.h"
+
+static int copiarNome(char destino[], const char *nome)
+{
+    if (nome == NULL || strlen(nome) >= 50)
+    {
+        return 0;
+    }
+    strcpy(destino, nome);
+    return 1;
+}
+
+static int registrando(RedeRodovias *rede)
+{
+    return rede->diario.descritor >= 0 || rede->diario.alimentacao >= 0;
+}
+
+static int registrar(RedeRodovias *rede, int tipo, char rodovia[], char cidade1[], char cidade2[], int64_t valor)
+{
+    if (!registrando(rede))
+    {
+        return RODOVIAS_OK;
+    }
+    return registrarAlteracao(&rede->diario, tipo, rodovia, cidade1, cidade2, valor) ? RODOVIAS_OK
+                                                                                      : RODOVIAS_ERRO_ARQUIVO;
+}
+
+static int prepararAdjacencias(RedeRodovias *rede)
+{
+    int status = RODOVIAS_OK;
+    pthread_mutex_lock(&rede->travaDerivados);
+    if (rede->versaoAdjacencias != rede->versao)
+    {
+        status = conectarRodovias(rede->lista);
+        if (status == RODOVIAS_OK)
+        {
+            rede->versaoAdjacencias = rede->versao;
+        }
+    }
+    pthread_mutex_unlock(&rede->travaDerivados);
+    return status;
+}
+
+static int marcarInterdicao(Rodovia *lista, Grafo *grafo, InfoInterdicao *interdicao, uint64_t marcados[])
+{
+    Rodovia *r = buscarRodovia(lista, interdicao->rodovia);
+    if (r == NULL)
+    {
+        return RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    Cidade *c1 = buscarCidade(r, interdicao->cidade1);
+    Cidade *c2 = buscarCidade(r, interdicao->cidade2);
+    if (c1 == NULL || c2 == NULL)
+    {
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    if (c1 == c2)
+    {
+        return RODOVIAS_CIDADES_IGUAIS;
+    }
+
+    int base = primeiroSegmento(grafo, r);
+    if (base >= 0)
+    {
+        int inicio = c1->indice < c2->indice ? c1->indice : c2->indice;
+        marcarSegmentos(marcados, base + inicio, base + c1->indice + c2->indice - inicio);
+    }
+    return RODOVIAS_OK;
+}
+
+static void aplicarInterdicoes(RedeRodovias *rede, Grafo *grafo)
+{
+    memcpy(grafo->interditados, grafo->removidos, sizeof(uint64_t) * (grafo->quantidadeSegmentos / 64 + 1));
+    for (int i = 0; i < rede->quantidadeInterdicoes; i++)
+    {
+        marcarInterdicao(rede->lista, grafo, &rede->interdicoes[i], grafo->interditados);
+    }
+}
+
+static void reaplicarInterdicoes(RedeRodovias *rede, Grafo *grafo)
+{
+    int palavras = grafo->quantidadeSegmentos / 64 + 1;
+    uint64_t *anteriores = malloc(sizeof(uint64_t) * palavras);
+    rede->versaoPesos++;
+    if (anteriores == NULL)
+    {
+        rede->versaoMelhoria = rede->versaoPesos;
+        aplicarInterdicoes(rede, grafo);
+        return;
+    }
+    memcpy(anteriores, grafo->interditados, sizeof(uint64_t) * palavras);
+    aplicarInterdicoes(rede, grafo);
+
+    for (int p = 0; p < palavras; p++)
+    {
+        if (anteriores[p] & ~grafo->interditados[p])
+        {
+            rede->versaoMelhoria = rede->versaoPesos;
+        }
+        for (uint64_t novos = grafo->interditados[p] & ~anteriores[p]; novos != 0; novos &= novos - 1)
+        {
+            grafo->versoesSegmentos[p * 64 + __builtin_ctzll(novos)] = rede->versaoPesos;
+        }
+    }
+    free(anteriores);
+}
+
+static Grafo *prepararGrafo(RedeRodovias *rede)
+{
+    pthread_mutex_lock(&rede->travaDerivados);
+    if (rede->grafo == NULL || rede->versaoGrafo != rede->versao)
+    {
+        liberarGrafo(rede->grafo);
+        rede->grafo = construirGrafo(rede->lista);
+        rede->versaoGrafo = rede->versao;
+        if (rede->grafo != NULL)
+        {
+            aplicarInterdicoes(rede, rede->grafo);
+        }
+    }
+    Grafo *grafo = rede->grafo;
+    pthread_mutex_unlock(&rede->travaDerivados);
+    return grafo;
+}
+
+static void ajustarPesosGrafo(RedeRodovias *rede, Grafo *grafo, Rodovia *rodovia, Cidade *inicio)
+{
+    int base = primeiroSegmento(grafo, rodovia);
+    if (base >= 0)
+    {
+        int segmento = base + inicio->indice;
+        int ida = grafo->arestasSegmentos[segmento], volta = grafo->gemeas[ida];
+        Metros distancia = inicio->proxima->distancia - inicio->distancia;
+        Centavos pedagioIda = pedagioTrecho(rodovia, inicio->indice, 1);
+        Centavos pedagioVolta = pedagioTrecho(rodovia, inicio->indice, -1);
+
+        rede->versaoPesos++;
+        if (distancia < grafo->distancias[ida] || pedagioIda < grafo->pedagios[ida] ||
+            pedagioVolta < grafo->pedagios[volta])
+        {
+            rede->versaoMelhoria = rede->versaoPesos;
+        }
+        grafo->distancias[ida] = distancia;
+        grafo->distancias[volta] = distancia;
+        grafo->pedagios[ida] = pedagioIda;
+        grafo->pedagios[volta] = pedagioVolta;
+        grafo->versoesSegmentos[segmento] = rede->versaoPesos;
+    }
+}
+
+static void atualizarPesosGrafo(RedeRodovias *rede, Rodovia *rodovia, Cidade *inicio)
+{
+    pthread_mutex_lock(&rede->travaDerivados);
+    if (rede->grafo != NULL && rede->versaoGrafo == rede->versao)
+    {
+        ajustarPesosGrafo(rede, rede->grafo, rodovia, inicio);
+    }
+    pthread_mutex_unlock(&rede->travaDerivados);
+}
+
+static IndiceEspacial *prepararEspacial(RedeRodovias *rede)
+{
+    pthread_mutex_lock(&rede->travaDerivados);
+    if (rede->espacial == NULL || rede->versaoEspacial != rede->versao)
+    {
+        liberarIndiceEspacial(rede->espacial);
+        rede->espacial = construirIndiceEspacial(rede->lista);
+        rede->versaoEspacial = rede->versao;
+    }
+    IndiceEspacial *espacial = rede->espacial;
+    pthread_mutex_unlock(&rede->travaDerivados);
+    return espacial;
+}
+
+static void indexarNome(RedeRodovias *rede, IndiceNomes *indice, char nome[])
+{
+    if (!inserirNomeIndice(indice, nome))
+    {
+        rede->indicesDesatualizados = 1;
+    }
+}
+
+static int montarIndices(Rodovia *lista, IndiceNomes *rodovias, IndiceNomes *cidades)
+{
+    int sucesso = iniciarIndiceNomes(rodovias) & iniciarIndiceNomes(cidades);
+    for (Rodovia *r = lista; r != NULL && sucesso; r = r->proxima)
+    {
+        sucesso = inserirNomeIndice(rodovias, r->nome);
+        for (Cidade *c = r->cidades; c != NULL && sucesso; c = c->proxima)
+        {
+            sucesso = inserirNomeIndice(cidades, c->nomeCidade);
+        }
+    }
+    return sucesso;
+}
+
+static void reconstruirIndices(RedeRodovias *rede)
+{
+    liberarIndiceNomes(&rede->indiceRodovias);
+    liberarIndiceNomes(&rede->indiceCidades);
+    rede->indicesDesatualizados = !montarIndices(rede->lista, &rede->indiceRodovias, &rede->indiceCidades);
+}
+
+static int prepararIndices(RedeRodovias *rede)
+{
+    pthread_mutex_lock(&rede->travaDerivados);
+    if (rede->indicesDesatualizados)
+    {
+        reconstruirIndices(rede);
+    }
+    int status = rede->indicesDesatualizados ? RODOVIAS_ERRO_MEMORIA : RODOVIAS_OK;
+    pthread_mutex_unlock(&rede->travaDerivados);
+    return status;
+}
+
+typedef struct CompactacaoRede
+{
+    unsigned long versao;
+    unsigned long versaoPesos;
+    int comGrafo;
+    int comAdjacencias;
+    int quantidadeRodovias;
+    Grafo *grafo;
+    Grafo *grafoAnterior;
+    RodoviaAdjacente **adjacentes;
+    IndiceNomes indiceRodovias;
+    IndiceNomes indiceCidades;
+    Rodovia *removidas;
+} CompactacaoRede;
+
+static int montarCompactacao(RedeRodovias *rede, CompactacaoRede *compactacao)
+{
+    memset(compactacao, 0, sizeof(CompactacaoRede));
+    pthread_mutex_lock(&rede->travaDerivados);
+    compactacao->versao = rede->versao;
+    compactacao->versaoPesos = rede->versaoPesos;
+    compactacao->comGrafo = rede->grafo != NULL && rede->versaoGrafo == rede->versao;
+    compactacao->comAdjacencias = rede->versaoAdjacencias == rede->versao;
+    pthread_mutex_unlock(&rede->travaDerivados);
+
+    for (Rodovia *r = rede->lista; r != NULL; r = r->proxima)
+    {
+        compactacao->quantidadeRodovias++;
+    }
+    if (!montarIndices(rede->lista, &compactacao->indiceRodovias, &compactacao->indiceCidades))
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+    if (compactacao->comGrafo && (compactacao->grafo = construirGrafo(rede->lista)) == NULL)
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+    if (compactacao->comAdjacencias)
+    {
+        compactacao->adjacentes = malloc(sizeof(RodoviaAdjacente *) * (compactacao->quantidadeRodovias + 1));
+        if (compactacao->adjacentes == NULL)
+        {
+            return RODOVIAS_ERRO_MEMORIA;
+        }
+        if (montarAdjacencias(rede->lista, compactacao->adjacentes) != RODOVIAS_OK)
+        {
+            compactacao->quantidadeRodovias = 0;
+            return RODOVIAS_ERRO_MEMORIA;
+        }
+    }
+    return RODOVIAS_OK;
+}
+
+static void instalarCompactacao(RedeRodovias *rede, CompactacaoRede *compactacao)
+{
+    int espacialAtual = rede->espacial != NULL && rede->versaoEspacial == rede->versao;
+    rede->versao++;
+
+    compactacao->grafoAnterior = rede->grafo;
+    rede->grafo = NULL;
+    if (compactacao->versaoPesos == rede->versaoPesos)
+    {
+        rede->grafo = compactacao->grafo;
+        compactacao->grafo = NULL;
+    }
+    if (rede->grafo != NULL)
+    {
+        aplicarInterdicoes(rede, rede->grafo);
+        rede->versaoGrafo = rede->versao;
+    }
+    if (compactacao->comAdjacencias)
+    {
+        trocarAdjacencias(rede->lista, compactacao->adjacentes);
+        rede->versaoAdjacencias = rede->versao;
+    }
+    if (espacialAtual)
+    {
+        rede->versaoEspacial = rede->versao;
+    }
+
+    IndiceNomes indiceRodovias = rede->indiceRodovias, indiceCidades = rede->indiceCidades;
+    rede->indiceRodovias = compactacao->indiceRodovias;
+    rede->indiceCidades = compactacao->indiceCidades;
+    rede->indicesDesatualizados = 0;
+    compactacao->indiceRodovias = indiceRodovias;
+    compactacao->indiceCidades = indiceCidades;
+
+    compactacao->removidas = rede->removidas;
+    rede->removidas = NULL;
+    rede->lapides = 0;
+    rede->compactacoes++;
+}
+
+static void liberarCompactacao(CompactacaoRede *compactacao)
+{
+    liberarGrafo(compactacao->grafo);
+    liberarGrafo(compactacao->grafoAnterior);
+    if (compactacao->adjacentes != NULL)
+    {
+        liberarListasAdjacentes(compactacao->adjacentes, compactacao->quantidadeRodovias);
+        free(compactacao->adjacentes);
+    }
+    liberarIndiceNomes(&compactacao->indiceRodovias);
+    liberarIndiceNomes(&compactacao->indiceCidades);
+    liberarMemoria(compactacao->removidas);
+}
+
+static int compactar(RedeRodovias *rede, int bloquear)
+{
+    for (int tentativa = 0; tentativa <= TENTATIVAS_COMPACTACAO; tentativa++)
+    {
+        int exclusiva = tentativa == TENTATIVAS_COMPACTACAO;
+        if (exclusiva && !bloquear)
+        {
+            break;
+        }
+        if (exclusiva)
+        {
+            pthread_rwlock_wrlock(&rede->trava);
+        }
+        else
+        {
+            pthread_rwlock_rdlock(&rede->trava);
+        }
+        if (rede->removidas == NULL && rede->lapides == 0)
+        {
+            pthread_rwlock_unlock(&rede->trava);
+            return RODOVIAS_OK;
+        }
+
+        CompactacaoRede compactacao;
+        int status = montarCompactacao(rede, &compactacao);
+        if (!exclusiva)
+        {
+            pthread_rwlock_unlock(&rede->trava);
+            pthread_rwlock_wrlock(&rede->trava);
+        }
+        int atual = rede->versao == compactacao.versao;
+        if (atual && status == RODOVIAS_OK)
+        {
+            instalarCompactacao(rede, &compactacao);
+        }
+        pthread_rwlock_unlock(&rede->trava);
+        liberarCompactacao(&compactacao);
+        if (atual)
+        {
+            return status;
+        }
+    }
+    return RODOVIAS_OK;
+}
+
+static void *compactarEmSegundoPlano(void *argumento)
+{
+    RedeRodovias *rede = argumento;
+    pthread_mutex_lock(&rede->travaCompactacao);
+    while (!rede->encerrarCompactador)
+    {
+        if (!rede->compactacaoPendente)
+        {
+            pthread_cond_wait(&rede->sinalCompactacao, &rede->travaCompactacao);
+            continue;
+        }
+        rede->compactacaoPendente = 0;
+        pthread_mutex_unlock(&rede->travaCompactacao);
+        compactar(rede, 0);
+        pthread_mutex_lock(&rede->travaCompactacao);
+    }
+    pthread_mutex_unlock(&rede->travaCompactacao);
+    return NULL;
+}
+
+static void agendarCompactacao(RedeRodovias *rede)
+{
+    int segmentos = rede->grafo != NULL && rede->versaoGrafo == rede->versao ? rede->grafo->quantidadeSegmentos : 0;
+    if (rede->lapides < MINIMO_LAPIDES_COMPACTACAO || rede->lapides * PROPORCAO_LAPIDES < segmentos)
+    {
+        return;
+    }
+    pthread_mutex_lock(&rede->travaCompactacao);
+    if (!rede->compactadorIniciado)
+    {
+        rede->compactadorIniciado = pthread_create(&rede->compactador, NULL, compactarEmSegundoPlano, rede) == 0;
+    }
+    rede->compactacaoPendente = 1;
+    pthread_cond_signal(&rede->sinalCompactacao);
+    pthread_mutex_unlock(&rede->travaCompactacao);
+}
+
+static int presenteNoIndice(RedeRodovias *rede, char nomeCidade[])
+{
+    return !rede->indicesDesatualizados && buscarNomeIndice(&rede->indiceCidades, nomeCidade) != NULL;
+}
+
+static void sepultarRodovia(RedeRodovias *rede, Rodovia *rodovia)
+{
+    pthread_mutex_lock(&rede->travaDerivados);
+    int grafoAtual = rede->grafo != NULL && rede->versaoGrafo == rede->versao;
+    int adjacenciasAtuais = rede->versaoAdjacencias == rede->versao;
+    int espacialAtual = rede->espacial != NULL && rede->versaoEspacial == rede->versao;
+    for (Cidade *c = rodovia->cidades; c != NULL && espacialAtual; c = c->proxima)
+    {
+        espacialAtual = presenteNoIndice(rede, c->nomeCidade);
+    }
+
+    rede->versao++;
+    if (grafoAtual)
+    {
+        rede->lapides += removerRodoviaGrafo(rede->grafo, rodovia, ++rede->versaoPesos);
+        rede->versaoGrafo = rede->versao;
+    }
+    if (adjacenciasAtuais)
+    {
+        rede->versaoAdjacencias = rede->versao;
+    }
+    if (espacialAtual)
+    {
+        rede->versaoEspacial = rede->versao;
+    }
+    rodovia->proxima = rede->removidas;
+    rede->removidas = rodovia;
+    rede->lapides++;
+    pthread_mutex_unlock(&rede->travaDerivados);
+    agendarCompactacao(rede);
+}
+
+static int sepultarCidade(RedeRodovias *rede, Rodovia *rodovia, char nomeCidade[])
+{
+    Cidade *cidade = buscarCidade(rodovia, nomeCidade);
+    if (cidade == NULL)
+    {
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+
+    pthread_mutex_lock(&rede->travaDerivados);
+    Grafo *grafo = rede->grafo != NULL && rede->versaoGrafo == rede->versao ? rede->grafo : NULL;
+    int adjacenciasAtuais = rede->versaoAdjacencias == rede->versao;
+    int espacialAtual = rede->espacial != NULL && rede->versaoEspacial == rede->versao;
+    int vertice = grafo != NULL ? buscarVertice(grafo, cidade->nomeCidade) : -1;
+    int base = grafo != NULL ? primeiroSegmento(grafo, rodovia) : -1;
+    int indice = cidade->indice, cidades = rodovia->numeroCidades;
+    Cidade *anterior = cidade->proxima != NULL ? cidade->anterior : NULL;
+
+    int status = removerCidade(rodovia, nomeCidade);
+    if (status == RODOVIAS_OK)
+    {
+        removerNomeIndice(&rede->indiceCidades, nomeCidade);
+        rede->versao++;
+        if (grafo != NULL)
+        {
+            removerCidadeGrafo(grafo, vertice, base, indice, cidades, ++rede->versaoPesos);
+            rede->versaoGrafo = rede->versao;
+            if (anterior != NULL)
+            {
+                ajustarPesosGrafo(rede, grafo, rodovia, anterior);
+            }
+            if (rede->quantidadeInterdicoes > 0)
+            {
+                reaplicarInterdicoes(rede, grafo);
+            }
+            rede->lapides += cidades > 1;
+        }
+        if (adjacenciasAtuais)
+        {
+            rede->versaoAdjacencias = rede->versao;
+        }
+        if (espacialAtual && presenteNoIndice(rede, nomeCidade))
+        {
+            rede->versaoEspacial = rede->versao;
+        }
+    }
+    pthread_mutex_unlock(&rede->travaDerivados);
+    if (status == RODOVIAS_OK)
+    {
+        agendarCompactacao(rede);
+    }
+    return status;
+}
+
+RedeRodovias *criarRede(void)
+{
+    RedeRodovias *rede = calloc(1, sizeof(RedeRodovias));
+    if (rede == NULL)
+    {
+        return NULL;
+    }
+    rede->diario.descritor = -1;
+    rede->diario.alimentacao = -1;
+    rede->versao = 1;
+    pthread_rwlock_init(&rede->trava, NULL);
+    pthread_mutex_init(&rede->travaDerivados, NULL);
+    pthread_mutex_init(&rede->travaBusca, NULL);
+    pthread_mutex_init(&rede->cacheRotas.trava, NULL);
+    pthread_mutex_init(&rede->travaCompactacao, NULL);
+    pthread_cond_init(&rede->sinalCompactacao, NULL);
+    return rede;
+}
+
+int abrirRede(RedeRodovias *rede, const char *arquivo, InfoAbertura *info)
+{
+    char nomeArquivo[256];
+    if (arquivo == NULL || strlen(arquivo) >= sizeof(nomeArquivo))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    strcpy(nomeArquivo, arquivo);
+
+    pthread_rwlock_wrlock(&rede->trava);
+    if (rede->diario.arquivoDados[0] != '\0')
+    {
+        pthread_rwlock_unlock(&rede->trava);
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    Diario anterior = rede->diario;
+    int carregado = carregarRodoviasDeArquivo(&rede->lista, nomeArquivo) == RODOVIAS_OK;
+    int recuperadas = abrirDiario(&rede->diario, nomeArquivo, &rede->lista);
+    rede->versao++;
+    if (anterior.alimentacao >= 0)
+    {
+        rede->diario.alimentacao = anterior.alimentacao;
+        rede->diario.geracao = anterior.geracao;
+        rotacionarAlimentacao(&rede->diario, rede->lista, anterior.caminhoAlimentacao);
+    }
+    reconstruirIndices(rede);
+    prepararEspacial(rede);
+
+    if (info != NULL)
+    {
+        info->carregado = carregado;
+        info->diarioAberto = recuperadas >= 0;
+        info->recuperadas = recuperadas > 0 ? recuperadas : 0;
+        info->bytesDescartados = rede->diario.bytesDescartados;
+    }
+    pthread_rwlock_unlock(&rede->trava);
+
+    return carregado && recuperadas >= 0 ? RODOVIAS_OK : RODOVIAS_ERRO_ARQUIVO;
+}
+
+int salvarRede(RedeRodovias *rede, int aguardar)
+{
+    int status = RODOVIAS_OK;
+    pthread_rwlock_wrlock(&rede->trava);
+    if (rede->diario.arquivoDados[0] == '\0')
+    {
+        status = RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    else if (rede->diario.descritor < 0 || compactarDiario(&rede->diario, rede->lista, aguardar) < 0)
+    {
+        status = RODOVIAS_ERRO_ARQUIVO;
+    }
+    if (rede->diario.falhaCompactacao)
+    {
+        rede->diario.falhaCompactacao = 0;
+        status = RODOVIAS_ERRO_ARQUIVO;
+    }
+    if (status == RODOVIAS_OK && rede->diario.alimentacao >= 0 &&
+        !rotacionarAlimentacao(&rede->diario, rede->lista, rede->diario.caminhoAlimentacao))
+    {
+        status = RODOVIAS_ERRO_ARQUIVO;
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int publicarAlteracoesRede(RedeRodovias *rede, const char *caminho)
+{
+    char caminhoAlimentacao[256];
+    if (caminho == NULL || strlen(caminho) >= 200)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    strcpy(caminhoAlimentacao, caminho);
+
+    pthread_rwlock_wrlock(&rede->trava);
+    int status = rotacionarAlimentacao(&rede->diario, rede->lista, caminhoAlimentacao) ? RODOVIAS_OK
+                                                                                        : RODOVIAS_ERRO_ARQUIVO;
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int consultarAlimentacaoRede(RedeRodovias *rede, InfoAlimentacao *info)
+{
+    int status = RODOVIAS_OK;
+    pthread_rwlock_rdlock(&rede->trava);
+    if (rede->diario.alimentacao < 0)
+    {
+        status = RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    else if (info != NULL)
+    {
+        info->geracao = rede->diario.geracao;
+        info->registros = rede->diario.registrosAlimentacao;
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int descartarAlteracoesRede(RedeRodovias *rede)
+{
+    int status = RODOVIAS_OK;
+    pthread_rwlock_wrlock(&rede->trava);
+    if (rede->diario.descritor < 0)
+    {
+        status = RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    else
+    {
+        descartarDiario(&rede->diario);
+        if (rede->diario.pendentes != 0)
+        {
+            status = RODOVIAS_ERRO_ARQUIVO;
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int alteracoesPendentesRede(RedeRodovias *rede)
+{
+    pthread_rwlock_rdlock(&rede->trava);
+    int pendentes = rede->diario.pendentes;
+    for (Rodovia *r = rede->lista; r != NULL; r = r->proxima)
+    {
+        pendentes += r->modificada;
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return pendentes;
+}
+
+int exportarRede(RedeRodovias *rede, const char *arquivo)
+{
+    char nomeArquivo[256];
+    if (arquivo == NULL || strlen(arquivo) >= sizeof(nomeArquivo))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    strcpy(nomeArquivo, arquivo);
+
+    pthread_rwlock_rdlock(&rede->trava);
+    int status = imprimirRodoviasEmArquivo(rede->lista, nomeArquivo);
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int escreverRede(RedeRodovias *rede, int descritor)
+{
+    BufferSaida saida;
+    if (!iniciarBufferSaida(&saida, descritor))
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+
+    pthread_rwlock_rdlock(&rede->trava);
+    if (rede->lista == NULL)
+    {
+        saidaTexto(&saida, "Nenhuma rodovia registrada!\n");
+    }
+    else
+    {
+        escreverRodovias(&saida, rede->lista, 0);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+
+    return finalizarBufferSaida(&saida) != 0 ? RODOVIAS_ERRO_ARQUIVO : RODOVIAS_OK;
+}
+
+void destruirRede(RedeRodovias *rede)
+{
+    if (rede == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&rede->travaCompactacao);
+    rede->encerrarCompactador = 1;
+    pthread_cond_signal(&rede->sinalCompactacao);
+    pthread_mutex_unlock(&rede->travaCompactacao);
+    if (rede->compactadorIniciado)
+    {
+        pthread_join(rede->compactador, NULL);
+    }
+    fecharDiario(&rede->diario);
+    liberarBuscaAlcance(&rede->busca);
+    liberarGrafo(rede->grafo);
+    liberarMemoria(rede->lista);
+    liberarMemoria(rede->removidas);
+    liberarIndiceNomes(&rede->indiceRodovias);
+    liberarIndiceNomes(&rede->indiceCidades);
+    liberarIndiceEspacial(rede->espacial);
+    free(rede->interdicoes);
+    for (int i = 0; i < MAXIMO_CACHE_ROTAS; i++)
+    {
+        free(rede->cacheRotas.entradas[i].arestas);
+    }
+    pthread_mutex_destroy(&rede->cacheRotas.trava);
+    pthread_mutex_destroy(&rede->travaCompactacao);
+    pthread_cond_destroy(&rede->sinalCompactacao);
+    pthread_mutex_destroy(&rede->travaBusca);
+    pthread_mutex_destroy(&rede->travaDerivados);
+    pthread_rwlock_destroy(&rede->trava);
+    free(rede);
+}
+
+int inserirRodoviaRede(RedeRodovias *rede, const char *rodovia)
+{
+    char nomeRodovia[50];
+    if (!copiarNome(nomeRodovia, rodovia))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status;
+    pthread_rwlock_wrlock(&rede->trava);
+    if (buscarRodovia(rede->lista, nomeRodovia) != NULL)
+    {
+        status = RODOVIAS_RODOVIA_EXISTENTE;
+    }
+    else
+    {
+        Rodovia *lista = inserirRodovia(rede->lista, nomeRodovia);
+        if (lista == rede->lista)
+        {
+            status = RODOVIAS_ERRO_MEMORIA;
+        }
+        else
+        {
+            rede->lista = lista;
+            rede->versao++;
+            indexarNome(rede, &rede->indiceRodovias, nomeRodovia);
+            status = registrar(rede, ALTERACAO_INSERIR_RODOVIA, nomeRodovia, NULL, NULL, 0);
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int removerRodoviaRede(RedeRodovias *rede, const char *rodovia)
+{
+    char nomeRodovia[50];
+    if (!copiarNome(nomeRodovia, rodovia))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status;
+    pthread_rwlock_wrlock(&rede->trava);
+    Rodovia *r = desligarRodovia(&rede->lista, nomeRodovia);
+    if (r == NULL)
+    {
+        status = RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    else
+    {
+        removerNomeIndice(&rede->indiceRodovias, r->nome);
+        for (Cidade *c = r->cidades; c != NULL; c = c->proxima)
+        {
+            removerNomeIndice(&rede->indiceCidades, c->nomeCidade);
+        }
+        status = registrar(rede, ALTERACAO_REMOVER_RODOVIA, nomeRodovia, NULL, NULL, 0);
+        sepultarRodovia(rede, r);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int inserirCidadeRede(RedeRodovias *rede, const char *rodovia, const char *cidade, double distancia)
+{
+    Metros metros = kmParaMetros(distancia);
+    char nomeRodovia[50], nomeCidade[50];
+    if (!copiarNome(nomeRodovia, rodovia) || !copiarNome(nomeCidade, cidade))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status;
+    pthread_rwlock_wrlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, nomeRodovia);
+    if (r == NULL)
+    {
+        status = RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    else if (buscarCidade(r, nomeCidade) != NULL)
+    {
+        status = RODOVIAS_CIDADE_EXISTENTE;
+    }
+    else if (inserirCidade(r, nomeCidade, metros) == NULL)
+    {
+        status = RODOVIAS_ERRO_MEMORIA;
+    }
+    else
+    {
+        rede->versao++;
+        indexarNome(rede, &rede->indiceCidades, nomeCidade);
+        status = registrar(rede, ALTERACAO_INSERIR_CIDADE, r->nome, nomeCidade, NULL, metros);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int removerCidadeRede(RedeRodovias *rede, const char *rodovia, const char *cidade)
+{
+    char nomeRodovia[50], nomeCidade[50];
+    if (!copiarNome(nomeRodovia, rodovia) || !copiarNome(nomeCidade, cidade))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status;
+    pthread_rwlock_wrlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, nomeRodovia);
+    if (r == NULL)
+    {
+        status = RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    else if ((status = sepultarCidade(rede, r, nomeCidade)) == RODOVIAS_OK)
+    {
+        status = registrar(rede, ALTERACAO_REMOVER_CIDADE, r->nome, nomeCidade, NULL, 0);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int compactarRede(RedeRodovias *rede)
+{
+    return compactar(rede, 1);
+}
+
+int definirPedagioRede(RedeRodovias *rede, const char *rodovia, const char *cidade1, const char *cidade2, double valor)
+{
+    Centavos centavos = reaisParaCentavos(valor);
+    char nomeRodovia[50], nomeCidade1[50], nomeCidade2[50];
+    if (!copiarNome(nomeRodovia, rodovia) || !copiarNome(nomeCidade1, cidade1) || !copiarNome(nomeCidade2, cidade2))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status;
+    pthread_rwlock_wrlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, nomeRodovia);
+    if (r == NULL)
+    {
+        status = RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    else if ((status = adicionarPedagio(r, nomeCidade1, nomeCidade2, centavos, SENTIDO_AMBOS)) == RODOVIAS_OK)
+    {
+        Cidade *c1 = buscarCidade(r, nomeCidade1), *c2 = buscarCidade(r, nomeCidade2);
+        atualizarPesosGrafo(rede, r, c1->indice < c2->indice ? c1 : c2);
+        status = registrar(rede, ALTERACAO_PEDAGIO, r->nome, nomeCidade1, nomeCidade2, centavos);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+static int atualizarTrecho(RedeRodovias *rede, const InfoAtualizacaoTrecho *atualizacao)
+{
+    char nomeRodovia[50], nomeCidade1[50], nomeCidade2[50];
+    if (!copiarNome(nomeRodovia, atualizacao->rodovia) || !copiarNome(nomeCidade1, atualizacao->cidade1) ||
+        !copiarNome(nomeCidade2, atualizacao->cidade2) || !(atualizacao->distancia <= 1e9) ||
+        !(atualizacao->pedagio <= 1e9))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    Rodovia *r = buscarRodovia(rede->lista, nomeRodovia);
+    if (r == NULL)
+    {
+        return RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    Cidade *c1 = buscarCidade(r, nomeCidade1), *c2 = buscarCidade(r, nomeCidade2);
+    if (c1 == NULL || c2 == NULL)
+    {
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    if (c1 == c2)
+    {
+        return RODOVIAS_CIDADES_IGUAIS;
+    }
+    Cidade *inicio = c1->indice < c2->indice ? c1 : c2;
+    if (inicio->proxima != c1 && inicio->proxima != c2)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status = RODOVIAS_OK;
+    if (atualizacao->distancia >= 0)
+    {
+        Metros metros = kmParaMetros(atualizacao->distancia);
+        definirDistanciaTrecho(r, nomeCidade1, nomeCidade2, metros);
+        status = registrar(rede, ALTERACAO_DISTANCIA, r->nome, nomeCidade1, nomeCidade2, metros);
+    }
+    if (status == RODOVIAS_OK && atualizacao->pedagio >= 0)
+    {
+        Centavos centavos = reaisParaCentavos(atualizacao->pedagio);
+        adicionarPedagio(r, nomeCidade1, nomeCidade2, centavos, SENTIDO_AMBOS);
+        status = registrar(rede, ALTERACAO_PEDAGIO, r->nome, nomeCidade1, nomeCidade2, centavos);
+    }
+    atualizarPesosGrafo(rede, r, inicio);
+    return status;
+}
+
+int atualizarTrechosRede(RedeRodovias *rede, const InfoAtualizacaoTrecho atualizacoes[], int quantidade,
+                         int *aplicadas)
+{
+    int status = quantidade >= 0 ? RODOVIAS_OK : RODOVIAS_ARGUMENTO_INVALIDO;
+    int total = 0;
+    pthread_rwlock_wrlock(&rede->trava);
+    while (status == RODOVIAS_OK && total < quantidade)
+    {
+        status = atualizarTrecho(rede, &atualizacoes[total]);
+        total += status == RODOVIAS_OK;
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    if (aplicadas != NULL)
+    {
+        *aplicadas = total;
+    }
+    return status;
+}
+
+int definirTarifaRede(RedeRodovias *rede, const char *rodovia, const char *cidade1, const char *cidade2, int classe,
+                      int inicio, double valor)
+{
+    Centavos centavos = valor < 0 ? -1 : reaisParaCentavos(valor);
+    char nomeRodovia[50], nomeCidade1[50], nomeCidade2[50];
+    if (!copiarNome(nomeRodovia, rodovia) || !copiarNome(nomeCidade1, cidade1) || !copiarNome(nomeCidade2, cidade2))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status;
+    pthread_rwlock_wrlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, nomeRodovia);
+    if (r == NULL)
+    {
+        status = RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    else if ((status = definirTarifaPedagio(r, nomeCidade1, nomeCidade2, classe, inicio, centavos)) == RODOVIAS_OK)
+    {
+        rede->versao++;
+        if (registrando(rede) &&
+            !registrarTarifa(&rede->diario, r->nome, nomeCidade1, nomeCidade2, classe, inicio, centavos))
+        {
+            status = RODOVIAS_ERRO_ARQUIVO;
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int definirCoordenadasRede(RedeRodovias *rede, const char *cidade, double latitude, double longitude)
+{
+    char nomeCidade[50];
+    Micrograus lat = grausParaMicrograus(latitude), lon = grausParaMicrograus(longitude);
+    if (!copiarNome(nomeCidade, cidade) || !coordenadasValidas(lat, lon))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status = RODOVIAS_OK;
+    pthread_rwlock_wrlock(&rede->trava);
+    if (definirCoordenadas(rede->lista, nomeCidade, lat, lon) == 0)
+    {
+        status = RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    else
+    {
+        rede->versao++;
+        if (registrando(rede) && !registrarCoordenadas(&rede->diario, nomeCidade, lat, lon))
+        {
+            status = RODOVIAS_ERRO_ARQUIVO;
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+static int localizarInterdicao(RedeRodovias *rede, InfoInterdicao *interdicao)
+{
+    for (int i = 0; i < rede->quantidadeInterdicoes; i++)
+    {
+        InfoInterdicao *existente = &rede->interdicoes[i];
+        if (strcmp(existente->rodovia, interdicao->rodovia) == 0 &&
+            strcmp(existente->cidade1, interdicao->cidade1) == 0 &&
+            strcmp(existente->cidade2, interdicao->cidade2) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int interditarTrechoRede(RedeRodovias *rede, const char *rodovia, const char *cidade1, const char *cidade2,
+                         int interditar)
+{
+    InfoInterdicao interdicao;
+    if (!copiarNome(interdicao.rodovia, rodovia) || !copiarNome(interdicao.cidade1, cidade1) ||
+        !copiarNome(interdicao.cidade2, cidade2))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status = RODOVIAS_OK;
+    pthread_rwlock_wrlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, interdicao.rodovia);
+    Cidade *c1 = r != NULL ? buscarCidade(r, interdicao.cidade1) : NULL;
+    Cidade *c2 = r != NULL ? buscarCidade(r, interdicao.cidade2) : NULL;
+    if (r == NULL)
+    {
+        status = RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    else if (c1 == NULL || c2 == NULL)
+    {
+        status = RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    else if (c1 == c2)
+    {
+        status = RODOVIAS_CIDADES_IGUAIS;
+    }
+    else
+    {
+        if (c1->indice > c2->indice)
+        {
+            Cidade *troca = c1;
+            c1 = c2;
+            c2 = troca;
+        }
+        strcpy(interdicao.rodovia, r->nome);
+        strcpy(interdicao.cidade1, c1->nomeCidade);
+        strcpy(interdicao.cidade2, c2->nomeCidade);
+
+        int posicao = localizarInterdicao(rede, &interdicao);
+        if (interditar && posicao < 0)
+        {
+            if (rede->quantidadeInterdicoes == rede->capacidadeInterdicoes)
+            {
+                int capacidade = rede->capacidadeInterdicoes > 0 ? 2 * rede->capacidadeInterdicoes : 8;
+                InfoInterdicao *maiores = realloc(rede->interdicoes, sizeof(InfoInterdicao) * capacidade);
+                if (maiores == NULL)
+                {
+                    status = RODOVIAS_ERRO_MEMORIA;
+                }
+                else
+                {
+                    rede->interdicoes = maiores;
+                    rede->capacidadeInterdicoes = capacidade;
+                }
+            }
+            if (status == RODOVIAS_OK)
+            {
+                rede->interdicoes[rede->quantidadeInterdicoes++] = interdicao;
+            }
+        }
+        else if (!interditar && posicao >= 0)
+        {
+            memmove(&rede->interdicoes[posicao], &rede->interdicoes[posicao + 1],
+                    sizeof(InfoInterdicao) * (rede->quantidadeInterdicoes - posicao - 1));
+            rede->quantidadeInterdicoes--;
+        }
+
+        pthread_mutex_lock(&rede->travaDerivados);
+        if (rede->grafo != NULL && rede->versaoGrafo == rede->versao)
+        {
+            reaplicarInterdicoes(rede, rede->grafo);
+        }
+        pthread_mutex_unlock(&rede->travaDerivados);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int listarInterdicoesRede(RedeRodovias *rede, InfoInterdicao interdicoes[], int maximo, int *quantidade)
+{
+    pthread_rwlock_rdlock(&rede->trava);
+    for (int i = 0; i < rede->quantidadeInterdicoes && i < maximo; i++)
+    {
+        interdicoes[i] = rede->interdicoes[i];
+    }
+    *quantidade = rede->quantidadeInterdicoes;
+    pthread_rwlock_unlock(&rede->trava);
+    return RODOVIAS_OK;
+}
+
+int buscarRodoviaRede(RedeRodovias *rede, const char *rodovia, InfoRodovia *info)
+{
+    char nomeRodovia[50];
+    if (!copiarNome(nomeRodovia, rodovia))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    pthread_rwlock_rdlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, nomeRodovia);
+    if (r != NULL && info != NULL)
+    {
+        strcpy(info->nome, r->nome);
+        info->numeroCidades = r->numeroCidades;
+        info->pedagioTotal = centavosParaReais(calcularPedagioTotal(r));
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return r != NULL ? RODOVIAS_OK : RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+}
+
+int listarRodoviasRede(RedeRodovias *rede, InfoRodovia rodovias[], int maximo, int *quantidade)
+{
+    int total = 0;
+    pthread_rwlock_rdlock(&rede->trava);
+    for (Rodovia *r = rede->lista; r != NULL; r = r->proxima, total++)
+    {
+        if (total < maximo)
+        {
+            strcpy(rodovias[total].nome, r->nome);
+            rodovias[total].numeroCidades = r->numeroCidades;
+            rodovias[total].pedagioTotal = centavosParaReais(calcularPedagioTotal(r));
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    *quantidade = total;
+    return RODOVIAS_OK;
+}
+
+int listarCidadesRede(RedeRodovias *rede, const char *rodovia, InfoCidade cidades[], int maximo, int *quantidade)
+{
+    char nomeRodovia[50];
+    if (!copiarNome(nomeRodovia, rodovia))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int total = 0;
+    pthread_rwlock_rdlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, nomeRodovia);
+    for (Cidade *c = r != NULL ? r->cidades : NULL; c != NULL; c = c->proxima, total++)
+    {
+        if (total < maximo)
+        {
+            strcpy(cidades[total].nome, c->nomeCidade);
+            cidades[total].distancia = metrosParaKm(c->distancia);
+            cidades[total].pedagioIda = c->anterior != NULL ? centavosParaReais(r->pedagiosIda[c->anterior->indice]) : 0;
+            cidades[total].pedagioVolta =
+                c->anterior != NULL ? centavosParaReais(pedagioTrecho(r, c->anterior->indice, SENTIDO_VOLTA)) : 0;
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    *quantidade = total;
+    return r != NULL ? RODOVIAS_OK : RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+}
+
+int localizarCidadeRede(RedeRodovias *rede, const char *rodovia, const char *cidade, int *posicao)
+{
+    char nomeRodovia[50], nomeCidade[50];
+    if (!copiarNome(nomeRodovia, rodovia) || !copiarNome(nomeCidade, cidade))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status = RODOVIAS_OK;
+    pthread_rwlock_rdlock(&rede->trava);
+    Rodovia *r = buscarRodovia(rede->lista, nomeRodovia);
+    Cidade *c = buscarCidade(r, nomeCidade);
+    if (r == NULL)
+    {
+        status = RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+    }
+    else if (c == NULL)
+    {
+        status = RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    else if (posicao != NULL)
+    {
+        *posicao = c->indice;
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+int listarCruzamentosRede(RedeRodovias *rede, const char *rodovia1, const char *rodovia2,
+                          InfoCruzamento cruzamentos[], int maximo, int *quantidade)
+{
+    char nomeRodovia1[50], nomeRodovia2[50];
+    if (!copiarNome(nomeRodovia1, rodovia1) || !copiarNome(nomeRodovia2, rodovia2))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int total = 0;
+    pthread_rwlock_rdlock(&rede->trava);
+    Rodovia *r1 = buscarRodovia(rede->lista, nomeRodovia1);
+    Rodovia *r2 = buscarRodovia(rede->lista, nomeRodovia2);
+    if (r1 != NULL && r2 != NULL)
+    {
+        for (Cidade *c1 = r1->cidades; c1 != NULL; c1 = c1->proxima)
+        {
+            for (Cidade *c2 = r2->cidades; c2 != NULL; c2 = c2->proxima)
+            {
+                if (!mesmaChave(c1->hash, c1->chave, c2->hash, c2->chave))
+                {
+                    continue;
+                }
+                if (total < maximo)
+                {
+                    strcpy(cruzamentos[total].cidade, c1->nomeCidade);
+                    cruzamentos[total].distancia1 = metrosParaKm(c1->distancia);
+                    cruzamentos[total].distancia2 = metrosParaKm(c2->distancia);
+                }
+                total++;
+            }
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    *quantidade = total;
+    return r1 != NULL && r2 != NULL ? RODOVIAS_OK : RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+}
+
+int consultarPercursoRede(RedeRodovias *rede, const char *origem, const char *destino, InfoPercurso *percurso)
+{
+    return consultarPercursoTarifadoRede(rede, origem, destino, PARTIDA_INDEFINIDA, 0, percurso);
+}
+
+int consultarPercursoTarifadoRede(RedeRodovias *rede, const char *origem, const char *destino, int partida, int classe,
+                                  InfoPercurso *percurso)
+{
+    char nomeOrigem[50], nomeDestino[50];
+    if (!copiarNome(nomeOrigem, origem) || !copiarNome(nomeDestino, destino) || partida < PARTIDA_INDEFINIDA ||
+        partida >= MINUTOS_SEMANA || classe < 0 || classe >= MAXIMO_CLASSES_VEICULO)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    memset(percurso, 0, sizeof(InfoPercurso));
+
+    pthread_rwlock_rdlock(&rede->trava);
+    int status = prepararIndices(rede);
+    if (status == RODOVIAS_OK && (buscarNomeIndice(&rede->indiceCidades, nomeOrigem) == NULL ||
+                                  buscarNomeIndice(&rede->indiceCidades, nomeDestino) == NULL))
+    {
+        status = RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    else if (status == RODOVIAS_OK)
+    {
+        status = prepararAdjacencias(rede);
+    }
+    if (status == RODOVIAS_OK)
+    {
+        ResultadoPercurso resultado;
+        int situacao = consultarPercurso(rede->lista, nomeOrigem, nomeDestino, partida, classe, &resultado);
+        if (situacao == CONSULTA_CIDADE_NAO_ENCONTRADA)
+        {
+            status = RODOVIAS_CIDADE_NAO_ENCONTRADA;
+        }
+        else
+        {
+            strcpy(percurso->rodoviaInicio, resultado.rodoviaInicio->nome);
+            strcpy(percurso->rodoviaFim, resultado.rodoviaFim->nome);
+            strcpy(percurso->origem, resultado.origem);
+            strcpy(percurso->destino, resultado.destino);
+            strcpy(percurso->cidadeConexao, resultado.cidadeConexao);
+            percurso->distancia = metrosParaKm(resultado.distancia);
+            percurso->pedagio = centavosParaReais(resultado.pedagio);
+            status = situacao == CONSULTA_SEM_ROTA ? RODOVIAS_SEM_ROTA : RODOVIAS_OK;
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+static void converterArestas(Grafo *grafo, int arestas[], int quantidade, int verticeInicio, InfoRota *info)
+{
+    info->quantidadeTrechos = -1;
+    int inicioTrecho = 0, trechos = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (i + 1 < quantidade && grafo->rodovias[arestas[i + 1]] == grafo->rodovias[arestas[i]])
+        {
+            continue;
+        }
+        if (trechos == MAXIMO_TRECHOS_ROTA)
+        {
+            return;
+        }
+        InfoTrecho *trecho = &info->trechos[trechos++];
+        Metros distancia = 0;
+        Centavos pedagio = 0;
+        for (int j = inicioTrecho; j <= i; j++)
+        {
+            distancia += grafo->distancias[arestas[j]];
+            pedagio += grafo->pedagios[arestas[j]];
+        }
+        trecho->distancia = metrosParaKm(distancia);
+        trecho->pedagio = centavosParaReais(pedagio);
+        strcpy(trecho->rodovia, grafo->rodovias[arestas[i]]->nome);
+        strcpy(trecho->origem, grafo->nomes[verticeInicio]);
+        strcpy(trecho->destino, grafo->nomes[grafo->destinos[arestas[i]]]);
+        verticeInicio = grafo->destinos[arestas[i]];
+        inicioTrecho = i + 1;
+    }
+    info->quantidadeTrechos = trechos;
+}
+
+static EntradaCacheRotas *entradaCacheRotas(RedeRodovias *rede, int origem, int destino, int criterio,
+                                            float pesoDistancia, float pesoPedagio)
+{
+    unsigned int hash = (unsigned int)origem * 2654435761u ^ (unsigned int)destino * 40503u ^ (unsigned int)criterio;
+    hash ^= (unsigned int)(pesoDistancia * 1000) * 97u ^ (unsigned int)(pesoPedagio * 1000) * 131u;
+    return &rede->cacheRotas.entradas[hash % MAXIMO_CACHE_ROTAS];
+}
+
+static int mesmaConsultaCache(EntradaCacheRotas *entrada, int origem, int destino, int criterio,
+                              float pesoDistancia, float pesoPedagio)
+{
+    return entrada->arestas != NULL && entrada->origem == origem && entrada->destino == destino &&
+           entrada->criterio == criterio && entrada->pesoDistancia == pesoDistancia &&
+           entrada->pesoPedagio == pesoPedagio;
+}
+
+static int consultarCacheRotas(RedeRodovias *rede, Grafo *grafo, int origem, int destino, int criterio,
+                               float pesoDistancia, float pesoPedagio, InfoRotas *resultado)
+{
+    CacheRotas *cache = &rede->cacheRotas;
+    pthread_mutex_lock(&cache->trava);
+    EntradaCacheRotas *entrada = entradaCacheRotas(rede, origem, destino, criterio, pesoDistancia, pesoPedagio);
+    int valida = mesmaConsultaCache(entrada, origem, destino, criterio, pesoDistancia, pesoPedagio);
+    if (valida)
+    {
+        valida = entrada->versaoGrafo == rede->versaoGrafo && entrada->versaoPesos >= rede->versaoMelhoria;
+        for (int i = 0; valida && i < entrada->inicioRotas[entrada->quantidade]; i++)
+        {
+            valida = grafo->versoesSegmentos[grafo->segmentos[entrada->arestas[i]]] <= entrada->versaoPesos;
+        }
+        cache->invalidadas += !valida;
+    }
+    if (valida)
+    {
+        for (int i = 0; i < entrada->quantidade; i++)
+        {
+            InfoRota *rota = &resultado->rotas[i];
+            rota->distancia = metrosParaKm(entrada->distancias[i]);
+            rota->pedagio = centavosParaReais(entrada->pedagios[i]);
+            converterArestas(grafo, &entrada->arestas[entrada->inicioRotas[i]],
+                             entrada->inicioRotas[i + 1] - entrada->inicioRotas[i], origem, rota);
+        }
+        resultado->quantidade = entrada->quantidade;
+        resultado->truncada = 0;
+        cache->acertos++;
+    }
+    else
+    {
+        cache->faltas++;
+    }
+    pthread_mutex_unlock(&cache->trava);
+    return valida;
+}
+
+static void guardarCacheRotas(RedeRodovias *rede, int origem, int destino, int criterio, float pesoDistancia,
+                              float pesoPedagio, unsigned long versaoPesos, RotaAlternativa rotas[], int quantidade,
+                              int arestas[], int inicioRotas[])
+{
+    int *copia = malloc(sizeof(int) * (inicioRotas[quantidade] + 1));
+    if (copia == NULL)
+    {
+        return;
+    }
+    memcpy(copia, arestas, sizeof(int) * inicioRotas[quantidade]);
+
+    CacheRotas *cache = &rede->cacheRotas;
+    pthread_mutex_lock(&cache->trava);
+    EntradaCacheRotas *entrada = entradaCacheRotas(rede, origem, destino, criterio, pesoDistancia, pesoPedagio);
+    free(entrada->arestas);
+    entrada->origem = origem;
+    entrada->destino = destino;
+    entrada->criterio = criterio;
+    entrada->pesoDistancia = pesoDistancia;
+    entrada->pesoPedagio = pesoPedagio;
+    entrada->versaoGrafo = rede->versaoGrafo;
+    entrada->versaoPesos = versaoPesos;
+    entrada->quantidade = quantidade;
+    for (int i = 0; i < quantidade; i++)
+    {
+        entrada->distancias[i] = rotas[i].distancia;
+        entrada->pedagios[i] = rotas[i].pedagio;
+    }
+    memcpy(entrada->inicioRotas, inicioRotas, sizeof(int) * (quantidade + 1));
+    entrada->arestas = copia;
+    pthread_mutex_unlock(&cache->trava);
+}
+
+static int restringirBusca(Rodovia *lista, InfoRestricoes *restricoes, BuscaRotas *busca, uint64_t **bloqueados)
+{
+    Grafo *grafo = busca->grafo;
+    if (restricoes->pedagioMaximoTrecho >= 0)
+    {
+        busca->pedagioMaximo = limiteEmUnidades(restricoes->pedagioMaximoTrecho, CENTAVOS_POR_REAL);
+    }
+    if (restricoes->quantidadeInterdicoes == 0 && restricoes->quantidadeRodoviasEvitadas == 0)
+    {
+        return RODOVIAS_OK;
+    }
+
+    size_t tamanho = sizeof(uint64_t) * (grafo->quantidadeSegmentos / 64 + 1);
+    *bloqueados = malloc(tamanho);
+    if (*bloqueados == NULL)
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+    memcpy(*bloqueados, grafo->interditados, tamanho);
+    busca->bloqueados = *bloqueados;
+
+    for (int i = 0; i < restricoes->quantidadeInterdicoes; i++)
+    {
+        int status = marcarInterdicao(lista, grafo, &restricoes->interdicoes[i], *bloqueados);
+        if (status != RODOVIAS_OK)
+        {
+            return status;
+        }
+    }
+    for (int i = 0; i < restricoes->quantidadeRodoviasEvitadas; i++)
+    {
+        Rodovia *r = buscarRodovia(lista, restricoes->rodoviasEvitadas[i]);
+        if (r == NULL)
+        {
+            return RODOVIAS_RODOVIA_NAO_ENCONTRADA;
+        }
+        int base = primeiroSegmento(grafo, r);
+        if (base >= 0)
+        {
+            marcarSegmentos(*bloqueados, base, base + r->numeroCidades - 1);
+        }
+    }
+    return RODOVIAS_OK;
+}
+
+static int calcularRotas(RedeRodovias *rede, Grafo *grafo, char origem[], char destino[], int criterio,
+                         double pesoDistancia, double pesoPedagio, InfoRestricoes *restricoes, InfoRotas *resultado)
+{
+    int verticeOrigem = buscarVertice(grafo, origem);
+    int verticeDestino = buscarVertice(grafo, destino);
+    if (verticeOrigem < 0 || verticeDestino < 0)
+    {
+        return RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    strcpy(resultado->origem, grafo->nomes[verticeOrigem]);
+    strcpy(resultado->destino, grafo->nomes[verticeDestino]);
+
+    float chaveDistancia = criterio == ROTA_PONDERADA ? (float)pesoDistancia : 0;
+    float chavePedagio = criterio == ROTA_PONDERADA ? (float)pesoPedagio : 0;
+    if (restricoes == NULL && consultarCacheRotas(rede, grafo, verticeOrigem, verticeDestino, criterio,
+                                                  chaveDistancia, chavePedagio, resultado))
+    {
+        return resultado->quantidade > 0 ? RODOVIAS_OK : RODOVIAS_SEM_ROTA;
+    }
+
+    BuscaRotas busca;
+    if (!iniciarBuscaRotas(&busca, grafo, LIMITE_ROTULOS_ROTAS))
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+    uint64_t *bloqueados = NULL;
+    int *arestas = malloc(sizeof(int) * MAXIMO_ROTAS_ALTERNATIVAS * LIMITE_ARESTAS_ROTA);
+    int status = arestas == NULL ? RODOVIAS_ERRO_MEMORIA : RODOVIAS_OK;
+    if (status == RODOVIAS_OK && restricoes != NULL)
+    {
+        status = restringirBusca(rede->lista, restricoes, &busca, &bloqueados);
+    }
+    if (status != RODOVIAS_OK)
+    {
+        free(arestas);
+        free(bloqueados);
+        liberarBuscaRotas(&busca);
+        return status;
+    }
+
+    RotaAlternativa rotas[MAXIMO_ROTAS_ALTERNATIVAS];
+    int quantidade;
+    if (criterio == ROTA_PARETO)
+    {
+        quantidade = rotasPareto(&busca, verticeOrigem, verticeDestino, rotas, MAXIMO_ROTAS_ALTERNATIVAS);
+    }
+    else
+    {
+        quantidade = rotasPonderadas(&busca, verticeOrigem, verticeDestino, pesoDistancia, pesoPedagio,
+                                     rotas, MAXIMO_ROTAS_ALTERNATIVAS);
+    }
+
+    int inicioRotas[MAXIMO_ROTAS_ALTERNATIVAS + 1] = {0};
+    int completa = !busca.truncada;
+    for (int i = 0; i < quantidade; i++)
+    {
+        InfoRota *rota = &resultado->rotas[i];
+        int *arestasRota = &arestas[inicioRotas[i]];
+        int usadas = arestasDaRota(&busca, &rotas[i], arestasRota, LIMITE_ARESTAS_ROTA);
+        rota->distancia = metrosParaKm(rotas[i].distancia);
+        rota->pedagio = centavosParaReais(rotas[i].pedagio);
+        rota->quantidadeTrechos = -1;
+        if (usadas >= 0)
+        {
+            converterArestas(grafo, arestasRota, usadas, verticeOrigem, rota);
+        }
+        completa &= usadas >= 0;
+        inicioRotas[i + 1] = inicioRotas[i] + (usadas > 0 ? usadas : 0);
+    }
+    resultado->quantidade = quantidade;
+    resultado->truncada = busca.truncada;
+    if (restricoes == NULL && completa)
+    {
+        guardarCacheRotas(rede, verticeOrigem, verticeDestino, criterio, chaveDistancia, chavePedagio,
+                          rede->versaoPesos, rotas, quantidade, arestas, inicioRotas);
+    }
+
+    free(arestas);
+    free(bloqueados);
+    liberarBuscaRotas(&busca);
+    return quantidade > 0 ? RODOVIAS_OK : RODOVIAS_SEM_ROTA;
+}
+
+int rotasAlternativasRede(RedeRodovias *rede, const char *origem, const char *destino, int criterio,
+                          double pesoDistancia, double pesoPedagio, InfoRotas *resultado)
+{
+    return rotasRestritasRede(rede, origem, destino, criterio, pesoDistancia, pesoPedagio, NULL, resultado);
+}
+
+static int copiarRestricoes(InfoRestricoes *destino, const InfoRestricoes *restricoes)
+{
+    if (restricoes->quantidadeInterdicoes < 0 || restricoes->quantidadeInterdicoes > MAXIMO_RESTRICOES_ROTA ||
+        restricoes->quantidadeRodoviasEvitadas < 0 || restricoes->quantidadeRodoviasEvitadas > MAXIMO_RESTRICOES_ROTA ||
+        isnan(restricoes->pedagioMaximoTrecho))
+    {
+        return 0;
+    }
+    destino->quantidadeInterdicoes = restricoes->quantidadeInterdicoes;
+    destino->quantidadeRodoviasEvitadas = restricoes->quantidadeRodoviasEvitadas;
+    destino->pedagioMaximoTrecho = restricoes->pedagioMaximoTrecho;
+    for (int i = 0; i < restricoes->quantidadeInterdicoes; i++)
+    {
+        const InfoInterdicao *interdicao = &restricoes->interdicoes[i];
+        if (!copiarNome(destino->interdicoes[i].rodovia, interdicao->rodovia) ||
+            !copiarNome(destino->interdicoes[i].cidade1, interdicao->cidade1) ||
+            !copiarNome(destino->interdicoes[i].cidade2, interdicao->cidade2))
+        {
+            return 0;
+        }
+    }
+    for (int i = 0; i < restricoes->quantidadeRodoviasEvitadas; i++)
+    {
+        if (!copiarNome(destino->rodoviasEvitadas[i], restricoes->rodoviasEvitadas[i]))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+int rotasRestritasRede(RedeRodovias *rede, const char *origem, const char *destino, int criterio, double pesoDistancia,
+                       double pesoPedagio, const InfoRestricoes *restricoes, InfoRotas *resultado)
+{
+    char nomeOrigem[50], nomeDestino[50];
+    InfoRestricoes copia;
+    if (!copiarNome(nomeOrigem, origem) || !copiarNome(nomeDestino, destino) ||
+        (criterio != ROTA_PARETO && criterio != ROTA_PONDERADA) || pesoDistancia < 0 || pesoPedagio < 0 ||
+        (restricoes != NULL && !copiarRestricoes(&copia, restricoes)))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    resultado->origem[0] = '\0';
+    resultado->destino[0] = '\0';
+    resultado->quantidade = 0;
+    resultado->truncada = 0;
+
+    int status;
+    pthread_rwlock_rdlock(&rede->trava);
+    Grafo *grafo = prepararGrafo(rede);
+    if (grafo == NULL)
+    {
+        status = RODOVIAS_ERRO_MEMORIA;
+    }
+    else
+    {
+        status = calcularRotas(rede, grafo, nomeOrigem, nomeDestino, criterio, pesoDistancia, pesoPedagio,
+                               restricoes != NULL ? &copia : NULL, resultado);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+static int resolverParadas(Grafo *grafo, char nomes[][50], int quantidade, int vertices[], InfoRoteiro *roteiro)
+{
+    int paradas = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        int vertice = buscarVertice(grafo, nomes[i]);
+        if (vertice < 0)
+        {
+            return -1;
+        }
+        int repetida = 0;
+        for (int j = 0; j < paradas && !repetida; j++)
+        {
+            repetida = vertices[j] == vertice;
+        }
+        if (!repetida)
+        {
+            strcpy(roteiro->paradas[paradas].cidade, grafo->nomes[vertice]);
+            vertices[paradas++] = vertice;
+        }
+    }
+    return paradas;
+}
+
+int otimizarRoteiroRede(RedeRodovias *rede, const char *deposito, const char *cidades[], int quantidade,
+                        int tempoLimiteMs, InfoRoteiro *roteiro)
+{
+    char nomes[MAXIMO_PARADAS_ROTEIRO + 1][50];
+    if (quantidade < 1 || quantidade > MAXIMO_PARADAS_ROTEIRO || tempoLimiteMs < 0 || !copiarNome(nomes[0], deposito))
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (!copiarNome(nomes[i + 1], cidades[i]))
+        {
+            return RODOVIAS_ARGUMENTO_INVALIDO;
+        }
+    }
+    memset(roteiro, 0, sizeof(InfoRoteiro));
+
+    int vertices[MAXIMO_PARADAS_ROTEIRO + 1], paradas = 0;
+    Metros *distancias = malloc(sizeof(Metros) * (quantidade + 1) * (quantidade + 1));
+    Centavos *pedagios = malloc(sizeof(Centavos) * (quantidade + 1) * (quantidade + 1));
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int status = distancias != NULL && pedagios != NULL ? RODOVIAS_OK : RODOVIAS_ERRO_MEMORIA;
+
+    pthread_rwlock_rdlock(&rede->trava);
+    Grafo *grafo = status == RODOVIAS_OK ? prepararGrafo(rede) : NULL;
+    if (grafo == NULL)
+    {
+        status = RODOVIAS_ERRO_MEMORIA;
+    }
+    else if ((paradas = resolverParadas(grafo, nomes, quantidade + 1, vertices, roteiro)) < 0)
+    {
+        status = RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    else if (!calcularMatriz(grafo, vertices, paradas, vertices, paradas, threads, distancias, pedagios))
+    {
+        status = RODOVIAS_ERRO_MEMORIA;
+    }
+    pthread_rwlock_unlock(&rede->trava);
+
+    for (int i = 1; status == RODOVIAS_OK && i < paradas; i++)
+    {
+        if (distancias[i] == CUSTO_INFINITO || distancias[i * paradas] == CUSTO_INFINITO)
+        {
+            status = RODOVIAS_SEM_ROTA;
+        }
+    }
+
+    int ordem[MAXIMO_PARADAS_ROTEIRO + 1];
+    if (status == RODOVIAS_OK && !otimizarRoteiro(distancias, paradas, threads, tempoLimiteMs / 1000.0, ordem,
+                                                  &roteiro->tentativas, &roteiro->distanciaInicial))
+    {
+        status = RODOVIAS_ERRO_MEMORIA;
+    }
+    if (status == RODOVIAS_OK)
+    {
+        InfoParada resolvidas[MAXIMO_PARADAS_ROTEIRO + 1];
+        memcpy(resolvidas, roteiro->paradas, sizeof(InfoParada) * paradas);
+        Metros distanciaTotal = 0;
+        Centavos pedagioTotal = 0;
+        for (int i = 0; i <= paradas; i++)
+        {
+            int atual = ordem[i % paradas], anterior = i > 0 ? ordem[i - 1] : atual;
+            InfoParada *parada = &roteiro->paradas[i];
+            Metros distancia = i > 0 ? distancias[anterior * paradas + atual] : 0;
+            Centavos pedagio = i > 0 ? pedagios[anterior * paradas + atual] : 0;
+            strcpy(parada->cidade, resolvidas[atual].cidade);
+            parada->distancia = metrosParaKm(distancia);
+            parada->pedagio = centavosParaReais(pedagio);
+            distanciaTotal += distancia;
+            pedagioTotal += pedagio;
+        }
+        roteiro->distancia = metrosParaKm(distanciaTotal);
+        roteiro->pedagio = centavosParaReais(pedagioTotal);
+        roteiro->quantidadeParadas = paradas + 1;
+    }
+
+    free(distancias);
+    free(pedagios);
+    return status;
+}
+
+static int calcularAlcance(BuscaAlcance *busca, Grafo *grafo, int origem, int criterio, double limite,
+                           InfoAlcance cidades[], int maximo, int *quantidade)
+{
+    if (!prepararBuscaAlcance(busca, grafo))
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+
+    int unidades = criterio == ALCANCE_PEDAGIO ? CENTAVOS_POR_REAL : METROS_POR_KM;
+    int total = buscarAlcance(busca, origem, criterio, limiteEmUnidades(limite, unidades));
+    for (int i = 0; i < total && i < maximo; i++)
+    {
+        CidadeAlcancada *alcancada = &busca->alcancadas[i];
+        strcpy(cidades[i].cidade, grafo->nomes[alcancada->vertice]);
+        cidades[i].distancia = metrosParaKm(alcancada->distancia);
+        cidades[i].pedagio = centavosParaReais(alcancada->pedagio);
+    }
+    *quantidade = total;
+    return RODOVIAS_OK;
+}
+
+int cidadesAlcancaveisRede(RedeRodovias *rede, const char *origem, int criterio, double limite,
+                           InfoAlcance cidades[], int maximo, int *quantidade)
+{
+    char nomeOrigem[50];
+    if (!copiarNome(nomeOrigem, origem) || (criterio != ALCANCE_DISTANCIA && criterio != ALCANCE_PEDAGIO) ||
+        limite < 0)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    *quantidade = 0;
+
+    int status;
+    pthread_rwlock_rdlock(&rede->trava);
+    Grafo *grafo = prepararGrafo(rede);
+    int verticeOrigem = grafo != NULL ? buscarVertice(grafo, nomeOrigem) : -1;
+    if (grafo == NULL)
+    {
+        status = RODOVIAS_ERRO_MEMORIA;
+    }
+    else if (verticeOrigem < 0)
+    {
+        status = RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    else if (pthread_mutex_trylock(&rede->travaBusca) == 0)
+    {
+        status = calcularAlcance(&rede->busca, grafo, verticeOrigem, criterio, limite, cidades, maximo, quantidade);
+        pthread_mutex_unlock(&rede->travaBusca);
+    }
+    else
+    {
+        BuscaAlcance busca;
+        memset(&busca, 0, sizeof(busca));
+        status = calcularAlcance(&busca, grafo, verticeOrigem, criterio, limite, cidades, maximo, quantidade);
+        liberarBuscaAlcance(&busca);
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    return status;
+}
+
+static int converterPosicoes(const InfoPosicao pontos[], int quantidade, Micrograus latitudes[],
+                             Micrograus longitudes[])
+{
+    for (int i = 0; i < quantidade; i++)
+    {
+        latitudes[i] = grausParaMicrograus(pontos[i].latitude);
+        longitudes[i] = grausParaMicrograus(pontos[i].longitude);
+        if (!coordenadasValidas(latitudes[i], longitudes[i]))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void converterVizinho(IndiceEspacial *espacial, VizinhoEspacial *vizinho, InfoCidadeProxima *info)
+{
+    strcpy(info->cidade, espacial->nomes[vizinho->ponto]);
+    info->latitude = micrograusParaGraus(espacial->latitudes[vizinho->ponto]);
+    info->longitude = micrograusParaGraus(espacial->longitudes[vizinho->ponto]);
+    info->distancia = cordaParaMetros(vizinho->corda) / METROS_POR_KM;
+}
+
+static int consultarEspacial(RedeRodovias *rede, const InfoPosicao pontos[], int quantidade, double raioMetros,
+                             InfoCidadeProxima cidades[], int maximoPorPonto, int quantidades[])
+{
+    Micrograus *latitudes = malloc(sizeof(Micrograus) * (quantidade + 1));
+    Micrograus *longitudes = malloc(sizeof(Micrograus) * (quantidade + 1));
+    VizinhoEspacial *vizinhos = malloc(sizeof(VizinhoEspacial) * maximoPorPonto);
+    if (latitudes == NULL || longitudes == NULL || vizinhos == NULL)
+    {
+        free(latitudes);
+        free(longitudes);
+        free(vizinhos);
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+    if (!converterPosicoes(pontos, quantidade, latitudes, longitudes))
+    {
+        free(latitudes);
+        free(longitudes);
+        free(vizinhos);
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+
+    int status = RODOVIAS_OK;
+    pthread_rwlock_rdlock(&rede->trava);
+    IndiceEspacial *espacial = prepararEspacial(rede);
+    if (espacial == NULL)
+    {
+        status = RODOVIAS_ERRO_MEMORIA;
+    }
+    else if (espacial->quantidade == 0)
+    {
+        status = RODOVIAS_CIDADE_NAO_ENCONTRADA;
+    }
+    for (int i = 0; i < quantidade && status == RODOVIAS_OK; i++)
+    {
+        int encontrados = vizinhosEspaciais(espacial, latitudes[i], longitudes[i], raioMetros, vizinhos,
+                                            maximoPorPonto);
+        for (int j = 0; j < encontrados; j++)
+        {
+            converterVizinho(espacial, &vizinhos[j], &cidades[i * maximoPorPonto + j]);
+        }
+        if (quantidades != NULL)
+        {
+            quantidades[i] = encontrados;
+        }
+    }
+    pthread_rwlock_unlock(&rede->trava);
+
+    free(latitudes);
+    free(longitudes);
+    free(vizinhos);
+    return status;
+}
+
+int cidadesMaisProximasRede(RedeRodovias *rede, const InfoPosicao pontos[], int quantidade,
+                            InfoCidadeProxima cidades[])
+{
+    if (quantidade < 0)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    return consultarEspacial(rede, pontos, quantidade, INFINITY, cidades, 1, NULL);
+}
+
+int cidadesNoRaioRede(RedeRodovias *rede, const InfoPosicao pontos[], int quantidade, double raio,
+                      InfoCidadeProxima cidades[], int maximoPorPonto, int quantidades[])
+{
+    if (quantidade < 0 || !(raio >= 0) || maximoPorPonto <= 0)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    return consultarEspacial(rede, pontos, quantidade, raio * METROS_POR_KM, cidades, maximoPorPonto,
+                             quantidades);
+}
+
+static int consultarIndice(RedeRodovias *rede, int tipo, const char *texto, int distanciaMaxima,
+                           InfoSugestao sugestoes[], int maximo, int *quantidade)
+{
+    char nome[50];
+    if (!copiarNome(nome, texto) || (tipo != NOME_RODOVIA && tipo != NOME_CIDADE) || maximo < 0)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    *quantidade = 0;
+
+    SugestaoNome *encontradas = malloc((maximo > 0 ? maximo : 1) * sizeof(SugestaoNome));
+    if (encontradas == NULL)
+    {
+        return RODOVIAS_ERRO_MEMORIA;
+    }
+
+    pthread_rwlock_rdlock(&rede->trava);
+    int status = prepararIndices(rede);
+    if (status == RODOVIAS_OK)
+    {
+        IndiceNomes *indice = tipo == NOME_RODOVIA ? &rede->indiceRodovias : &rede->indiceCidades;
+        int total = distanciaMaxima < 0 ? completarNomeIndice(indice, nome, encontradas, maximo)
+                                        : aproximarNomeIndice(indice, nome, distanciaMaxima, encontradas, maximo);
+        for (int i = 0; i < total; i++)
+        {
+            strcpy(sugestoes[i].nome, encontradas[i].nome);
+            sugestoes[i].distancia = encontradas[i].distancia;
+        }
+        *quantidade = total;
+    }
+    pthread_rwlock_unlock(&rede->trava);
+    free(encontradas);
+    return status;
+}
+
+int completarNomesRede(RedeRodovias *rede, int tipo, const char *prefixo, InfoSugestao sugestoes[], int maximo,
+                       int *quantidade)
+{
+    return consultarIndice(rede, tipo, prefixo, -1, sugestoes, maximo, quantidade);
+}
+
+int sugerirNomesRede(RedeRodovias *rede, int tipo, const char *nome, int distanciaMaxima, InfoSugestao sugestoes[],
+                     int maximo, int *quantidade)
+{
+    if (distanciaMaxima < 0)
+    {
+        return RODOVIAS_ARGUMENTO_INVALIDO;
+    }
+    return consultarIndice(rede, tipo, nome, distanciaMaxima, sugestoes, maximo, quantidade);
+}
+
+const char *descreverStatusRodovias(int status)
+{
+    switch (status)
+    {
+    case RODOVIAS_OK:
+        return "Operação concluída com sucesso.";
+    case RODOVIAS_ERRO_MEMORIA:
+        return "Erro de alocação de memória!";
+    case RODOVIAS_ERRO_ARQUIVO:
+        return "Erro de leitura ou gravação de arquivo!";
+    case RODOVIAS_RODOVIA_EXISTENTE:
+        return "A rodovia já existe!";
+    case RODOVIAS_RODOVIA_NAO_ENCONTRADA:
+        return "Rodovia não encontrada!";
+    case RODOVIAS_CIDADE_EXISTENTE:
+        return "A cidade já existe na rodovia!";
+    case RODOVIAS_CIDADE_NAO_ENCONTRADA:
+        return "Cidade não encontrada!";
+    case RODOVIAS_CIDADES_IGUAIS:
+        return "As cidades devem ser diferentes.";
+    case RODOVIAS_SEM_ROTA:
+        return "Não foi possível encontrar uma rota entre as cidades.";
+    case RODOVIAS_ARGUMENTO_INVALIDO:
+        return "Argumento inválido!";
+    }
+    return "Status desconhecido.";
+}
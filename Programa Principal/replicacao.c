@@ -0,0 +1,427 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include "estruturas.h"
+
+#define ESPERA_ALIMENTACAO_MS 100
+#define TENTATIVAS_INSTANTANEO 200
+
+typedef struct Replica
+{
+    Servidor *servidor;
+    char caminho[256];
+    char caminhoBase[300];
+    int descritor;
+    ino_t inode;
+    uint64_t geracao;
+    long registros;
+    unsigned char *pendentes;
+    size_t usado;
+    size_t capacidade;
+    int notificacao;
+    int aviso[2];
+} Replica;
+
+static int gravarBase(Rodovia *lista, char caminho[], uint64_t geracao)
+{
+    int descritor = open(caminho, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descritor < 0)
+    {
+        return 0;
+    }
+
+    BufferSaida saida;
+    iniciarBufferSaida(&saida, descritor);
+    saidaTexto(&saida, "Geração: ");
+    saidaInteiro(&saida, (long long)geracao);
+    saidaTexto(&saida, "\n");
+    escreverRodovias(&saida, lista, 1);
+    int sucesso = finalizarBufferSaida(&saida) == 0;
+    return close(descritor) == 0 && sucesso;
+}
+
+int rotacionarAlimentacao(Diario *diario, Rodovia *lista, char caminho[])
+{
+    char destino[256], base[300], temporario[310];
+    if (strlen(caminho) >= 200)
+    {
+        return 0;
+    }
+    strcpy(destino, caminho);
+
+    struct timespec instante;
+    clock_gettime(CLOCK_REALTIME, &instante);
+    uint64_t geracao = (uint64_t)instante.tv_sec * 1000000 + instante.tv_nsec / 1000;
+    if (geracao <= diario->geracao)
+    {
+        geracao = diario->geracao + 1;
+    }
+
+    snprintf(base, sizeof(base), "%s.base", destino);
+    snprintf(temporario, sizeof(temporario), "%s.tmp", base);
+    if (!gravarBase(lista, temporario, geracao) || rename(temporario, base) != 0)
+    {
+        unlink(temporario);
+        return 0;
+    }
+
+    unsigned char cabecalho[CABECALHO_ALIMENTACAO];
+    memcpy(cabecalho, MARCA_ALIMENTACAO, 8);
+    memcpy(cabecalho + 8, &geracao, sizeof(uint64_t));
+    snprintf(temporario, sizeof(temporario), "%s.tmp", destino);
+    int descritor = open(temporario, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+    if (descritor < 0 || write(descritor, cabecalho, sizeof(cabecalho)) != sizeof(cabecalho) ||
+        rename(temporario, destino) != 0)
+    {
+        if (descritor >= 0)
+        {
+            close(descritor);
+        }
+        unlink(temporario);
+        return 0;
+    }
+
+    if (diario->alimentacao >= 0)
+    {
+        close(diario->alimentacao);
+    }
+    diario->alimentacao = descritor;
+    strcpy(diario->caminhoAlimentacao, destino);
+    diario->geracao = geracao;
+    diario->registrosAlimentacao = 0;
+    return 1;
+}
+
+static uint64_t lerGeracaoBase(char caminho[])
+{
+    FILE *arquivo = fopen(caminho, "r");
+    unsigned long long geracao = 0;
+    if (arquivo != NULL)
+    {
+        if (fscanf(arquivo, "Geração: %llu", &geracao) != 1)
+        {
+            geracao = 0;
+        }
+        fclose(arquivo);
+    }
+    return geracao;
+}
+
+static int lerNovosRegistros(Replica *replica)
+{
+    int total = 0;
+    for (;;)
+    {
+        if (replica->capacidade - replica->usado < 65536)
+        {
+            size_t capacidade = replica->capacidade * 2 + 65536;
+            unsigned char *maiores = realloc(replica->pendentes, capacidade);
+            if (maiores == NULL)
+            {
+                return -1;
+            }
+            replica->pendentes = maiores;
+            replica->capacidade = capacidade;
+        }
+
+        ssize_t lidos = read(replica->descritor, replica->pendentes + replica->usado,
+                             replica->capacidade - replica->usado);
+        if (lidos < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (lidos < 0)
+        {
+            return -1;
+        }
+        if (lidos == 0)
+        {
+            return total;
+        }
+        replica->usado += lidos;
+        total += lidos;
+    }
+}
+
+static int aplicarPendentes(Replica *replica, Rodovia **lista)
+{
+    size_t posicao = 0;
+    int situacao = 0;
+    while (posicao < replica->usado)
+    {
+        Alteracao alteracao;
+        int lidos = decodificarAlteracao(replica->pendentes + posicao, replica->usado - posicao, &alteracao);
+        if (lidos <= 0)
+        {
+            situacao = lidos;
+            break;
+        }
+        aplicarAlteracao(lista, &alteracao);
+        replica->registros++;
+        posicao += lidos;
+    }
+    replica->usado -= posicao;
+    memmove(replica->pendentes, replica->pendentes + posicao, replica->usado);
+    return situacao;
+}
+
+static int carregarReplica(Replica *replica, Rodovia **lista, Grafo **grafo)
+{
+    if (replica->descritor >= 0)
+    {
+        close(replica->descritor);
+        replica->descritor = -1;
+    }
+
+    for (int tentativa = 0; tentativa < TENTATIVAS_INSTANTANEO; tentativa++, usleep(5000))
+    {
+        int descritor = open(replica->caminho, O_RDONLY | O_CLOEXEC);
+        unsigned char cabecalho[CABECALHO_ALIMENTACAO];
+        struct stat estado;
+        uint64_t geracao;
+        if (descritor < 0)
+        {
+            continue;
+        }
+        if (read(descritor, cabecalho, sizeof(cabecalho)) != sizeof(cabecalho) ||
+            memcmp(cabecalho, MARCA_ALIMENTACAO, 8) != 0 || fstat(descritor, &estado) != 0)
+        {
+            close(descritor);
+            continue;
+        }
+        memcpy(&geracao, cabecalho + 8, sizeof(uint64_t));
+
+        *lista = NULL;
+        if (lerGeracaoBase(replica->caminhoBase) != geracao ||
+            carregarRodoviasDeArquivo(lista, replica->caminhoBase) != RODOVIAS_OK ||
+            lerGeracaoBase(replica->caminhoBase) != geracao)
+        {
+            liberarMemoria(*lista);
+            close(descritor);
+            continue;
+        }
+
+        replica->descritor = descritor;
+        replica->inode = estado.st_ino;
+        replica->geracao = geracao;
+        replica->registros = 0;
+        replica->usado = 0;
+        if (lerNovosRegistros(replica) < 0 || aplicarPendentes(replica, lista) < 0)
+        {
+            liberarMemoria(*lista);
+            close(descritor);
+            replica->descritor = -1;
+            continue;
+        }
+
+        conectarRodovias(*lista);
+        *grafo = construirGrafo(*lista);
+        if (*grafo == NULL)
+        {
+            liberarMemoria(*lista);
+            close(descritor);
+            replica->descritor = -1;
+            return 0;
+        }
+        return 1;
+    }
+    return 0;
+}
+
+static void ressincronizarReplica(Replica *replica)
+{
+    Servidor *servidor = replica->servidor;
+    Rodovia *lista;
+    Grafo *grafo;
+    if (!carregarReplica(replica, &lista, &grafo))
+    {
+        return;
+    }
+
+    pthread_rwlock_wrlock(&servidor->travaDados);
+    Rodovia *listaAnterior = servidor->lista;
+    Grafo *grafoAnterior = servidor->grafo;
+    servidor->lista = lista;
+    servidor->grafo = grafo;
+    servidor->versao++;
+    servidor->geracao = replica->geracao;
+    servidor->registros = replica->registros;
+    pthread_rwlock_unlock(&servidor->travaDados);
+
+    liberarGrafo(grafoAnterior);
+    liberarMemoria(listaAnterior);
+}
+
+static void atualizarReplica(Replica *replica)
+{
+    Servidor *servidor = replica->servidor;
+    struct stat estado;
+    if (replica->descritor < 0 || (stat(replica->caminho, &estado) == 0 && estado.st_ino != replica->inode))
+    {
+        ressincronizarReplica(replica);
+        return;
+    }
+
+    int lidos = lerNovosRegistros(replica);
+    if (lidos <= 0)
+    {
+        return;
+    }
+
+    pthread_rwlock_wrlock(&servidor->travaDados);
+    int situacao = aplicarPendentes(replica, &servidor->lista);
+    conectarRodovias(servidor->lista);
+    Grafo *grafoAnterior = NULL;
+    Grafo *grafo = construirGrafo(servidor->lista);
+    if (grafo != NULL)
+    {
+        grafoAnterior = servidor->grafo;
+        servidor->grafo = grafo;
+    }
+    servidor->versao++;
+    servidor->registros = replica->registros;
+    pthread_rwlock_unlock(&servidor->travaDados);
+    liberarGrafo(grafoAnterior);
+
+    if (situacao < 0)
+    {
+        close(replica->descritor);
+        replica->descritor = -1;
+    }
+}
+
+static void *acompanharAlimentacao(void *argumento)
+{
+    Replica *replica = argumento;
+    struct pollfd eventos[2];
+    eventos[0].fd = replica->notificacao;
+    eventos[0].events = POLLIN;
+    eventos[1].fd = replica->aviso[0];
+    eventos[1].events = POLLIN;
+
+    for (;;)
+    {
+        int prontos = poll(eventos, 2, ESPERA_ALIMENTACAO_MS);
+        if (prontos > 0 && eventos[1].revents != 0)
+        {
+            return NULL;
+        }
+        if (prontos > 0 && (eventos[0].revents & POLLIN))
+        {
+            char descartados[4096];
+            while (read(replica->notificacao, descartados, sizeof(descartados)) > 0)
+            {
+            }
+        }
+        atualizarReplica(replica);
+    }
+}
+
+static int observarDiretorio(Replica *replica)
+{
+    char diretorio[256];
+    strcpy(diretorio, replica->caminho);
+    char *barra = strrchr(diretorio, '/');
+    if (barra == NULL)
+    {
+        strcpy(diretorio, ".");
+    }
+    else
+    {
+        barra[barra == diretorio ? 1 : 0] = '\0';
+    }
+
+    replica->notificacao = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    return replica->notificacao >= 0 &&
+           inotify_add_watch(replica->notificacao, diretorio, IN_MODIFY | IN_MOVED_TO | IN_CREATE) >= 0;
+}
+
+int executarReplica(char caminhoAlimentacao[], char caminhoSocket[], int quantidadeTrabalhadores)
+{
+    if (strlen(caminhoAlimentacao) >= 200)
+    {
+        printf("Erro: caminho das alterações '%s' muito longo!\n", caminhoAlimentacao);
+        return 1;
+    }
+
+    Servidor servidor;
+    iniciarServidor(&servidor);
+    Replica replica;
+    memset(&replica, 0, sizeof(replica));
+    replica.servidor = &servidor;
+    replica.descritor = -1;
+    replica.notificacao = -1;
+    replica.aviso[0] = replica.aviso[1] = -1;
+    strcpy(replica.caminho, caminhoAlimentacao);
+    snprintf(replica.caminhoBase, sizeof(replica.caminhoBase), "%s.base", caminhoAlimentacao);
+    obterKernelsNomes();
+
+    if (!carregarReplica(&replica, &servidor.lista, &servidor.grafo))
+    {
+        printf("Erro ao ler as alterações publicadas em '%s'!\n", caminhoAlimentacao);
+        liberarServidor(&servidor);
+        free(replica.pendentes);
+        return 1;
+    }
+    servidor.geracao = replica.geracao;
+    servidor.registros = replica.registros;
+    printf("Réplica carregada de '%s' (geração %llu, %ld alteração(ões) aplicadas).\n", caminhoAlimentacao,
+           (unsigned long long)replica.geracao, replica.registros);
+
+    int resultado = 1;
+    pthread_t acompanhamento;
+    sigset_t sinais, anteriores;
+    sigemptyset(&sinais);
+    sigaddset(&sinais, SIGINT);
+    sigaddset(&sinais, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sinais, &anteriores);
+    int acompanhando = observarDiretorio(&replica) && pipe2(replica.aviso, O_CLOEXEC) == 0 &&
+                       pthread_create(&acompanhamento, NULL, acompanharAlimentacao, &replica) == 0;
+    pthread_sigmask(SIG_SETMASK, &anteriores, NULL);
+
+    if (!acompanhando)
+    {
+        printf("Erro ao acompanhar as alterações de '%s'!\n", caminhoAlimentacao);
+    }
+    else
+    {
+        resultado = atenderClientes(&servidor, caminhoSocket, quantidadeTrabalhadores);
+        if (write(replica.aviso[1], "", 1) == 1)
+        {
+            pthread_join(acompanhamento, NULL);
+        }
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (replica.aviso[i] >= 0)
+        {
+            close(replica.aviso[i]);
+        }
+    }
+    if (replica.notificacao >= 0)
+    {
+        close(replica.notificacao);
+    }
+    if (replica.descritor >= 0)
+    {
+        close(replica.descritor);
+    }
+    free(replica.pendentes);
+    liberarServidor(&servidor);
+    if (resultado == 0)
+    {
+        printf("Réplica encerrada.\n");
+    }
+    return resultado;
+}
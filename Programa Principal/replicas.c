@@ -0,0 +1,331 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "estruturas.h"
+
+#define MAXIMO_REPLICAS 8
+#define RODOVIAS_REPLICAS 60
+#define CIDADES_REPLICAS 400
+
+typedef struct ClienteReplica
+{
+    pid_t processo;
+    FILE *entrada;
+    FILE *saida;
+} ClienteReplica;
+
+static double agoraSegundos(void)
+{
+    struct timespec instante;
+    clock_gettime(CLOCK_MONOTONIC, &instante);
+    return instante.tv_sec + instante.tv_nsec / 1e9;
+}
+
+static int iniciarReplica(ClienteReplica *cliente, char executavel[], char alimentacao[], char caminhoSocket[])
+{
+    cliente->processo = fork();
+    if (cliente->processo == 0)
+    {
+        int nulo = open("/dev/null", O_WRONLY);
+        if (nulo >= 0)
+        {
+            dup2(nulo, STDOUT_FILENO);
+            close(nulo);
+        }
+        execl(executavel, executavel, "--replica", alimentacao, caminhoSocket, "2", (char *)NULL);
+        _exit(127);
+    }
+    if (cliente->processo < 0)
+    {
+        return 0;
+    }
+
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    snprintf(endereco.sun_path, sizeof(endereco.sun_path), "%s", caminhoSocket);
+    for (int tentativa = 0; tentativa < 3000; tentativa++)
+    {
+        if (waitpid(cliente->processo, NULL, WNOHANG) == cliente->processo)
+        {
+            cliente->processo = -1;
+            return 0;
+        }
+        int descritor = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (descritor >= 0 && connect(descritor, (struct sockaddr *)&endereco, sizeof(endereco)) == 0)
+        {
+            cliente->entrada = fdopen(descritor, "r");
+            cliente->saida = fdopen(dup(descritor), "w");
+            return cliente->entrada != NULL && cliente->saida != NULL;
+        }
+        if (descritor >= 0)
+        {
+            close(descritor);
+        }
+        usleep(10000);
+    }
+    return 0;
+}
+
+static void encerrarReplica(ClienteReplica *cliente)
+{
+    if (cliente->entrada != NULL)
+    {
+        fclose(cliente->entrada);
+    }
+    if (cliente->saida != NULL)
+    {
+        fclose(cliente->saida);
+    }
+    if (cliente->processo > 0)
+    {
+        kill(cliente->processo, SIGTERM);
+        waitpid(cliente->processo, NULL, 0);
+    }
+}
+
+static int consultarReplica(ClienteReplica *cliente, char comando[], char resposta[], int tamanho)
+{
+    char cabecalho[256];
+    fprintf(cliente->saida, "%s\n", comando);
+    fflush(cliente->saida);
+    if (fgets(cabecalho, sizeof(cabecalho), cliente->entrada) == NULL)
+    {
+        return -1;
+    }
+    resposta[0] = '\0';
+    if (strcmp(cabecalho, "OK\t1\n") != 0)
+    {
+        return 0;
+    }
+    if (fgets(resposta, tamanho, cliente->entrada) == NULL)
+    {
+        return -1;
+    }
+    resposta[strcspn(resposta, "\n")] = '\0';
+    return 1;
+}
+
+static void alterarRede(RedeRodovias *rede, unsigned int *semente)
+{
+    char rodovia[50], cidade1[50], cidade2[50];
+    snprintf(rodovia, sizeof(rodovia), "BR-%d", rand_r(semente) % RODOVIAS_REPLICAS);
+    snprintf(cidade1, sizeof(cidade1), "Cidade %d", rand_r(semente) % CIDADES_REPLICAS);
+    snprintf(cidade2, sizeof(cidade2), "Cidade %d", rand_r(semente) % CIDADES_REPLICAS);
+
+    int escolha = rand_r(semente) % 100;
+    if (escolha < 10)
+    {
+        inserirRodoviaRede(rede, rodovia);
+    }
+    else if (escolha < 14)
+    {
+        removerRodoviaRede(rede, rodovia);
+    }
+    else if (escolha < 60)
+    {
+        inserirCidadeRede(rede, rodovia, cidade1, 1 + rand_r(semente) % 100000 / 100.0);
+    }
+    else if (escolha < 72)
+    {
+        removerCidadeRede(rede, rodovia, cidade1);
+    }
+    else if (escolha < 84)
+    {
+        definirPedagioRede(rede, rodovia, cidade1, cidade2, rand_r(semente) % 5000 / 100.0);
+    }
+    else if (escolha < 92)
+    {
+        InfoAtualizacaoTrecho atualizacao;
+        strcpy(atualizacao.rodovia, rodovia);
+        strcpy(atualizacao.cidade1, cidade1);
+        snprintf(atualizacao.cidade2, sizeof(atualizacao.cidade2), "Cidade %d",
+                 (atoi(cidade1 + 7) + 1) % CIDADES_REPLICAS);
+        atualizacao.distancia = rand_r(semente) % 2 ? 1 + rand_r(semente) % 100000 / 100.0 : -1;
+        atualizacao.pedagio = rand_r(semente) % 5000 / 100.0;
+        atualizarTrechosRede(rede, &atualizacao, 1, NULL);
+    }
+    else
+    {
+        definirTarifaRede(rede, rodovia, cidade1, cidade2, rand_r(semente) % MAXIMO_CLASSES_VEICULO,
+                          rand_r(semente) % MINUTOS_SEMANA, rand_r(semente) % 5000 / 100.0);
+    }
+}
+
+static int aguardarReplica(ClienteReplica *cliente, InfoAlimentacao *esperada)
+{
+    char resposta[256];
+    for (int tentativa = 0; tentativa < 10000; tentativa++)
+    {
+        unsigned long long geracao;
+        long registros;
+        if (consultarReplica(cliente, "VERSAO", resposta, sizeof(resposta)) != 1 ||
+            sscanf(resposta, "VERSAO\t%llu\t%ld", &geracao, &registros) != 2)
+        {
+            return 0;
+        }
+        if (geracao == esperada->geracao && registros == esperada->registros)
+        {
+            return 1;
+        }
+        usleep(1000);
+    }
+    return 0;
+}
+
+static long compararReplica(RedeRodovias *rede, ClienteReplica *cliente)
+{
+    long divergencias = 0;
+    for (int i = 0; i < RODOVIAS_REPLICAS; i++)
+    {
+        char comando[80], resposta[256], nome[50];
+        InfoRodovia info;
+        int cidades;
+        double pedagio;
+        snprintf(comando, sizeof(comando), "PEDAGIO\tBR-%d", i);
+        int situacao = consultarReplica(cliente, comando, resposta, sizeof(resposta));
+        int encontrada = buscarRodoviaRede(rede, comando + 8, &info) == RODOVIAS_OK;
+        if (situacao < 0)
+        {
+            return -1;
+        }
+        if (situacao != encontrada ||
+            (encontrada && (sscanf(resposta, "%49[^\t]\t%d\t%lf", nome, &cidades, &pedagio) != 3 ||
+                            cidades != info.numeroCidades || fabs(pedagio - info.pedagioTotal) > 0.005)))
+        {
+            if (divergencias++ == 0)
+            {
+                printf("Divergência em %s: escritor %d cidade(s) R$ %.2f, réplica '%s'\n", comando + 8,
+                       encontrada ? info.numeroCidades : -1, encontrada ? info.pedagioTotal : 0, resposta);
+            }
+        }
+    }
+    return divergencias;
+}
+
+static void removerArquivos(char base[])
+{
+    char caminho[300];
+    const char *sufixos[] = {"", ".diario", ".alt", ".alt.base"};
+    for (int i = 0; i < 4; i++)
+    {
+        snprintf(caminho, sizeof(caminho), "%s%s", base, sufixos[i]);
+        unlink(caminho);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        printf("Uso: %s <executavel rodovias> [rodadas] [replicas] [semente]\n", argv[0]);
+        return 1;
+    }
+    int rodadas = argc > 2 ? atoi(argv[2]) : 100;
+    int quantidadeReplicas = argc > 3 ? atoi(argv[3]) : 3;
+    unsigned int semente = argc > 4 ? (unsigned int)atoi(argv[4]) : 1;
+    if (rodadas < 1 || quantidadeReplicas < 1 || quantidadeReplicas > MAXIMO_REPLICAS)
+    {
+        printf("Uso: %s <executavel rodovias> [rodadas] [replicas] [semente]\n", argv[0]);
+        return 1;
+    }
+
+    char base[64], alimentacao[100];
+    snprintf(base, sizeof(base), "/tmp/replicas.%d", (int)getpid());
+    snprintf(alimentacao, sizeof(alimentacao), "%s.alt", base);
+
+    RedeRodovias *rede = criarRede();
+    if (rede == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        return 1;
+    }
+    abrirRede(rede, base, NULL);
+    for (int i = 0; i < 2000; i++)
+    {
+        alterarRede(rede, &semente);
+    }
+    if (salvarRede(rede, 1) != RODOVIAS_OK || publicarAlteracoesRede(rede, alimentacao) != RODOVIAS_OK)
+    {
+        printf("Erro ao publicar as alterações em '%s'!\n", alimentacao);
+        destruirRede(rede);
+        removerArquivos(base);
+        return 1;
+    }
+
+    ClienteReplica replicas[MAXIMO_REPLICAS] = {{0}};
+    int sucesso = 1;
+    fflush(stdout);
+    for (int i = 0; sucesso && i < quantidadeReplicas; i++)
+    {
+        char caminhoSocket[100];
+        snprintf(caminhoSocket, sizeof(caminhoSocket), "%s.%d", base, i);
+        sucesso = iniciarReplica(&replicas[i], argv[1], alimentacao, caminhoSocket);
+    }
+
+    long divergencias = 0, alteracoes = 0, rotacoes = 0;
+    double atrasoTotal = 0, atrasoMaximo = 0;
+    for (int rodada = 0; sucesso && rodada < rodadas; rodada++)
+    {
+        int quantidade = 1 + rand_r(&semente) % 50;
+        for (int i = 0; i < quantidade; i++)
+        {
+            alterarRede(rede, &semente);
+        }
+        alteracoes += quantidade;
+        if (rodada % 10 == 9)
+        {
+            sucesso = salvarRede(rede, 1) == RODOVIAS_OK;
+            rotacoes++;
+        }
+
+        InfoAlimentacao esperada;
+        consultarAlimentacaoRede(rede, &esperada);
+        double inicio = agoraSegundos();
+        for (int i = 0; sucesso && i < quantidadeReplicas; i++)
+        {
+            if (!aguardarReplica(&replicas[i], &esperada))
+            {
+                printf("Réplica %d não alcançou a geração %llu com %ld alteração(ões).\n", i, esperada.geracao,
+                       esperada.registros);
+                sucesso = 0;
+                break;
+            }
+            long encontradas = compararReplica(rede, &replicas[i]);
+            sucesso = encontradas >= 0;
+            divergencias += encontradas > 0 ? encontradas : 0;
+        }
+        double atraso = agoraSegundos() - inicio;
+        atrasoTotal += atraso;
+        atrasoMaximo = atraso > atrasoMaximo ? atraso : atrasoMaximo;
+    }
+
+    for (int i = 0; i < quantidadeReplicas; i++)
+    {
+        char caminhoSocket[100];
+        encerrarReplica(&replicas[i]);
+        snprintf(caminhoSocket, sizeof(caminhoSocket), "%s.%d", base, i);
+        unlink(caminhoSocket);
+    }
+    destruirRede(rede);
+    removerArquivos(base);
+
+    if (!sucesso)
+    {
+        printf("Falha ao executar a verificação das réplicas.\n");
+        return 1;
+    }
+    printf("%d rodadas, %ld alteração(ões), %ld rotação(ões), %d réplica(s), %ld divergência(s).\n", rodadas,
+           alteracoes, rotacoes, quantidadeReplicas, divergencias);
+    printf("Atraso de sincronização e verificação: médio %.1f ms, máximo %.1f ms\n", atrasoTotal * 1e3 / rodadas,
+           atrasoMaximo * 1e3);
+    return divergencias == 0 ? 0 : 1;
+}
@@ -0,0 +1,242 @@
+#ifndef RODOVIAS_H
+#define RODOVIAS_H
+
+#define MAXIMO_TRECHOS_ROTA 64
+#define MAXIMO_ROTAS_ALTERNATIVAS 8
+#define MINUTOS_SEMANA (7 * 24 * 60)
+#define PARTIDA_INDEFINIDA -1
+#define MAXIMO_CLASSES_VEICULO 10
+#define VELOCIDADE_REFERENCIA_KMH 80
+#define MAXIMO_PARADAS_ROTEIRO 64
+#define MAXIMO_RESTRICOES_ROTA 16
+
+typedef struct RedeRodovias RedeRodovias;
+
+enum StatusRodovias
+{
+    RODOVIAS_OK = 0,
+    RODOVIAS_ERRO_MEMORIA,
+    RODOVIAS_ERRO_ARQUIVO,
+    RODOVIAS_RODOVIA_EXISTENTE,
+    RODOVIAS_RODOVIA_NAO_ENCONTRADA,
+    RODOVIAS_CIDADE_EXISTENTE,
+    RODOVIAS_CIDADE_NAO_ENCONTRADA,
+    RODOVIAS_CIDADES_IGUAIS,
+    RODOVIAS_SEM_ROTA,
+    RODOVIAS_ARGUMENTO_INVALIDO
+};
+
+enum CriterioRota
+{
+    ROTA_PARETO = 0,
+    ROTA_PONDERADA
+};
+
+enum CriterioAlcance
+{
+    ALCANCE_DISTANCIA = 1,
+    ALCANCE_PEDAGIO
+};
+
+enum TipoNome
+{
+    NOME_RODOVIA = 1,
+    NOME_CIDADE
+};
+
+typedef struct InfoRodovia
+{
+    char nome[50];
+    int numeroCidades;
+    double pedagioTotal;
+} InfoRodovia;
+
+typedef struct InfoCidade
+{
+    char nome[50];
+    double distancia;
+    double pedagioIda;
+    double pedagioVolta;
+} InfoCidade;
+
+typedef struct InfoCruzamento
+{
+    char cidade[50];
+    double distancia1;
+    double distancia2;
+} InfoCruzamento;
+
+typedef struct InfoPercurso
+{
+    char rodoviaInicio[50];
+    char rodoviaFim[50];
+    char origem[50];
+    char destino[50];
+    char cidadeConexao[50];
+    double distancia;
+    double pedagio;
+} InfoPercurso;
+
+typedef struct InfoTrecho
+{
+    char rodovia[50];
+    char origem[50];
+    char destino[50];
+    double distancia;
+    double pedagio;
+} InfoTrecho;
+
+typedef struct InfoRota
+{
+    double distancia;
+    double pedagio;
+    int quantidadeTrechos;
+    InfoTrecho trechos[MAXIMO_TRECHOS_ROTA];
+} InfoRota;
+
+typedef struct InfoRotas
+{
+    char origem[50];
+    char destino[50];
+    int quantidade;
+    int truncada;
+    InfoRota rotas[MAXIMO_ROTAS_ALTERNATIVAS];
+} InfoRotas;
+
+typedef struct InfoInterdicao
+{
+    char rodovia[50];
+    char cidade1[50];
+    char cidade2[50];
+} InfoInterdicao;
+
+typedef struct InfoRestricoes
+{
+    int quantidadeInterdicoes;
+    InfoInterdicao interdicoes[MAXIMO_RESTRICOES_ROTA];
+    int quantidadeRodoviasEvitadas;
+    char rodoviasEvitadas[MAXIMO_RESTRICOES_ROTA][50];
+    double pedagioMaximoTrecho;
+} InfoRestricoes;
+
+typedef struct InfoAtualizacaoTrecho
+{
+    char rodovia[50];
+    char cidade1[50];
+    char cidade2[50];
+    double distancia;
+    double pedagio;
+} InfoAtualizacaoTrecho;
+
+typedef struct InfoParada
+{
+    char cidade[50];
+    double distancia;
+    double pedagio;
+} InfoParada;
+
+typedef struct InfoRoteiro
+{
+    int quantidadeParadas;
+    InfoParada paradas[MAXIMO_PARADAS_ROTEIRO + 2];
+    double distancia;
+    double pedagio;
+    double distanciaInicial;
+    long tentativas;
+} InfoRoteiro;
+
+typedef struct InfoAlcance
+{
+    char cidade[50];
+    double distancia;
+    double pedagio;
+} InfoAlcance;
+
+typedef struct InfoSugestao
+{
+    char nome[50];
+    int distancia;
+} InfoSugestao;
+
+typedef struct InfoPosicao
+{
+    double latitude;
+    double longitude;
+} InfoPosicao;
+
+typedef struct InfoCidadeProxima
+{
+    char cidade[50];
+    double latitude;
+    double longitude;
+    double distancia;
+} InfoCidadeProxima;
+
+typedef struct InfoAbertura
+{
+    int carregado;
+    int diarioAberto;
+    int recuperadas;
+    long bytesDescartados;
+} InfoAbertura;
+
+typedef struct InfoAlimentacao
+{
+    unsigned long long geracao;
+    long registros;
+} InfoAlimentacao;
+
+RedeRodovias *criarRede(void);
+int abrirRede(RedeRodovias *rede, const char *arquivo, InfoAbertura *info);
+int salvarRede(RedeRodovias *rede, int aguardar);
+int descartarAlteracoesRede(RedeRodovias *rede);
+int alteracoesPendentesRede(RedeRodovias *rede);
+int exportarRede(RedeRodovias *rede, const char *arquivo);
+int escreverRede(RedeRodovias *rede, int descritor);
+int publicarAlteracoesRede(RedeRodovias *rede, const char *caminho);
+int consultarAlimentacaoRede(RedeRodovias *rede, InfoAlimentacao *info);
+void destruirRede(RedeRodovias *rede);
+
+int inserirRodoviaRede(RedeRodovias *rede, const char *rodovia);
+int removerRodoviaRede(RedeRodovias *rede, const char *rodovia);
+int inserirCidadeRede(RedeRodovias *rede, const char *rodovia, const char *cidade, double distancia);
+int removerCidadeRede(RedeRodovias *rede, const char *rodovia, const char *cidade);
+int compactarRede(RedeRodovias *rede);
+int definirPedagioRede(RedeRodovias *rede, const char *rodovia, const char *cidade1, const char *cidade2, double valor);
+int atualizarTrechosRede(RedeRodovias *rede, const InfoAtualizacaoTrecho atualizacoes[], int quantidade,
+                         int *aplicadas);
+int definirTarifaRede(RedeRodovias *rede, const char *rodovia, const char *cidade1, const char *cidade2, int classe,
+                      int inicio, double valor);
+int definirCoordenadasRede(RedeRodovias *rede, const char *cidade, double latitude, double longitude);
+int interditarTrechoRede(RedeRodovias *rede, const char *rodovia, const char *cidade1, const char *cidade2,
+                         int interditar);
+int listarInterdicoesRede(RedeRodovias *rede, InfoInterdicao interdicoes[], int maximo, int *quantidade);
+
+int buscarRodoviaRede(RedeRodovias *rede, const char *rodovia, InfoRodovia *info);
+int listarRodoviasRede(RedeRodovias *rede, InfoRodovia rodovias[], int maximo, int *quantidade);
+int listarCidadesRede(RedeRodovias *rede, const char *rodovia, InfoCidade cidades[], int maximo, int *quantidade);
+int listarCruzamentosRede(RedeRodovias *rede, const char *rodovia1, const char *rodovia2,
+                          InfoCruzamento cruzamentos[], int maximo, int *quantidade);
+int localizarCidadeRede(RedeRodovias *rede, const char *rodovia, const char *cidade, int *posicao);
+int consultarPercursoRede(RedeRodovias *rede, const char *origem, const char *destino, InfoPercurso *percurso);
+int consultarPercursoTarifadoRede(RedeRodovias *rede, const char *origem, const char *destino, int partida, int classe,
+                                  InfoPercurso *percurso);
+int rotasAlternativasRede(RedeRodovias *rede, const char *origem, const char *destino, int criterio,
+                          double pesoDistancia, double pesoPedagio, InfoRotas *resultado);
+int rotasRestritasRede(RedeRodovias *rede, const char *origem, const char *destino, int criterio, double pesoDistancia,
+                       double pesoPedagio, const InfoRestricoes *restricoes, InfoRotas *resultado);
+int otimizarRoteiroRede(RedeRodovias *rede, const char *deposito, const char *cidades[], int quantidade,
+                        int tempoLimiteMs, InfoRoteiro *roteiro);
+int cidadesAlcancaveisRede(RedeRodovias *rede, const char *origem, int criterio, double limite,
+                           InfoAlcance cidades[], int maximo, int *quantidade);
+int completarNomesRede(RedeRodovias *rede, int tipo, const char *prefixo, InfoSugestao sugestoes[], int maximo,
+                       int *quantidade);
+int sugerirNomesRede(RedeRodovias *rede, int tipo, const char *nome, int distanciaMaxima, InfoSugestao sugestoes[],
+                     int maximo, int *quantidade);
+int cidadesMaisProximasRede(RedeRodovias *rede, const InfoPosicao pontos[], int quantidade,
+                            InfoCidadeProxima cidades[]);
+int cidadesNoRaioRede(RedeRodovias *rede, const InfoPosicao pontos[], int quantidade, double raio,
+                      InfoCidadeProxima cidades[], int maximoPorPonto, int quantidades[]);
+const char *descreverStatusRodovias(int status);
+
+#endif
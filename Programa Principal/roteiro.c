@@ -0,0 +1,260 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include "estruturas.h"
+
+#define CANDIDATOS_VIZINHO 3
+#define TAMANHO_MAXIMO_SEGMENTO 3
+#define MAXIMO_TENTATIVAS_ROTEIRO 20000
+
+static double agoraSegundos(void)
+{
+    struct timespec instante;
+    clock_gettime(CLOCK_MONOTONIC, &instante);
+    return instante.tv_sec + instante.tv_nsec / 1e9;
+}
+
+static double custoRoteiro(float custos[], int n, int ordem[])
+{
+    double total = 0;
+    for (int i = 0; i < n; i++)
+    {
+        total += custos[ordem[i] * n + ordem[(i + 1) % n]];
+    }
+    return total;
+}
+
+static void vizinhoMaisProximo(OtimizacaoRoteiro *otimizacao, int ordem[], unsigned char visitadas[],
+                               unsigned int *semente, int aleatorio)
+{
+    int n = otimizacao->quantidade;
+    memset(visitadas, 0, n);
+    ordem[0] = 0;
+    visitadas[0] = 1;
+    for (int i = 1; i < n; i++)
+    {
+        int candidatos[CANDIDATOS_VIZINHO], quantidade = 0;
+        for (int j = 0; j < n; j++)
+        {
+            if (visitadas[j])
+            {
+                continue;
+            }
+            float custo = otimizacao->custos[ordem[i - 1] * n + j];
+            int posicao = quantidade < CANDIDATOS_VIZINHO ? quantidade++ : CANDIDATOS_VIZINHO;
+            while (posicao > 0 && otimizacao->custos[ordem[i - 1] * n + candidatos[posicao - 1]] > custo)
+            {
+                if (posicao < CANDIDATOS_VIZINHO)
+                {
+                    candidatos[posicao] = candidatos[posicao - 1];
+                }
+                posicao--;
+            }
+            if (posicao < CANDIDATOS_VIZINHO)
+            {
+                candidatos[posicao] = j;
+            }
+        }
+        int escolhida = candidatos[aleatorio ? rand_r(semente) % quantidade : 0];
+        ordem[i] = escolhida;
+        visitadas[escolhida] = 1;
+    }
+}
+
+static int melhorarDoisOpt(float custos[], int n, int ordem[])
+{
+    int melhorou = 0;
+    for (int i = 0; i + 2 < n; i++)
+    {
+        int a = ordem[i], b = ordem[i + 1];
+        for (int j = i + 2; j < n; j++)
+        {
+            int c = ordem[j], e = ordem[(j + 1) % n];
+            if (e == a)
+            {
+                continue;
+            }
+            float delta = custos[a * n + c] + custos[b * n + e] - custos[a * n + b] - custos[c * n + e];
+            if (delta < -1e-4f)
+            {
+                for (int x = i + 1, y = j; x < y; x++, y--)
+                {
+                    int troca = ordem[x];
+                    ordem[x] = ordem[y];
+                    ordem[y] = troca;
+                }
+                b = ordem[i + 1];
+                melhorou = 1;
+            }
+        }
+    }
+    return melhorou;
+}
+
+static int melhorarOrOpt(float custos[], int n, int ordem[], int auxiliar[])
+{
+    int melhorou = 0;
+    for (int tamanho = 1; tamanho <= TAMANHO_MAXIMO_SEGMENTO; tamanho++)
+    {
+        for (int i = 1; i + tamanho <= n; i++)
+        {
+            int anterior = ordem[i - 1], primeira = ordem[i], ultima = ordem[i + tamanho - 1];
+            int seguinte = ordem[(i + tamanho) % n];
+            float remocao = custos[anterior * n + primeira] + custos[ultima * n + seguinte] -
+                            custos[anterior * n + seguinte];
+
+            int melhorPosicao = -1, invertido = 0;
+            float melhorDelta = -1e-4f;
+            for (int p = 0; p < n; p++)
+            {
+                if (p >= i - 1 && p < i + tamanho)
+                {
+                    continue;
+                }
+                int u = ordem[p], v = ordem[(p + 1) % n];
+                float direto = custos[u * n + primeira] + custos[ultima * n + v] - custos[u * n + v] - remocao;
+                float inverso = custos[u * n + ultima] + custos[primeira * n + v] - custos[u * n + v] - remocao;
+                if (direto < melhorDelta)
+                {
+                    melhorDelta = direto;
+                    melhorPosicao = p;
+                    invertido = 0;
+                }
+                if (inverso < melhorDelta)
+                {
+                    melhorDelta = inverso;
+                    melhorPosicao = p;
+                    invertido = 1;
+                }
+            }
+            if (melhorPosicao < 0)
+            {
+                continue;
+            }
+
+            int usados = 0;
+            for (int p = 0; p < n; p++)
+            {
+                if (p >= i && p < i + tamanho)
+                {
+                    continue;
+                }
+                auxiliar[usados++] = ordem[p];
+                if (p == melhorPosicao)
+                {
+                    for (int k = 0; k < tamanho; k++)
+                    {
+                        auxiliar[usados++] = ordem[invertido ? i + tamanho - 1 - k : i + k];
+                    }
+                }
+            }
+            memcpy(ordem, auxiliar, sizeof(int) * n);
+            melhorou = 1;
+        }
+    }
+    return melhorou;
+}
+
+static void *buscarRoteiros(void *argumento)
+{
+    OtimizacaoRoteiro *otimizacao = argumento;
+    int n = otimizacao->quantidade;
+    int *ordem = malloc(sizeof(int) * n);
+    int *auxiliar = malloc(sizeof(int) * n);
+    unsigned char *visitadas = malloc(n);
+    if (ordem == NULL || auxiliar == NULL || visitadas == NULL)
+    {
+        free(ordem);
+        free(auxiliar);
+        free(visitadas);
+        return NULL;
+    }
+
+    long tentativa;
+    unsigned int semente;
+    while ((tentativa = __atomic_fetch_add(&otimizacao->tentativas, 1, __ATOMIC_RELAXED)) == 0 ||
+           (tentativa < MAXIMO_TENTATIVAS_ROTEIRO && agoraSegundos() < otimizacao->prazo))
+    {
+        semente = otimizacao->semente ^ (unsigned int)(tentativa * 2654435761u);
+        vizinhoMaisProximo(otimizacao, ordem, visitadas, &semente, tentativa > 0);
+        if (tentativa == 0)
+        {
+            otimizacao->custoInicial = custoRoteiro(otimizacao->custos, n, ordem);
+        }
+        int melhorou = 1;
+        while (melhorou && agoraSegundos() < otimizacao->prazo)
+        {
+            melhorou = melhorarDoisOpt(otimizacao->custos, n, ordem);
+            melhorou |= melhorarOrOpt(otimizacao->custos, n, ordem, auxiliar);
+        }
+
+        double custo = custoRoteiro(otimizacao->custos, n, ordem);
+        pthread_mutex_lock(&otimizacao->trava);
+        if (custo < otimizacao->melhorCusto)
+        {
+            otimizacao->melhorCusto = custo;
+            memcpy(otimizacao->melhor, ordem, sizeof(int) * n);
+        }
+        pthread_mutex_unlock(&otimizacao->trava);
+    }
+
+    free(ordem);
+    free(auxiliar);
+    free(visitadas);
+    return NULL;
+}
+
+int otimizarRoteiro(Metros distancias[], int quantidade, int quantidadeThreads, double tempoLimite, int ordem[],
+                    long *tentativas, double *distanciaInicial)
+{
+    OtimizacaoRoteiro otimizacao;
+    memset(&otimizacao, 0, sizeof(otimizacao));
+    otimizacao.quantidade = quantidade;
+    otimizacao.melhor = ordem;
+    otimizacao.melhorCusto = INFINITY;
+    otimizacao.prazo = agoraSegundos() + tempoLimite;
+    otimizacao.semente = (unsigned int)quantidade * 40503u + 1;
+    otimizacao.custos = malloc(sizeof(float) * quantidade * quantidade);
+    if (otimizacao.custos == NULL)
+    {
+        return 0;
+    }
+    for (int i = 0; i < quantidade; i++)
+    {
+        for (int j = 0; j < quantidade; j++)
+        {
+            otimizacao.custos[i * quantidade + j] =
+                (float)metrosParaKm(distancias[i * quantidade + j] + distancias[j * quantidade + i]) / 2;
+        }
+    }
+    pthread_mutex_init(&otimizacao.trava, NULL);
+
+    if (quantidadeThreads < 1)
+    {
+        quantidadeThreads = 1;
+    }
+    pthread_t *threads = malloc(sizeof(pthread_t) * quantidadeThreads);
+    int iniciadas = 0;
+    for (int t = 1; threads != NULL && t < quantidadeThreads; t++)
+    {
+        if (pthread_create(&threads[iniciadas], NULL, buscarRoteiros, &otimizacao) == 0)
+        {
+            iniciadas++;
+        }
+    }
+    buscarRoteiros(&otimizacao);
+    for (int t = 0; t < iniciadas; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    free(threads);
+    free(otimizacao.custos);
+    pthread_mutex_destroy(&otimizacao.trava);
+    *tentativas = otimizacao.tentativas > iniciadas + 1 ? otimizacao.tentativas - iniciadas - 1 : 1;
+    *distanciaInicial = otimizacao.custoInicial;
+    return otimizacao.melhorCusto < INFINITY;
+}
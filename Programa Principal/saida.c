@@ -0,0 +1,308 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "estruturas.h"
+
+int iniciarBufferSaida(BufferSaida *saida, int descritor)
+{
+    saida->descritor = descritor;
+    saida->usado = 0;
+    saida->capacidade = TAMANHO_BUFFER_SAIDA;
+    saida->erro = 0;
+    saida->dados = malloc(TAMANHO_BUFFER_SAIDA);
+    if (saida->dados == NULL)
+    {
+        saida->erro = 1;
+        return 0;
+    }
+    return 1;
+}
+
+static void gravarTudo(BufferSaida *saida, const char *dados, size_t tamanho)
+{
+    size_t escritos = 0;
+    while (escritos < tamanho && !saida->erro)
+    {
+        ssize_t resultado = write(saida->descritor, dados + escritos, tamanho - escritos);
+        if (resultado < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            saida->erro = 1;
+            break;
+        }
+        escritos += resultado;
+    }
+}
+
+void descarregarSaida(BufferSaida *saida)
+{
+    if (saida->descritor < 0)
+    {
+        return;
+    }
+    gravarTudo(saida, saida->dados, saida->usado);
+    saida->usado = 0;
+}
+
+int finalizarBufferSaida(BufferSaida *saida)
+{
+    if (saida->dados != NULL)
+    {
+        descarregarSaida(saida);
+        free(saida->dados);
+        saida->dados = NULL;
+    }
+    return saida->erro ? -1 : 0;
+}
+
+int sincronizarDiretorio(const char *caminho)
+{
+    char diretorio[300];
+    const char *barra = strrchr(caminho, '/');
+    size_t tamanho = barra == NULL ? 1 : barra == caminho ? 1 : (size_t)(barra - caminho);
+    if (tamanho >= sizeof(diretorio))
+    {
+        return -1;
+    }
+    memcpy(diretorio, barra == NULL ? "." : caminho, tamanho);
+    diretorio[tamanho] = '\0';
+
+    int descritor = open(diretorio, O_RDONLY | O_DIRECTORY);
+    if (descritor < 0)
+    {
+        return -1;
+    }
+    int resultado = fsync(descritor);
+    close(descritor);
+    return resultado;
+}
+
+__attribute__((noinline)) static void gravarDireto(BufferSaida *saida, const char *dados, size_t tamanho)
+{
+    gravarTudo(saida, dados, tamanho);
+}
+
+void saidaBytes(BufferSaida *saida, const char *dados, size_t tamanho)
+{
+    if (saida->dados == NULL)
+    {
+        return;
+    }
+    if (saida->usado + tamanho > saida->capacidade && saida->descritor < 0)
+    {
+        size_t capacidade = saida->capacidade * 2 > saida->usado + tamanho ? saida->capacidade * 2
+                                                                             : saida->usado + tamanho;
+        char *maiores = realloc(saida->dados, capacidade);
+        if (maiores == NULL)
+        {
+            saida->erro = 1;
+            return;
+        }
+        saida->dados = maiores;
+        saida->capacidade = capacidade;
+    }
+    if (saida->usado + tamanho > saida->capacidade)
+    {
+        descarregarSaida(saida);
+        if (tamanho > saida->capacidade)
+        {
+            gravarDireto(saida, dados, tamanho);
+            return;
+        }
+    }
+    memcpy(saida->dados + saida->usado, dados, tamanho);
+    saida->usado += tamanho;
+}
+
+void saidaTexto(BufferSaida *saida, const char *texto)
+{
+    saidaBytes(saida, texto, strlen(texto));
+}
+
+void saidaInteiro(BufferSaida *saida, long long valor)
+{
+    char digitos[24];
+    int posicao = sizeof(digitos);
+    unsigned long long absoluto = valor < 0 ? 0ULL - (unsigned long long)valor : (unsigned long long)valor;
+
+    do
+    {
+        digitos[--posicao] = (char)('0' + absoluto % 10);
+        absoluto /= 10;
+    } while (absoluto > 0);
+
+    if (valor < 0)
+    {
+        digitos[--posicao] = '-';
+    }
+    saidaBytes(saida, digitos + posicao, sizeof(digitos) - posicao);
+}
+
+static void saidaFracao(BufferSaida *saida, unsigned long long unidades, int casas, int negativo)
+{
+    char texto[32];
+    int posicao = sizeof(texto);
+    for (int i = 0; i < casas; i++)
+    {
+        texto[--posicao] = (char)('0' + unidades % 10);
+        unidades /= 10;
+    }
+    texto[--posicao] = '.';
+    do
+    {
+        texto[--posicao] = (char)('0' + unidades % 10);
+        unidades /= 10;
+    } while (unidades > 0);
+
+    if (negativo)
+    {
+        texto[--posicao] = '-';
+    }
+    saidaBytes(saida, texto + posicao, sizeof(texto) - posicao);
+}
+
+void saidaDecimal(BufferSaida *saida, float valor)
+{
+    double centesimos = fabs((double)valor) * 100.0;
+    if (!isfinite(centesimos) || centesimos >= 9e15)
+    {
+        char texto[64];
+        int tamanho = snprintf(texto, sizeof(texto), "%.2f", valor);
+        saidaBytes(saida, texto, tamanho);
+        return;
+    }
+
+    double inteiro = floor(centesimos);
+    double resto = centesimos - inteiro;
+    long long arredondado = (long long)inteiro;
+    if (resto > 0.5 || (resto == 0.5 && (arredondado & 1)))
+    {
+        arredondado++;
+    }
+    saidaFracao(saida, arredondado, 2, signbit(valor));
+}
+
+void saidaCentavos(BufferSaida *saida, Centavos valor)
+{
+    unsigned long long absoluto = valor < 0 ? -(unsigned long long)valor : (unsigned long long)valor;
+    saidaFracao(saida, absoluto, 2, valor < 0);
+}
+
+void saidaMetros(BufferSaida *saida, Metros distancia)
+{
+    unsigned long long absoluto = distancia < 0 ? -(unsigned long long)distancia : (unsigned long long)distancia;
+    unsigned long long centesimos = absoluto / 10;
+    unsigned long long resto = absoluto % 10;
+    if (resto > 5 || (resto == 5 && (centesimos & 1)))
+    {
+        centesimos++;
+    }
+    saidaFracao(saida, centesimos, 2, distancia < 0);
+}
+
+static void saidaMetrosExatos(BufferSaida *saida, Metros distancia)
+{
+    unsigned long long absoluto = distancia < 0 ? -(unsigned long long)distancia : (unsigned long long)distancia;
+    saidaFracao(saida, absoluto, 3, distancia < 0);
+}
+
+void saidaMicrograus(BufferSaida *saida, Micrograus valor)
+{
+    unsigned long long absoluto = valor < 0 ? -(long long)valor : valor;
+    saidaFracao(saida, absoluto, 6, valor < 0);
+}
+
+static void saidaDoisDigitos(BufferSaida *saida, int valor)
+{
+    char digitos[2] = {'0' + valor / 10, '0' + valor % 10};
+    saidaBytes(saida, digitos, 2);
+}
+
+static void escreverTarifas(BufferSaida *saida, TabelaTarifas *tabela, int formatoArquivo)
+{
+    for (int i = 0; i < tabela->quantidade; i++)
+    {
+        FaixaTarifa *faixa = &tabela->faixas[i];
+        saidaTexto(saida, formatoArquivo ? "\t\tTarifa: Classe " : "\tTarifa: Classe ");
+        saidaInteiro(saida, faixa->classe);
+        saidaTexto(saida, ", Dia ");
+        saidaInteiro(saida, faixa->inicio / (24 * 60));
+        saidaTexto(saida, ", ");
+        saidaDoisDigitos(saida, faixa->inicio / 60 % 24);
+        saidaTexto(saida, ":");
+        saidaDoisDigitos(saida, faixa->inicio % 60);
+        saidaTexto(saida, ", R$ ");
+        saidaCentavos(saida, faixa->valor);
+        saidaTexto(saida, "\n");
+    }
+}
+
+void escreverRodovia(BufferSaida *saida, Rodovia *rodovia, int formatoArquivo)
+{
+    Centavos pedagioTotal = calcularPedagioTotal(rodovia);
+
+    saidaTexto(saida, "Rodovia: ");
+    saidaTexto(saida, rodovia->nome);
+    saidaTexto(saida, formatoArquivo ? "\nPedágio: R$ " : "\nPedágio Total: R$ ");
+    saidaCentavos(saida, pedagioTotal);
+    saidaTexto(saida, "\n");
+
+    for (Cidade *cidadeAtual = rodovia->cidades; cidadeAtual != NULL; cidadeAtual = cidadeAtual->proxima)
+    {
+        Centavos ida = 0, volta = PEDAGIO_INDEFINIDO;
+        if (cidadeAtual->anterior != NULL)
+        {
+            ida = rodovia->pedagiosIda[cidadeAtual->anterior->indice];
+            volta = rodovia->pedagiosVolta[cidadeAtual->anterior->indice];
+        }
+
+        saidaTexto(saida, formatoArquivo ? "\tCidade: " : "Cidade: ");
+        saidaTexto(saida, cidadeAtual->nomeCidade);
+        saidaTexto(saida, ", Distância: ");
+        if (formatoArquivo)
+        {
+            saidaMetrosExatos(saida, cidadeAtual->distancia);
+        }
+        else
+        {
+            saidaMetros(saida, cidadeAtual->distancia);
+        }
+        saidaTexto(saida, ", Pedágio: R$ ");
+        saidaCentavos(saida, ida);
+        if (volta != PEDAGIO_INDEFINIDO)
+        {
+            saidaTexto(saida, ", Volta: R$ ");
+            saidaCentavos(saida, volta);
+        }
+        saidaTexto(saida, "\n");
+
+        if (cidadeAtual->latitude != COORDENADA_INDEFINIDA)
+        {
+            saidaTexto(saida, formatoArquivo ? "\t\tCoordenadas: " : "\tCoordenadas: ");
+            saidaMicrograus(saida, cidadeAtual->latitude);
+            saidaTexto(saida, ", ");
+            saidaMicrograus(saida, cidadeAtual->longitude);
+            saidaTexto(saida, "\n");
+        }
+        if (cidadeAtual->anterior != NULL && rodovia->tarifas != NULL)
+        {
+            escreverTarifas(saida, &rodovia->tarifas[cidadeAtual->anterior->indice], formatoArquivo);
+        }
+    }
+    saidaTexto(saida, "\n");
+}
+
+void escreverRodovias(BufferSaida *saida, Rodovia *lista, int formatoArquivo)
+{
+    for (Rodovia *rodoviaAtual = lista; rodoviaAtual != NULL; rodoviaAtual = rodoviaAtual->proxima)
+    {
+        escreverRodovia(saida, rodoviaAtual, formatoArquivo);
+    }
+}
@@ -0,0 +1,947 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "estruturas.h"
+
+#define MAXIMO_CAMPOS 6
+#define MAXIMO_EVENTOS 64
+
+static volatile sig_atomic_t sinalEncerramento = 0;
+
+static void tratarSinal(int sinal)
+{
+    (void)sinal;
+    sinalEncerramento = 1;
+}
+
+static int separarCampos(char linha[], char *campos[])
+{
+    int quantidade = 0;
+    char *inicio = linha;
+    while (quantidade < MAXIMO_CAMPOS)
+    {
+        campos[quantidade++] = inicio;
+        char *tabulacao = strchr(inicio, '\t');
+        if (tabulacao == NULL)
+        {
+            break;
+        }
+        *tabulacao = '\0';
+        inicio = tabulacao + 1;
+    }
+    return quantidade;
+}
+
+static void responderErro(BufferSaida *saida, const char *mensagem)
+{
+    saidaTexto(saida, "ERRO\t");
+    saidaTexto(saida, mensagem);
+    saidaTexto(saida, "\n");
+}
+
+static void responderCabecalho(BufferSaida *saida, int linhas)
+{
+    saidaTexto(saida, "OK\t");
+    saidaInteiro(saida, linhas);
+    saidaTexto(saida, "\n");
+}
+
+static int lerTarifacao(char *campos[], int *partida, int *classe)
+{
+    char *fimPartida, *fimClasse;
+    long minuto = strtol(campos[0], &fimPartida, 10);
+    long valor = strtol(campos[1], &fimClasse, 10);
+    if (fimPartida == campos[0] || *fimPartida != '\0' || minuto < 0 || minuto >= MINUTOS_SEMANA ||
+        fimClasse == campos[1] || *fimClasse != '\0' || valor < 0 || valor >= MAXIMO_CLASSES_VEICULO)
+    {
+        return 0;
+    }
+    *partida = (int)minuto;
+    *classe = (int)valor;
+    return 1;
+}
+
+static Metros responderTrecho(BufferSaida *saida, Rodovia *rodovia, char origem[], char destino[], int partida,
+                              int classe)
+{
+    Centavos pedagio;
+    Metros distancia;
+    somarPercursoTarifado(rodovia, origem, destino, partida, classe, &pedagio, &distancia);
+
+    saidaTexto(saida, "TRECHO\t");
+    saidaTexto(saida, rodovia->nome);
+    saidaTexto(saida, "\t");
+    saidaTexto(saida, origem);
+    saidaTexto(saida, "\t");
+    saidaTexto(saida, destino);
+    saidaTexto(saida, "\t");
+    saidaMetros(saida, distancia);
+    saidaTexto(saida, "\t");
+    saidaCentavos(saida, pedagio);
+    saidaTexto(saida, "\n");
+    return distancia;
+}
+
+static void consultarRota(BufferSaida *saida, Rodovia *lista, char origem[], char destino[], int partida, int classe)
+{
+    ResultadoPercurso resultado;
+    int situacao = consultarPercurso(lista, origem, destino, partida, classe, &resultado);
+    if (situacao == CONSULTA_CIDADE_NAO_ENCONTRADA)
+    {
+        responderErro(saida, "cidade de início ou fim não encontrada");
+        return;
+    }
+    if (situacao == CONSULTA_SEM_ROTA)
+    {
+        responderErro(saida, "nenhuma rota direta entre as cidades");
+        return;
+    }
+
+    int conexao = resultado.cidadeConexao[0] != '\0';
+    responderCabecalho(saida, conexao ? 3 : 2);
+    if (conexao)
+    {
+        Metros distancia = responderTrecho(saida, resultado.rodoviaInicio, resultado.origem, resultado.cidadeConexao,
+                                           partida, classe);
+        responderTrecho(saida, resultado.rodoviaFim, resultado.cidadeConexao, resultado.destino,
+                        minutoDePassagem(partida, distancia), classe);
+    }
+    else
+    {
+        responderTrecho(saida, resultado.rodoviaInicio, resultado.origem, resultado.destino, partida, classe);
+    }
+
+    saidaTexto(saida, "TOTAL\t");
+    saidaMetros(saida, resultado.distancia);
+    saidaTexto(saida, "\t");
+    saidaCentavos(saida, resultado.pedagio);
+    saidaTexto(saida, "\n");
+}
+
+static void consultarCruzamentos(BufferSaida *saida, Rodovia *lista, char nome1[], char nome2[])
+{
+    Rodovia *rodovia1 = buscarRodovia(lista, nome1);
+    Rodovia *rodovia2 = buscarRodovia(lista, nome2);
+    if (rodovia1 == NULL || rodovia2 == NULL)
+    {
+        responderErro(saida, "uma ou ambas as rodovias não foram encontradas");
+        return;
+    }
+
+    int quantidade = 0;
+    for (int etapa = 0; etapa < 2; etapa++)
+    {
+        if (etapa == 1)
+        {
+            responderCabecalho(saida, quantidade);
+        }
+        for (Cidade *c1 = rodovia1->cidades; c1 != NULL; c1 = c1->proxima)
+        {
+            for (Cidade *c2 = rodovia2->cidades; c2 != NULL; c2 = c2->proxima)
+            {
+                if (!mesmaChave(c1->hash, c1->chave, c2->hash, c2->chave))
+                {
+                    continue;
+                }
+                if (etapa == 0)
+                {
+                    quantidade++;
+                    continue;
+                }
+                saidaTexto(saida, c1->nomeCidade);
+                saidaTexto(saida, "\t");
+                saidaMetros(saida, c1->distancia);
+                saidaTexto(saida, "\t");
+                saidaMetros(saida, c2->distancia);
+                saidaTexto(saida, "\n");
+            }
+        }
+    }
+}
+
+static void consultarCidade(BufferSaida *saida, Rodovia *lista, char nomeCidade[])
+{
+    int quantidade = 0;
+    for (int etapa = 0; etapa < 2; etapa++)
+    {
+        if (etapa == 1)
+        {
+            if (quantidade == 0)
+            {
+                responderErro(saida, "cidade não encontrada");
+                return;
+            }
+            responderCabecalho(saida, quantidade);
+        }
+        for (Rodovia *r = lista; r != NULL; r = r->proxima)
+        {
+            Cidade *cidade = buscarCidade(r, nomeCidade);
+            if (cidade == NULL)
+            {
+                continue;
+            }
+            if (etapa == 0)
+            {
+                quantidade++;
+                continue;
+            }
+            saidaTexto(saida, r->nome);
+            saidaTexto(saida, "\t");
+            saidaTexto(saida, cidade->nomeCidade);
+            saidaTexto(saida, "\t");
+            saidaMetros(saida, cidade->distancia);
+            saidaTexto(saida, "\n");
+        }
+    }
+}
+
+static void consultarPedagio(BufferSaida *saida, Rodovia *lista, char *campos[], int quantidadeCampos)
+{
+    Rodovia *rodovia = buscarRodovia(lista, campos[1]);
+    if (rodovia == NULL)
+    {
+        responderErro(saida, "rodovia não encontrada");
+        return;
+    }
+
+    if (quantidadeCampos == 2)
+    {
+        responderCabecalho(saida, 1);
+        saidaTexto(saida, rodovia->nome);
+        saidaTexto(saida, "\t");
+        saidaInteiro(saida, rodovia->numeroCidades);
+        saidaTexto(saida, "\t");
+        saidaCentavos(saida, calcularPedagioTotal(rodovia));
+        saidaTexto(saida, "\n");
+        return;
+    }
+
+    int partida = PARTIDA_INDEFINIDA, classe = 0;
+    if (quantidadeCampos == 6 && !lerTarifacao(&campos[4], &partida, &classe))
+    {
+        responderErro(saida, "horário ou classe inválidos");
+        return;
+    }
+    if ((quantidadeCampos != 4 && quantidadeCampos != 6) || buscarCidade(rodovia, campos[2]) == NULL ||
+        buscarCidade(rodovia, campos[3]) == NULL)
+    {
+        responderErro(saida, "uma ou ambas as cidades não foram encontradas na rodovia");
+        return;
+    }
+    responderCabecalho(saida, 1);
+    responderTrecho(saida, rodovia, campos[2], campos[3], partida, classe);
+}
+
+static void responderAlcancadas(BufferSaida *saida, Grafo *grafo, BuscaAlcance *busca, int quantidade)
+{
+    for (int i = 0; i < quantidade; i++)
+    {
+        CidadeAlcancada *alcancada = &busca->alcancadas[i];
+        saidaTexto(saida, grafo->nomes[alcancada->vertice]);
+        saidaTexto(saida, "\t");
+        saidaMetros(saida, alcancada->distancia);
+        saidaTexto(saida, "\t");
+        saidaCentavos(saida, alcancada->pedagio);
+        saidaTexto(saida, "\n");
+    }
+}
+
+static void consultarAlcance(BufferSaida *saida, Servidor *servidor, BuscaAlcance *busca, char *campos[])
+{
+    Grafo *grafo = servidor->grafo;
+    int origem = buscarVertice(grafo, campos[1]);
+    int criterio = strcmp(campos[2], "KM") == 0 ? ALCANCE_DISTANCIA : strcmp(campos[2], "RS") == 0 ? ALCANCE_PEDAGIO : 0;
+    char *fim;
+    double limite = strtod(campos[3], &fim);
+
+    if (origem < 0)
+    {
+        responderErro(saida, "cidade não encontrada");
+        return;
+    }
+    if (criterio == 0 || fim == campos[3] || *fim != '\0' || !(limite >= 0))
+    {
+        responderErro(saida, "limite inválido");
+        return;
+    }
+
+    int unidades = criterio == ALCANCE_PEDAGIO ? CENTAVOS_POR_REAL : METROS_POR_KM;
+    int quantidade = buscarAlcance(busca, origem, criterio, limiteEmUnidades(limite, unidades));
+    responderCabecalho(saida, quantidade);
+    responderAlcancadas(saida, grafo, busca, quantidade);
+}
+
+static void consultarFronteira(BufferSaida *saida, Servidor *servidor, BuscaAlcance *busca, char *campos[],
+                               int quantidadeCampos)
+{
+    Grafo *grafo = servidor->grafo;
+    int origem = buscarVertice(grafo, campos[1]);
+    int destino = quantidadeCampos == 4 ? buscarVertice(grafo, campos[3]) : -1;
+    int reverso = strcmp(campos[2], "CHEGADA") == 0;
+    if (origem < 0)
+    {
+        responderErro(saida, "cidade não encontrada");
+        return;
+    }
+    if (!reverso && strcmp(campos[2], "SAIDA") != 0)
+    {
+        responderErro(saida, "sentido inválido");
+        return;
+    }
+
+    int alvos = 0;
+    for (int i = 0; i < servidor->quantidadeFronteiras; i++)
+    {
+        busca->alvos[servidor->fronteiras[i]] = 1;
+        alvos++;
+    }
+    if (destino >= 0 && !busca->alvos[destino])
+    {
+        busca->alvos[destino] = 1;
+        alvos++;
+    }
+    busca->quantidadeAlvos = alvos;
+    busca->reverso = reverso;
+
+    int quantidade = buscarAlcance(busca, origem, ALCANCE_DISTANCIA, CUSTO_INFINITO);
+    int marcadas = 0;
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (busca->alvos[busca->alcancadas[i].vertice])
+        {
+            busca->alcancadas[marcadas++] = busca->alcancadas[i];
+        }
+    }
+    responderCabecalho(saida, marcadas);
+    responderAlcancadas(saida, grafo, busca, marcadas);
+
+    for (int i = 0; i < servidor->quantidadeFronteiras; i++)
+    {
+        busca->alvos[servidor->fronteiras[i]] = 0;
+    }
+    if (destino >= 0)
+    {
+        busca->alvos[destino] = 0;
+    }
+    busca->quantidadeAlvos = 0;
+    busca->reverso = 0;
+}
+
+static void consultarDistancia(BufferSaida *saida, Servidor *servidor, BuscaAlcance *busca, char origem[],
+                               char destino[])
+{
+    Metros distancia;
+    Centavos pedagio;
+    int situacao;
+    if (servidor->coordenador != NULL)
+    {
+        double km, reais;
+        situacao = distanciaCoordenada(servidor->coordenador, origem, destino, &km, &reais);
+        distancia = situacao == CONSULTA_OK ? kmParaMetros(km) : 0;
+        pedagio = situacao == CONSULTA_OK ? reaisParaCentavos(reais) : 0;
+    }
+    else
+    {
+        int inicio = buscarVertice(servidor->grafo, origem);
+        int fim = buscarVertice(servidor->grafo, destino);
+        situacao = inicio < 0 || fim < 0 ? CONSULTA_CIDADE_NAO_ENCONTRADA : CONSULTA_SEM_ROTA;
+        if (situacao == CONSULTA_SEM_ROTA)
+        {
+            busca->alvos[fim] = 1;
+            busca->quantidadeAlvos = 1;
+            int quantidade = buscarAlcance(busca, inicio, ALCANCE_DISTANCIA, CUSTO_INFINITO);
+            busca->alvos[fim] = 0;
+            busca->quantidadeAlvos = 0;
+            if (quantidade > 0 && busca->alcancadas[quantidade - 1].vertice == fim)
+            {
+                situacao = CONSULTA_OK;
+                distancia = busca->alcancadas[quantidade - 1].distancia;
+                pedagio = busca->alcancadas[quantidade - 1].pedagio;
+            }
+        }
+    }
+
+    if (situacao == CONSULTA_CIDADE_NAO_ENCONTRADA)
+    {
+        responderErro(saida, "cidade de início ou fim não encontrada");
+        return;
+    }
+    if (situacao == CONSULTA_SEM_ROTA)
+    {
+        responderErro(saida, "nenhuma rota entre as cidades");
+        return;
+    }
+    responderCabecalho(saida, 1);
+    saidaTexto(saida, "TOTAL\t");
+    saidaMetros(saida, distancia);
+    saidaTexto(saida, "\t");
+    saidaCentavos(saida, pedagio);
+    saidaTexto(saida, "\n");
+}
+
+static void processarComando(BufferSaida *saida, Servidor *servidor, BuscaAlcance *busca, char linha[])
+{
+    Rodovia *lista = servidor->lista;
+    char *campos[MAXIMO_CAMPOS];
+    linha[strcspn(linha, "\r")] = '\0';
+    int quantidade = separarCampos(linha, campos);
+
+    if (strcmp(campos[0], "PING") == 0)
+    {
+        responderCabecalho(saida, 0);
+    }
+    else if (strcmp(campos[0], "VERSAO") == 0 && quantidade == 1)
+    {
+        responderCabecalho(saida, 1);
+        saidaTexto(saida, "VERSAO\t");
+        saidaInteiro(saida, (long long)servidor->geracao);
+        saidaTexto(saida, "\t");
+        saidaInteiro(saida, servidor->registros);
+        saidaTexto(saida, "\n");
+    }
+    else if (strcmp(campos[0], "DISTANCIA") == 0 && quantidade == 3)
+    {
+        consultarDistancia(saida, servidor, busca, campos[1], campos[2]);
+    }
+    else if (servidor->grafo == NULL)
+    {
+        responderErro(saida, "comando inválido");
+    }
+    else if (strcmp(campos[0], "FRONTEIRA") == 0 && (quantidade == 3 || quantidade == 4))
+    {
+        consultarFronteira(saida, servidor, busca, campos, quantidade);
+    }
+    else if (strcmp(campos[0], "ROTA") == 0 && quantidade == 3)
+    {
+        consultarRota(saida, lista, campos[1], campos[2], PARTIDA_INDEFINIDA, 0);
+    }
+    else if (strcmp(campos[0], "ROTA") == 0 && quantidade == 5)
+    {
+        int partida, classe;
+        if (lerTarifacao(&campos[3], &partida, &classe))
+        {
+            consultarRota(saida, lista, campos[1], campos[2], partida, classe);
+        }
+        else
+        {
+            responderErro(saida, "horário ou classe inválidos");
+        }
+    }
+    else if (strcmp(campos[0], "CRUZAMENTOS") == 0 && quantidade == 3)
+    {
+        consultarCruzamentos(saida, lista, campos[1], campos[2]);
+    }
+    else if (strcmp(campos[0], "CIDADE") == 0 && quantidade == 2)
+    {
+        consultarCidade(saida, lista, campos[1]);
+    }
+    else if (strcmp(campos[0], "ALCANCE") == 0 && quantidade == 4)
+    {
+        consultarAlcance(saida, servidor, busca, campos);
+    }
+    else if (strcmp(campos[0], "PEDAGIO") == 0 && quantidade >= 2)
+    {
+        consultarPedagio(saida, lista, campos, quantidade);
+    }
+    else
+    {
+        responderErro(saida, "comando inválido");
+    }
+}
+
+static void enfileirarConexao(Servidor *servidor, ConexaoServidor *conexao)
+{
+    pthread_mutex_lock(&servidor->trava);
+    conexao->proxima = NULL;
+    if (servidor->ultimaPendente != NULL)
+    {
+        servidor->ultimaPendente->proxima = conexao;
+    }
+    else
+    {
+        servidor->primeiraPendente = conexao;
+    }
+    servidor->ultimaPendente = conexao;
+    pthread_cond_signal(&servidor->sinal);
+    pthread_mutex_unlock(&servidor->trava);
+}
+
+static ConexaoServidor *retirarConexao(Servidor *servidor)
+{
+    pthread_mutex_lock(&servidor->trava);
+    while (servidor->primeiraPendente == NULL && !servidor->encerrando)
+    {
+        pthread_cond_wait(&servidor->sinal, &servidor->trava);
+    }
+
+    ConexaoServidor *conexao = servidor->primeiraPendente;
+    if (conexao != NULL)
+    {
+        servidor->primeiraPendente = conexao->proxima;
+        if (servidor->primeiraPendente == NULL)
+        {
+            servidor->ultimaPendente = NULL;
+        }
+    }
+    pthread_mutex_unlock(&servidor->trava);
+    return conexao;
+}
+
+static void registrarConexao(Servidor *servidor, ConexaoServidor *conexao)
+{
+    pthread_mutex_lock(&servidor->trava);
+    conexao->anteriorAtiva = NULL;
+    conexao->proximaAtiva = servidor->ativas;
+    if (servidor->ativas != NULL)
+    {
+        servidor->ativas->anteriorAtiva = conexao;
+    }
+    servidor->ativas = conexao;
+    pthread_mutex_unlock(&servidor->trava);
+}
+
+static void encerrarConexao(Servidor *servidor, ConexaoServidor *conexao)
+{
+    pthread_mutex_lock(&servidor->trava);
+    if (conexao->anteriorAtiva != NULL)
+    {
+        conexao->anteriorAtiva->proximaAtiva = conexao->proximaAtiva;
+    }
+    else
+    {
+        servidor->ativas = conexao->proximaAtiva;
+    }
+    if (conexao->proximaAtiva != NULL)
+    {
+        conexao->proximaAtiva->anteriorAtiva = conexao->anteriorAtiva;
+    }
+    pthread_mutex_unlock(&servidor->trava);
+    close(conexao->descritor);
+    free(conexao->pendente);
+    free(conexao);
+}
+
+static int atenderConexao(Servidor *servidor, ConexaoServidor *conexao, BufferSaida *saida, BuscaAlcance *busca)
+{
+    ssize_t lidos;
+    do
+    {
+        lidos = read(conexao->descritor, conexao->entrada + conexao->usado,
+                     TAMANHO_ENTRADA_SERVIDOR - conexao->usado);
+    } while (lidos < 0 && errno == EINTR);
+
+    if (lidos < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        return 1;
+    }
+    if (lidos <= 0)
+    {
+        return 0;
+    }
+    conexao->usado += lidos;
+
+    char *inicio = conexao->entrada;
+    char *fim = conexao->entrada + conexao->usado;
+    char *quebra;
+    while ((quebra = memchr(inicio, '\n', fim - inicio)) != NULL)
+    {
+        *quebra = '\0';
+        processarComando(saida, servidor, busca, inicio);
+        inicio = quebra + 1;
+    }
+
+    conexao->usado = fim - inicio;
+    memmove(conexao->entrada, inicio, conexao->usado);
+    if (conexao->usado == TAMANHO_ENTRADA_SERVIDOR)
+    {
+        responderErro(saida, "linha muito longa");
+        return 0;
+    }
+    return !saida->erro;
+}
+
+static ssize_t escreverDisponivel(int descritor, const char *dados, size_t tamanho)
+{
+    size_t escritos = 0;
+    while (escritos < tamanho)
+    {
+        ssize_t resultado = write(descritor, dados + escritos, tamanho - escritos);
+        if (resultado < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+            return -1;
+        }
+        escritos += resultado;
+    }
+    return escritos;
+}
+
+static int responderConexao(ConexaoServidor *conexao, BufferSaida *saida)
+{
+    ssize_t escritos = saida->erro ? -1 : escreverDisponivel(conexao->descritor, saida->dados, saida->usado);
+    if (escritos >= 0 && (size_t)escritos < saida->usado)
+    {
+        conexao->tamanhoPendente = saida->usado - escritos;
+        conexao->enviado = 0;
+        conexao->pendente = malloc(conexao->tamanhoPendente);
+        if (conexao->pendente != NULL)
+        {
+            memcpy(conexao->pendente, saida->dados + escritos, conexao->tamanhoPendente);
+        }
+        escritos = conexao->pendente != NULL ? escritos : -1;
+    }
+    saida->usado = 0;
+    saida->erro = 0;
+    return escritos >= 0;
+}
+
+static int enviarPendente(ConexaoServidor *conexao)
+{
+    ssize_t escritos = escreverDisponivel(conexao->descritor, conexao->pendente + conexao->enviado,
+                                          conexao->tamanhoPendente - conexao->enviado);
+    if (escritos < 0)
+    {
+        return 0;
+    }
+    conexao->enviado += escritos;
+    if (conexao->enviado == conexao->tamanhoPendente)
+    {
+        free(conexao->pendente);
+        conexao->pendente = NULL;
+    }
+    return 1;
+}
+
+static int prepararTrabalhador(Servidor *servidor, BuscaAlcance *busca, unsigned long *versao)
+{
+    if (*versao == servidor->versao)
+    {
+        return 1;
+    }
+
+    free(busca->alvos);
+    liberarBuscaAlcance(busca);
+    if (servidor->grafo != NULL &&
+        (!prepararBuscaAlcance(busca, servidor->grafo) ||
+         (busca->alvos = calloc(servidor->grafo->quantidadeVertices + 1, 1)) == NULL))
+    {
+        printf("Erro de alocação de memória!\n");
+        return 0;
+    }
+    *versao = servidor->versao;
+    return 1;
+}
+
+static void *executarTrabalhador(void *argumento)
+{
+    Servidor *servidor = argumento;
+    BufferSaida saida;
+    BuscaAlcance busca;
+    memset(&busca, 0, sizeof(busca));
+    unsigned long versao = 0;
+    if (!iniciarBufferSaida(&saida, -1))
+    {
+        printf("Erro de alocação de memória!\n");
+        return NULL;
+    }
+
+    ConexaoServidor *conexao;
+    while ((conexao = retirarConexao(servidor)) != NULL)
+    {
+        int aberta;
+        if (conexao->pendente != NULL)
+        {
+            aberta = enviarPendente(conexao);
+        }
+        else
+        {
+            pthread_rwlock_rdlock(&servidor->travaDados);
+            aberta =
+                prepararTrabalhador(servidor, &busca, &versao) && atenderConexao(servidor, conexao, &saida, &busca);
+            pthread_rwlock_unlock(&servidor->travaDados);
+            aberta = responderConexao(conexao, &saida) && aberta;
+        }
+        if (!aberta)
+        {
+            encerrarConexao(servidor, conexao);
+            continue;
+        }
+
+        struct epoll_event evento;
+        evento.events = (conexao->pendente != NULL ? EPOLLOUT : EPOLLIN) | EPOLLRDHUP | EPOLLONESHOT;
+        evento.data.ptr = conexao;
+        if (epoll_ctl(servidor->epoll, EPOLL_CTL_MOD, conexao->descritor, &evento) < 0)
+        {
+            encerrarConexao(servidor, conexao);
+        }
+    }
+
+    finalizarBufferSaida(&saida);
+    free(busca.alvos);
+    liberarBuscaAlcance(&busca);
+    return NULL;
+}
+
+static int abrirSocket(char caminhoSocket[])
+{
+    struct sockaddr_un endereco;
+    if (strlen(caminhoSocket) >= sizeof(endereco.sun_path))
+    {
+        printf("Erro: caminho do socket '%s' muito longo!\n", caminhoSocket);
+        return -1;
+    }
+
+    int descritor = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (descritor < 0)
+    {
+        printf("Erro ao criar o socket!\n");
+        return -1;
+    }
+
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strcpy(endereco.sun_path, caminhoSocket);
+    unlink(caminhoSocket);
+
+    if (bind(descritor, (struct sockaddr *)&endereco, sizeof(endereco)) < 0 || listen(descritor, SOMAXCONN) < 0)
+    {
+        printf("Erro ao escutar em '%s'!\n", caminhoSocket);
+        close(descritor);
+        return -1;
+    }
+    return descritor;
+}
+
+static void aceitarConexoes(Servidor *servidor)
+{
+    for (;;)
+    {
+        int descritor = accept4(servidor->escuta, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (descritor < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+
+        ConexaoServidor *conexao = malloc(sizeof(ConexaoServidor));
+        if (conexao == NULL)
+        {
+            close(descritor);
+            continue;
+        }
+        conexao->descritor = descritor;
+        conexao->usado = 0;
+        conexao->pendente = NULL;
+        registrarConexao(servidor, conexao);
+
+        struct epoll_event evento;
+        evento.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+        evento.data.ptr = conexao;
+        if (epoll_ctl(servidor->epoll, EPOLL_CTL_ADD, descritor, &evento) < 0)
+        {
+            encerrarConexao(servidor, conexao);
+        }
+    }
+}
+
+void iniciarServidor(Servidor *servidor)
+{
+    memset(servidor, 0, sizeof(Servidor));
+    servidor->versao = 1;
+    pthread_rwlockattr_t atributos;
+    pthread_rwlockattr_init(&atributos);
+    pthread_rwlockattr_setkind_np(&atributos, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+    pthread_rwlock_init(&servidor->travaDados, &atributos);
+    pthread_rwlockattr_destroy(&atributos);
+}
+
+void liberarServidor(Servidor *servidor)
+{
+    free(servidor->fronteiras);
+    liberarGrafo(servidor->grafo);
+    liberarMemoria(servidor->lista);
+    pthread_rwlock_destroy(&servidor->travaDados);
+}
+
+static void marcarFronteiras(Servidor *servidor, char nomeArquivo[])
+{
+    char (*nomes)[50];
+    int quantidade = lerFronteiras(nomeArquivo, &nomes);
+    if (quantidade <= 0)
+    {
+        return;
+    }
+    servidor->fronteiras = malloc(sizeof(int) * quantidade);
+    for (int i = 0; servidor->fronteiras != NULL && i < quantidade; i++)
+    {
+        int vertice = buscarVertice(servidor->grafo, nomes[i]);
+        if (vertice >= 0)
+        {
+            servidor->fronteiras[servidor->quantidadeFronteiras++] = vertice;
+        }
+    }
+    free(nomes);
+}
+
+int atenderClientes(Servidor *servidor, char caminhoSocket[], int quantidadeTrabalhadores)
+{
+    servidor->escuta = abrirSocket(caminhoSocket);
+    if (servidor->escuta < 0)
+    {
+        return 1;
+    }
+
+    servidor->epoll = epoll_create1(EPOLL_CLOEXEC);
+    struct epoll_event evento;
+    evento.events = EPOLLIN;
+    evento.data.ptr = NULL;
+    if (servidor->epoll < 0 || epoll_ctl(servidor->epoll, EPOLL_CTL_ADD, servidor->escuta, &evento) < 0)
+    {
+        printf("Erro ao iniciar o laço de eventos!\n");
+        close(servidor->escuta);
+        unlink(caminhoSocket);
+        return 1;
+    }
+
+    struct sigaction acao;
+    memset(&acao, 0, sizeof(acao));
+    acao.sa_handler = tratarSinal;
+    sigaction(SIGINT, &acao, NULL);
+    sigaction(SIGTERM, &acao, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    sigset_t sinais, anteriores;
+    sigemptyset(&sinais);
+    sigaddset(&sinais, SIGINT);
+    sigaddset(&sinais, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sinais, &anteriores);
+
+    pthread_mutex_init(&servidor->trava, NULL);
+    pthread_cond_init(&servidor->sinal, NULL);
+    if (quantidadeTrabalhadores < 1)
+    {
+        quantidadeTrabalhadores = 1;
+    }
+    servidor->trabalhadores = malloc(sizeof(pthread_t) * quantidadeTrabalhadores);
+    for (int i = 0; servidor->trabalhadores != NULL && i < quantidadeTrabalhadores; i++)
+    {
+        if (pthread_create(&servidor->trabalhadores[i], NULL, executarTrabalhador, servidor) == 0)
+        {
+            servidor->quantidadeTrabalhadores++;
+        }
+    }
+    pthread_sigmask(SIG_SETMASK, &anteriores, NULL);
+
+    if (servidor->quantidadeTrabalhadores == 0)
+    {
+        printf("Erro ao criar as threads de atendimento!\n");
+        sinalEncerramento = 1;
+    }
+    else
+    {
+        printf("Servidor atendendo em '%s' com %d thread(s).\n", caminhoSocket, servidor->quantidadeTrabalhadores);
+        fflush(stdout);
+    }
+
+    struct epoll_event eventos[MAXIMO_EVENTOS];
+    while (!sinalEncerramento)
+    {
+        int prontos = epoll_wait(servidor->epoll, eventos, MAXIMO_EVENTOS, -1);
+        for (int i = 0; i < prontos; i++)
+        {
+            if (eventos[i].data.ptr == NULL)
+            {
+                aceitarConexoes(servidor);
+            }
+            else
+            {
+                enfileirarConexao(servidor, eventos[i].data.ptr);
+            }
+        }
+    }
+
+    pthread_mutex_lock(&servidor->trava);
+    servidor->encerrando = 1;
+    pthread_cond_broadcast(&servidor->sinal);
+    pthread_mutex_unlock(&servidor->trava);
+    for (int i = 0; i < servidor->quantidadeTrabalhadores; i++)
+    {
+        pthread_join(servidor->trabalhadores[i], NULL);
+    }
+
+    while (servidor->ativas != NULL)
+    {
+        encerrarConexao(servidor, servidor->ativas);
+    }
+
+    free(servidor->trabalhadores);
+    pthread_mutex_destroy(&servidor->trava);
+    pthread_cond_destroy(&servidor->sinal);
+    close(servidor->epoll);
+    close(servidor->escuta);
+    unlink(caminhoSocket);
+    return 0;
+}
+
+int executarServidor(char nomeArquivo[], char caminhoSocket[], int quantidadeTrabalhadores)
+{
+    Servidor servidor;
+    iniciarServidor(&servidor);
+
+    if (carregarRodoviasDeArquivo(&servidor.lista, nomeArquivo) == RODOVIAS_OK)
+    {
+        printf("Dados carregados de '%s' com sucesso!\n", nomeArquivo);
+    }
+    else
+    {
+        printf("Erro ao abrir o arquivo %s para leitura!\n", nomeArquivo);
+    }
+    long ignorados;
+    int recuperadas = lerDiario(nomeArquivo, &servidor.lista, &ignorados);
+    if (ignorados > 0)
+    {
+        printf("Aviso: %ld bytes incompletos ignorados no diário de '%s'.\n", ignorados, nomeArquivo);
+    }
+    if (recuperadas > 0)
+    {
+        printf("%d alteração(ões) não salvas recuperadas do diário de '%s'.\n", recuperadas, nomeArquivo);
+    }
+    conectarRodovias(servidor.lista);
+    obterKernelsNomes();
+    servidor.grafo = construirGrafo(servidor.lista);
+    if (servidor.grafo == NULL)
+    {
+        printf("Erro de alocação de memória!\n");
+        liberarServidor(&servidor);
+        return 1;
+    }
+
+    marcarFronteiras(&servidor, nomeArquivo);
+
+    int resultado = atenderClientes(&servidor, caminhoSocket, quantidadeTrabalhadores);
+    liberarServidor(&servidor);
+    if (resultado == 0)
+    {
+        printf("Servidor encerrado.\n");
+    }
+    return resultado;
+}
@@ -0,0 +1,175 @@
+#include <stdlib.h>
+#include <string.h>
+#include "estruturas.h"
+
+static int compararFaixa(FaixaTarifa *faixa, int classe, int inicio)
+{
+    if (faixa->classe != classe)
+    {
+        return faixa->classe < classe ? -1 : 1;
+    }
+    return faixa->inicio < inicio ? -1 : faixa->inicio > inicio;
+}
+
+static int faixasAte(TabelaTarifas *tabela, int classe, int minuto)
+{
+    int inicio = 0, fim = tabela->quantidade;
+    while (inicio < fim)
+    {
+        int meio = (inicio + fim) / 2;
+        if (compararFaixa(&tabela->faixas[meio], classe, minuto) <= 0)
+        {
+            inicio = meio + 1;
+        }
+        else
+        {
+            fim = meio;
+        }
+    }
+    return inicio;
+}
+
+static int possuiClasse(TabelaTarifas *tabela, int classe)
+{
+    int posicao = faixasAte(tabela, classe, MINUTOS_SEMANA) - 1;
+    return posicao >= 0 && tabela->faixas[posicao].classe == classe;
+}
+
+FaixaTarifa *buscarFaixaTarifa(TabelaTarifas *tabela, int classe, int minuto)
+{
+    int posicao = faixasAte(tabela, classe, minuto) - 1;
+    if (posicao < 0 || tabela->faixas[posicao].classe != classe)
+    {
+        posicao = faixasAte(tabela, classe, MINUTOS_SEMANA) - 1;
+    }
+    if (posicao < 0 || tabela->faixas[posicao].classe != classe)
+    {
+        return NULL;
+    }
+    return &tabela->faixas[posicao];
+}
+
+Centavos valorTarifa(TabelaTarifas *tabela, int classe, int minuto, Centavos fixo)
+{
+    if (minuto < 0 || tabela->quantidade == 0)
+    {
+        return fixo;
+    }
+
+    FaixaTarifa *faixa = buscarFaixaTarifa(tabela, classe, minuto);
+    if (faixa == NULL && classe != 0)
+    {
+        faixa = buscarFaixaTarifa(tabela, 0, minuto);
+    }
+    return faixa != NULL ? faixa->valor : fixo;
+}
+
+int gravarFaixaTarifa(TabelaTarifas *tabela, int classe, int inicio, Centavos valor)
+{
+    int posicao = faixasAte(tabela, classe, inicio);
+    if (posicao > 0 && compararFaixa(&tabela->faixas[posicao - 1], classe, inicio) == 0)
+    {
+        if (valor < 0)
+        {
+            memmove(&tabela->faixas[posicao - 1], &tabela->faixas[posicao],
+                    (tabela->quantidade - posicao) * sizeof(FaixaTarifa));
+            tabela->quantidade--;
+        }
+        else
+        {
+            tabela->faixas[posicao - 1].valor = valor;
+        }
+        return RODOVIAS_OK;
+    }
+    if (valor < 0)
+    {
+        return RODOVIAS_OK;
+    }
+
+    if (tabela->quantidade == tabela->capacidade)
+    {
+        int novaCapacidade = tabela->capacidade > 0 ? tabela->capacidade * 2 : 4;
+        FaixaTarifa *faixas = realloc(tabela->faixas, novaCapacidade * sizeof(FaixaTarifa));
+        if (faixas == NULL)
+        {
+            return RODOVIAS_ERRO_MEMORIA;
+        }
+        tabela->faixas = faixas;
+        tabela->capacidade = novaCapacidade;
+    }
+
+    memmove(&tabela->faixas[posicao + 1], &tabela->faixas[posicao],
+            (tabela->quantidade - posicao) * sizeof(FaixaTarifa));
+    tabela->faixas[posicao].classe = classe;
+    tabela->faixas[posicao].inicio = inicio;
+    tabela->faixas[posicao].valor = valor;
+    tabela->quantidade++;
+    return RODOVIAS_OK;
+}
+
+void liberarTabelaTarifas(TabelaTarifas *tabela)
+{
+    free(tabela->faixas);
+    memset(tabela, 0, sizeof(TabelaTarifas));
+}
+
+static int combinarClasse(TabelaTarifas *tabelas[], Centavos fixos[], int classe, TabelaTarifas *resultado)
+{
+    int status = gravarFaixaTarifa(resultado, classe, 0,
+                                   valorTarifa(tabelas[0], classe, 0, fixos[0]) +
+                                       valorTarifa(tabelas[1], classe, 0, fixos[1]));
+    for (int i = 0; i < 2 && status == RODOVIAS_OK; i++)
+    {
+        for (int j = 0; j < tabelas[i]->quantidade && status == RODOVIAS_OK; j++)
+        {
+            FaixaTarifa *faixa = &tabelas[i]->faixas[j];
+            if (faixa->classe != classe && faixa->classe != 0)
+            {
+                continue;
+            }
+            Centavos valor = valorTarifa(tabelas[0], classe, faixa->inicio, fixos[0]) +
+                          valorTarifa(tabelas[1], classe, faixa->inicio, fixos[1]);
+            status = gravarFaixaTarifa(resultado, classe, faixa->inicio, valor);
+        }
+    }
+    return status;
+}
+
+static void removerFaixasRedundantes(TabelaTarifas *tabela)
+{
+    int mantidas = 0;
+    for (int i = 0; i < tabela->quantidade; i++)
+    {
+        FaixaTarifa *faixa = &tabela->faixas[i];
+        if (mantidas > 0 && tabela->faixas[mantidas - 1].classe == faixa->classe &&
+            tabela->faixas[mantidas - 1].valor == faixa->valor)
+        {
+            continue;
+        }
+        tabela->faixas[mantidas++] = *faixa;
+    }
+    tabela->quantidade = mantidas;
+}
+
+int combinarTabelasTarifas(TabelaTarifas *primeira, Centavos fixoPrimeira, TabelaTarifas *segunda,
+                           Centavos fixoSegunda, TabelaTarifas *resultado)
+{
+    TabelaTarifas *tabelas[2] = {primeira, segunda};
+    Centavos fixos[2] = {fixoPrimeira, fixoSegunda};
+    memset(resultado, 0, sizeof(TabelaTarifas));
+
+    for (int i = 0; i < 2; i++)
+    {
+        for (int j = 0; j < tabelas[i]->quantidade; j++)
+        {
+            int classe = tabelas[i]->faixas[j].classe;
+            if (!possuiClasse(resultado, classe) && combinarClasse(tabelas, fixos, classe, resultado) != RODOVIAS_OK)
+            {
+                liberarTabelaTarifas(resultado);
+                return RODOVIAS_ERRO_MEMORIA;
+            }
+        }
+    }
+    removerFaixasRedundantes(resultado);
+    return RODOVIAS_OK;
+}